@@ -0,0 +1,59 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+// Parse the values of Host headers and the
+// targets of CONNECT requests, with the
+// authority rule and with parse_host_port.
+
+#include <boost/url/authority_view.hpp>
+#include "bench.hpp"
+
+#include <string>
+#include <vector>
+
+namespace urls = boost::urls;
+
+int
+main()
+{
+    std::vector<std::string> const hosts = {
+        "www.example.com",
+        "api.example.com:8443",
+        "static-assets.cdn.example-content.net",
+        "login.microsoftonline.com:443",
+        "10.0.0.1:8080",
+        "192.168.100.200",
+        "[::1]:443",
+        "[2001:db8:85a3::8a2e:370:7334]:8443",
+        "localhost:3000",
+        "a.b.c.d.e.f.example.org" };
+    std::size_t bytes = 0;
+    for(auto const& h : hosts)
+        bytes += h.size();
+
+    bench::report(
+        "parse_authority",
+        bench::measure([&]
+        {
+            for(auto const& h : hosts)
+                bench::do_not_optimize(
+                    urls::parse_authority(h));
+        }),
+        bytes);
+
+    bench::report(
+        "parse_host_port",
+        bench::measure([&]
+        {
+            for(auto const& h : hosts)
+                bench::do_not_optimize(
+                    urls::parse_host_port(h));
+        }),
+        bytes);
+}
@@ -0,0 +1,210 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_BENCH_HPP
+#define BOOST_URL_BENCH_HPP
+
+#include <boost/version.hpp>
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+// Prevent the optimizer from discarding
+// a value computed by the benchmark, or
+// from computing it once for every call
+// when its inputs do not change.
+template<class T>
+void
+do_not_optimize(T const& t)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "g"(&t) : "memory");
+#else
+    char const c = *reinterpret_cast<
+        char const volatile*>(&t);
+    (void)c;
+#endif
+}
+
+// Call f repeatedly for about the given
+// number of milliseconds, and return the
+// average number of nanoseconds per call.
+template<class F>
+double
+measure(
+    F&& f,
+    int ms = 200)
+{
+    using clock_type =
+        std::chrono::steady_clock;
+    // warm up
+    f();
+    std::size_t n = 0;
+    auto const t0 = clock_type::now();
+    auto const limit = t0 +
+        std::chrono::milliseconds(ms);
+    auto t1 = t0;
+    do
+    {
+        for(int i = 0; i < 16; ++i)
+            f();
+        n += 16;
+        t1 = clock_type::now();
+    }
+    while(t1 < limit);
+    return std::chrono::duration<
+        double, std::nano>(t1 - t0).count() / n;
+}
+
+// Hardware counters per call, measured
+// with perf.hpp. source is null when
+// nothing was counted.
+struct counts
+{
+    char const* source = nullptr;
+    double cycles = 0;
+    double instructions = 0;
+    double branch_misses = 0;
+    double l1_misses = 0;
+};
+
+// One line of results
+struct result
+{
+    std::string name;
+    double ns;
+    std::size_t units;
+    std::string unit;
+    counts hw;
+};
+
+// The results reported so far
+inline
+std::vector<result>&
+results()
+{
+    static std::vector<result> v;
+    return v;
+}
+
+// Print one line of results, with the
+// time per call and per unit of input,
+// and the cycles per unit of input and
+// instructions per cycle if counted.
+inline
+void
+report(
+    std::string const& name,
+    double ns,
+    std::size_t units,
+    char const* unit = "byte",
+    counts const& hw = {})
+{
+    results().push_back(
+        { name, ns, units, unit, hw });
+    std::cout <<
+        std::left << std::setw(44) << name <<
+        std::right << std::setw(12) <<
+            std::fixed << std::setprecision(1) <<
+            ns << " ns/op";
+    if(units > 0)
+        std::cout <<
+            std::setw(10) <<
+                std::setprecision(3) <<
+                ns / units << " ns/" << unit;
+    if(hw.source && units > 0)
+        std::cout <<
+            std::setw(10) <<
+                std::setprecision(3) <<
+                hw.cycles / units << " cyc/" << unit;
+    if(hw.instructions > 0)
+        std::cout <<
+            std::setw(8) <<
+                std::setprecision(2) <<
+                hw.instructions / hw.cycles << " IPC";
+    std::cout << std::endl;
+}
+
+inline
+void
+write_json_string(
+    std::ostream& os,
+    std::string const& s)
+{
+    os << '"';
+    for(char c : s)
+    {
+        if(c == '"' || c == '\\')
+            os << '\\' << c;
+        else if(static_cast<
+                unsigned char>(c) < 0x20)
+            os << ' ';
+        else
+            os << c;
+    }
+    os << '"';
+}
+
+// Write the results reported so far as a
+// JSON object, to compare them over versions.
+inline
+void
+write_json(
+    std::ostream& os,
+    std::string const& suite)
+{
+    os << "{\n  \"suite\": ";
+    write_json_string(os, suite);
+    os << ",\n  \"boost_version\": " <<
+        BOOST_VERSION << ",\n  \"results\": [";
+    auto const& v = results();
+    for(std::size_t i = 0; i < v.size(); ++i)
+    {
+        os << (i ? ",\n" : "\n") <<
+            "    { \"name\": ";
+        write_json_string(os, v[i].name);
+        os << std::fixed << std::setprecision(3) <<
+            ", \"ns_per_op\": " << v[i].ns <<
+            ", \"units\": " << v[i].units <<
+            ", \"unit\": ";
+        write_json_string(os, v[i].unit);
+        if(v[i].units > 0)
+            os << ", \"ns_per_unit\": " <<
+                v[i].ns / v[i].units;
+        auto const& hw = v[i].hw;
+        if(hw.source)
+        {
+            os << ",\n      \"counters\": ";
+            write_json_string(os, hw.source);
+            os << ", \"cycles_per_op\": " << hw.cycles;
+            if(v[i].units > 0)
+                os << ", \"cycles_per_unit\": " <<
+                    hw.cycles / v[i].units;
+        }
+        if(hw.instructions > 0)
+            os <<
+                ", \"ipc\": " <<
+                    hw.instructions / hw.cycles <<
+                ", \"branch_misses_per_op\": " <<
+                    hw.branch_misses <<
+                ", \"l1_misses_per_op\": " <<
+                    hw.l1_misses;
+        os << " }";
+    }
+    os << "\n  ]\n}\n";
+}
+
+} // bench
+
+#endif
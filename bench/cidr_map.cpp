@@ -0,0 +1,190 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+// Check the hosts of URLs against large
+// lists of IPv4 and IPv6 ranges, with a
+// hash set for each prefix length probed
+// from the longest, and with a cidr_map.
+
+#include <boost/url/cidr_map.hpp>
+#include <boost/url/url_view.hpp>
+#include "bench.hpp"
+
+#include <cstdint>
+#include <iostream>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace urls = boost::urls;
+
+namespace {
+
+std::uint32_t seed = 1;
+
+std::uint32_t
+next()
+{
+    seed = seed * 1103515245 + 12345;
+    return seed >> 8;
+}
+
+std::string
+v4_str(std::uint32_t v)
+{
+    return
+        std::to_string(v >> 24) + "." +
+        std::to_string((v >> 16) & 0xff) + "." +
+        std::to_string((v >> 8) & 0xff) + "." +
+        std::to_string(v & 0xff);
+}
+
+std::string
+v6_str(std::uint32_t a, std::uint32_t b)
+{
+    static char const hex[] =
+        "0123456789abcdef";
+    std::string s;
+    for(int i = 0; i < 2; ++i)
+    {
+        std::uint32_t const v = i ? b : a;
+        for(int j = 28; j >= 0; j -= 4)
+        {
+            s.push_back(hex[(v >> j) & 0xf]);
+            if(j == 16)
+                s.push_back(':');
+        }
+        s.push_back(':');
+    }
+    return s + ":";
+}
+
+void
+report_rate(
+    char const* name,
+    double ns,
+    std::size_t n)
+{
+    bench::report(name, ns, n, "lookup");
+    std::cout <<
+        "    " << std::setprecision(1) <<
+        1e3 * n / ns << " M lookups/s" <<
+        std::endl;
+}
+
+} // (anon)
+
+int
+main()
+{
+    // 20000 IPv4 ranges of /8 to /32 and
+    // 5000 IPv6 ranges of /16 to /64
+    std::set<std::string> seen;
+    std::string list4;
+    std::vector<std::pair<
+        std::uint32_t, unsigned>> v4;
+    for(int i = 0; i < 20000; ++i)
+    {
+        unsigned const len = 8 + next() % 25;
+        std::uint32_t const a = next() &
+            ~(0xffffffffu >> len);
+        std::string const s = v4_str(a) +
+            "/" + std::to_string(len);
+        if(! seen.insert(s).second)
+            continue;
+        v4.emplace_back(a, len);
+        list4 += s + "\n";
+    }
+    std::string list6;
+    for(int i = 0; i < 5000; ++i)
+    {
+        unsigned const len = 16 + next() % 49;
+        std::uint32_t a = 0x20010000 |
+            (next() & 0xffff);
+        std::uint32_t b = next();
+        if(len < 32)
+            a &= ~(0xffffffffu >> len);
+        b = len <= 32 ? 0 : len >= 64 ? b :
+            b & ~(0xffffffffu >> (len - 32));
+        std::string const s = v6_str(a, b) +
+            "/" + std::to_string(len);
+        if(seen.insert(s).second)
+            list6 += s + "\n";
+    }
+
+    // hosts of outbound requests, about
+    // half of which are in a range
+    std::vector<std::string> strs;
+    for(int i = 0; i < 1000; ++i)
+    {
+        std::uint32_t a = next() ^ (next() << 24);
+        if(i % 2)
+            a = v4[next() % v4.size()].first |
+                (next() & 0xff);
+        if(i % 4 == 3)
+            strs.push_back("https://[" + v6_str(
+                0x20010000 | (next() & 0xffff),
+                next()) + "1]/api");
+        else
+            strs.push_back("https://" +
+                v4_str(a) + ":8443/api");
+    }
+    std::vector<urls::url_view> urls_;
+    for(auto const& s : strs)
+        urls_.emplace_back(s);
+
+    {
+        // one map for each length
+        std::unordered_map<
+            std::uint32_t, int> m[33];
+        for(std::size_t i = 0; i < v4.size(); ++i)
+            m[v4[i].second].emplace(
+                v4[i].first, static_cast<int>(i));
+        report_rate("unordered_map per length (IPv4)",
+            bench::measure([&]
+            {
+                for(auto const& u : urls_)
+                {
+                    if(u.host_type() !=
+                        urls::host_type::ipv4)
+                        continue;
+                    std::uint32_t const a =
+                        u.ipv4_address().to_uint();
+                    int v = -1;
+                    for(int len = 32; len >= 0; --len)
+                    {
+                        auto const it = m[len].find(
+                            len ? a & ~(0xffffffffu >>
+                                (len - 1) >> 1) : 0);
+                        if(it != m[len].end())
+                        {
+                            v = it->second;
+                            break;
+                        }
+                    }
+                    bench::do_not_optimize(v);
+                }
+            }),
+            urls_.size());
+    }
+
+    {
+        urls::cidr_map<bool> m;
+        m.insert_list(list4, false);
+        m.insert_list(list6, false);
+        report_rate("cidr_map::find",
+            bench::measure([&]
+            {
+                for(auto const& u : urls_)
+                    bench::do_not_optimize(m.find(u));
+            }),
+            urls_.size());
+    }
+}
@@ -0,0 +1,150 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+// Write a seeded corpus of URLs, one per
+// line, and check that each one parses:
+//
+//  bench_corpus [--seed <n>] [--count <n>]
+//      [--out <file>] [--<option> <value>]...
+//
+// where each option is a member of
+// corpus_options, such as --max_depth 3
+// or --escape 0.1, and --scheme https=0.2
+// sets the weight of a scheme, adding it
+// if it is not in the list. The URLs go
+// to stdout without --out.
+
+#include <boost/url/url_view.hpp>
+#include "corpus.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+namespace urls = boost::urls;
+
+namespace {
+
+bool
+set_option(
+    bench::corpus_options& opt,
+    std::string const& k,
+    char const* v)
+{
+    struct { char const* k; double* p; } const d[] = {
+        { "reg_name", &opt.reg_name },
+        { "ipv4", &opt.ipv4 },
+        { "ipv6", &opt.ipv6 },
+        { "userinfo", &opt.userinfo },
+        { "port", &opt.port },
+        { "escape", &opt.escape },
+        { "fragment", &opt.fragment } };
+    struct { char const* k; std::size_t* p; } const n[] = {
+        { "min_depth", &opt.min_depth },
+        { "max_depth", &opt.max_depth },
+        { "min_segment", &opt.min_segment },
+        { "max_segment", &opt.max_segment },
+        { "min_params", &opt.min_params },
+        { "max_params", &opt.max_params } };
+    for(auto const& e : d)
+        if(k == e.k)
+        {
+            *e.p = std::atof(v);
+            return true;
+        }
+    for(auto const& e : n)
+        if(k == e.k)
+        {
+            *e.p = std::strtoul(v, nullptr, 10);
+            return true;
+        }
+    if(k != "scheme")
+        return false;
+    auto const eq = std::strchr(v, '=');
+    if(eq == nullptr)
+        return false;
+    std::string const name(v, eq);
+    if(urls::parse_uri(name + ":").has_error())
+        return false;
+    for(auto& e : opt.schemes)
+        if(e.first == name)
+        {
+            e.second = std::atof(eq + 1);
+            return true;
+        }
+    opt.schemes.emplace_back(
+        name, std::atof(eq + 1));
+    return true;
+}
+
+} // (anon)
+
+int
+main(int argc, char** argv)
+{
+    std::uint64_t seed = 1;
+    std::size_t count = 10000;
+    char const* out = nullptr;
+    bench::corpus_options opt;
+    for(int i = 1; i + 1 < argc; i += 2)
+    {
+        std::string const k = argv[i];
+        char const* const v = argv[i + 1];
+        if(k == "--seed")
+            seed = std::strtoull(v, nullptr, 10);
+        else if(k == "--count")
+            count = std::strtoul(v, nullptr, 10);
+        else if(k == "--out")
+            out = v;
+        else if(
+            k.size() < 3 ||
+            k.compare(0, 2, "--") != 0 ||
+            ! set_option(opt, k.substr(2), v))
+        {
+            std::cerr <<
+                "unknown option " << k << std::endl;
+            return 2;
+        }
+    }
+    if( opt.min_depth > opt.max_depth ||
+        opt.min_segment == 0 ||
+        opt.min_segment > opt.max_segment ||
+        opt.min_params > opt.max_params)
+    {
+        std::cerr <<
+            "bad lengths" << std::endl;
+        return 2;
+    }
+
+    std::ofstream f;
+    if(out)
+        f.open(out);
+    std::ostream& os = out ? f : std::cout;
+    bench::corpus c(seed, opt);
+    for(std::size_t i = 0; i < count; ++i)
+    {
+        auto const s = c.next();
+        if(urls::parse_uri(s).has_error())
+        {
+            std::cerr <<
+                "does not parse: " << s << std::endl;
+            return 1;
+        }
+        os << s << '\n';
+    }
+    if(! os)
+    {
+        std::cerr <<
+            "cannot write " <<
+            (out ? out : "stdout") << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,81 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+// Find the virtual host of requests, with
+// a lowercase copy of the host used as the
+// key of a hash map and with a host router.
+
+#include <boost/url/host_router.hpp>
+#include <boost/url/url_view.hpp>
+#include "bench.hpp"
+
+#include <cctype>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace urls = boost::urls;
+
+int
+main()
+{
+    // 500 tenants with a host each
+    std::vector<std::string> hosts;
+    for(int i = 0; i < 500; ++i)
+        hosts.push_back("tenant" +
+            std::to_string(i) + ".example.com");
+
+    std::vector<std::string> const targets = {
+        "https://tenant7.example.com/index.html",
+        "https://Tenant123.Example.com/api/v1/users",
+        "https://tenant499.example.com:8443/",
+        "https://www.example.org/",
+        "https://tenant42.EXAMPLE.COM/a/b/c" };
+    std::vector<urls::url_view> urls_;
+    for(auto const& t : targets)
+        urls_.emplace_back(t);
+
+    {
+        std::unordered_map<std::string, int> m;
+        for(std::size_t i = 0; i < hosts.size(); ++i)
+            m.emplace(hosts[i], static_cast<int>(i));
+        bench::report(
+            "lowercase copy + unordered_map",
+            bench::measure([&]
+            {
+                for(auto const& u : urls_)
+                {
+                    std::string key =
+                        u.host().to_string();
+                    for(auto& c : key)
+                        c = static_cast<char>(
+                            std::tolower(
+                                static_cast<unsigned char>(c)));
+                    auto const it = m.find(key);
+                    bench::do_not_optimize(
+                        it == m.end() ? -1 : it->second);
+                }
+            }),
+            urls_.size(), "host");
+    }
+
+    {
+        urls::host_router<int> r;
+        for(std::size_t i = 0; i < hosts.size(); ++i)
+            r.insert(hosts[i], static_cast<int>(i));
+        bench::report(
+            "host_router::find",
+            bench::measure([&]
+            {
+                for(auto const& u : urls_)
+                    bench::do_not_optimize(r.find(u));
+            }),
+            urls_.size(), "host");
+    }
+}
@@ -0,0 +1,141 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+// Parse and format IPv4 addresses, with
+// the dec-octet rules of the grammar one
+// at a time and with the address rule,
+// the batch parser and the formatter.
+
+#include <boost/url/ipv4_address.hpp>
+#include <boost/url/grammar/dec_octet_rule.hpp>
+#include <boost/url/grammar/delim_rule.hpp>
+#include <boost/url/grammar/parse.hpp>
+#include <boost/url/grammar/tuple_rule.hpp>
+#include <boost/url/rfc/ipv4_address_rule.hpp>
+#include "bench.hpp"
+
+#include <string>
+#include <vector>
+
+namespace urls = boost::urls;
+namespace grammar = boost::urls::grammar;
+
+namespace {
+
+// Write each octet with divisions
+std::size_t
+print_div(
+    char* dest,
+    std::uint32_t v)
+{
+    auto const start = dest;
+    for(int i = 3; i >= 0; --i)
+    {
+        unsigned o = (v >> (8 * i)) & 0xff;
+        if(o >= 100)
+            *dest++ = static_cast<char>('0' + o / 100);
+        if(o >= 10)
+            *dest++ = static_cast<char>('0' + o / 10 % 10);
+        *dest++ = static_cast<char>('0' + o % 10);
+        if(i > 0)
+            *dest++ = '.';
+    }
+    return dest - start;
+}
+
+} // (anon)
+
+int
+main()
+{
+    std::vector<std::string> strs;
+    std::uint32_t seed = 1;
+    for(int i = 0; i < 1000; ++i)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        // mostly private ranges, as in logs
+        std::uint32_t const v = (i % 2) ?
+            (0x0a000000 | (seed & 0xffffff)) : seed;
+        strs.push_back(urls::ipv4_address(
+            v).to_string());
+    }
+    std::vector<urls::string_view> svs(
+        strs.begin(), strs.end());
+    std::size_t bytes = 0;
+    for(auto const& s : strs)
+        bytes += s.size();
+
+    bench::report(
+        "dec_octet_rule tuple",
+        bench::measure([&]
+        {
+            for(auto s : svs)
+                bench::do_not_optimize(
+                    grammar::parse(s, grammar::tuple_rule(
+                        grammar::dec_octet_rule,
+                        grammar::squelch(grammar::delim_rule('.')),
+                        grammar::dec_octet_rule,
+                        grammar::squelch(grammar::delim_rule('.')),
+                        grammar::dec_octet_rule,
+                        grammar::squelch(grammar::delim_rule('.')),
+                        grammar::dec_octet_rule)));
+        }),
+        bytes);
+
+    bench::report(
+        "ipv4_address_rule",
+        bench::measure([&]
+        {
+            for(auto s : svs)
+                bench::do_not_optimize(grammar::parse(
+                    s, urls::ipv4_address_rule));
+        }),
+        bytes);
+
+    {
+        std::vector<urls::ipv4_address> out(svs.size());
+        bench::report(
+            "parse_ipv4_batch",
+            bench::measure([&]
+            {
+                bench::do_not_optimize(
+                    urls::parse_ipv4_batch(svs.data(),
+                        svs.size(), out.data()));
+            }),
+            bytes);
+    }
+
+    std::vector<urls::ipv4_address> addrs;
+    for(auto s : svs)
+        addrs.push_back(urls::parse_ipv4_address(s).value());
+    char buf[urls::ipv4_address::max_str_len];
+
+    bench::report(
+        "print with divisions",
+        bench::measure([&]
+        {
+            for(auto const& a : addrs)
+            {
+                bench::do_not_optimize(
+                    print_div(buf, a.to_uint()));
+                bench::do_not_optimize(buf);
+            }
+        }),
+        addrs.size(), "address");
+
+    bench::report(
+        "ipv4_address::to_buffer",
+        bench::measure([&]
+        {
+            for(auto const& a : addrs)
+                bench::do_not_optimize(
+                    a.to_buffer(buf, sizeof(buf)));
+        }),
+        addrs.size(), "address");
+}
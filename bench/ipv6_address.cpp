@@ -0,0 +1,94 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+// Parse and format IPv6 addresses, full,
+// compressed and with an IPv4 tail.
+
+#include <boost/url/ipv6_address.hpp>
+#include <boost/url/grammar/parse.hpp>
+#include <boost/url/rfc/ipv6_address_rule.hpp>
+#include "bench.hpp"
+
+#include <string>
+#include <vector>
+
+namespace urls = boost::urls;
+namespace grammar = boost::urls::grammar;
+
+int
+main()
+{
+    std::vector<urls::ipv6_address> addrs;
+    std::uint32_t seed = 1;
+    for(int i = 0; i < 1000; ++i)
+    {
+        urls::ipv6_address::bytes_type b{};
+        for(auto& c : b)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            c = static_cast<unsigned char>(seed >> 24);
+        }
+        switch(i % 4)
+        {
+        case 0:
+            // global unicast
+            break;
+        case 1:
+            // 2001:db8::x:y
+            b = {{ 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0,
+                0, 0, 0, 0, b[12], b[13], b[14], b[15] }};
+            break;
+        case 2:
+            // link local
+            b[0] = 0xfe;
+            b[1] = 0x80;
+            for(int j = 2; j < 8; ++j)
+                b[j] = 0;
+            break;
+        default:
+            // IPv4-mapped
+            for(int j = 0; j < 10; ++j)
+                b[j] = 0;
+            b[10] = 0xff;
+            b[11] = 0xff;
+            break;
+        }
+        addrs.emplace_back(b);
+    }
+    std::vector<std::string> strs;
+    std::size_t bytes = 0;
+    for(auto const& a : addrs)
+    {
+        strs.push_back(a.to_string());
+        bytes += strs.back().size();
+    }
+    std::vector<urls::string_view> svs(
+        strs.begin(), strs.end());
+
+    bench::report(
+        "ipv6_address_rule",
+        bench::measure([&]
+        {
+            for(auto s : svs)
+                bench::do_not_optimize(grammar::parse(
+                    s, urls::ipv6_address_rule));
+        }),
+        bytes);
+
+    char buf[urls::ipv6_address::max_str_len];
+    bench::report(
+        "ipv6_address::to_buffer",
+        bench::measure([&]
+        {
+            for(auto const& a : addrs)
+                bench::do_not_optimize(
+                    a.to_buffer(buf, sizeof(buf)));
+        }),
+        addrs.size(), "address");
+}
@@ -0,0 +1,100 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+// Look up the keys an API handler needs in
+// a query with many parameters.
+
+#include <boost/url/params_index.hpp>
+#include <boost/url/url_view.hpp>
+#include "bench.hpp"
+
+#include <string>
+#include <vector>
+
+namespace urls = boost::urls;
+
+int
+main()
+{
+    std::string q = "/api/v1/items?";
+    for(int i = 0; i < 60; ++i)
+    {
+        if(i > 0)
+            q += '&';
+        q += "field_" + std::to_string(i) +
+            "=value%20" + std::to_string(i);
+    }
+    urls::url_view const u(q);
+
+    std::vector<std::string> keys;
+    for(int i = 0; i < 60; i += 4)
+        keys.push_back(
+            "field_" + std::to_string(i));
+    keys.push_back("missing");
+
+    {
+        auto const ps = u.params();
+        bench::report(
+            "params_view::find",
+            bench::measure([&]
+            {
+                for(auto const& k : keys)
+                    bench::do_not_optimize(
+                        ps.find(k));
+            }),
+            keys.size(), "key");
+    }
+
+    {
+        auto const ps = u.params();
+        alignas(std::size_t) char buf[
+            urls::params_index::storage_size(64)];
+        bench::report(
+            "params_index build + find",
+            bench::measure([&]
+            {
+                urls::params_index const idx(
+                    ps, buf, sizeof(buf));
+                for(auto const& k : keys)
+                    bench::do_not_optimize(
+                        idx.find(k));
+            }),
+            keys.size(), "key");
+    }
+
+    {
+        auto const ps = u.encoded_params();
+        bench::report(
+            "params_encoded_view::find",
+            bench::measure([&]
+            {
+                for(auto const& k : keys)
+                    bench::do_not_optimize(
+                        ps.find(k));
+            }),
+            keys.size(), "key");
+    }
+
+    {
+        auto const ps = u.encoded_params();
+        alignas(std::size_t) char buf[
+            urls::params_encoded_index::storage_size(64)];
+        bench::report(
+            "params_encoded_index build + find",
+            bench::measure([&]
+            {
+                urls::params_encoded_index const idx(
+                    ps, buf, sizeof(buf));
+                for(auto const& k : keys)
+                    bench::do_not_optimize(
+                        idx.find(k));
+            }),
+            keys.size(), "key");
+    }
+}
@@ -0,0 +1,252 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_BENCH_PERF_HPP
+#define BOOST_URL_BENCH_PERF_HPP
+
+#include "bench.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__linux__)
+# include <linux/perf_event.h>
+# include <sys/ioctl.h>
+# include <sys/syscall.h>
+# include <unistd.h>
+# define BOOST_URL_BENCH_PERF_EVENT
+#endif
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+# include <intrin.h>
+# define BOOST_URL_BENCH_RDTSC
+#elif defined(__x86_64__) || defined(__i386__)
+# include <x86intrin.h>
+# define BOOST_URL_BENCH_RDTSC
+#endif
+
+namespace bench {
+
+// Hardware counters around a block of code.
+//
+// On Linux, cycles, instructions, branch
+// misses and L1 data cache read misses are
+// read with perf_event_open, as one group
+// so they cover the same instructions. A
+// counter the machine lacks reads as zero.
+// Without perf events, which is common in
+// containers and virtual machines, cycles
+// are the ticks of rdtsc, which count at a
+// fixed rate rather than the core clock,
+// and nothing else is counted.
+class counters
+{
+    enum
+    {
+        cycles,
+        instructions,
+        branch_misses,
+        l1_misses,
+        count
+    };
+
+    int fd_[count];
+    std::uint64_t id_[count];
+    std::uint64_t tsc_ = 0;
+
+#ifdef BOOST_URL_BENCH_PERF_EVENT
+    static
+    int
+    open(
+        std::uint32_t type,
+        std::uint64_t config,
+        int group) noexcept
+    {
+        perf_event_attr a;
+        std::memset(&a, 0, sizeof(a));
+        a.size = sizeof(a);
+        a.type = type;
+        a.config = config;
+        a.disabled = group == -1;
+        a.exclude_kernel = 1;
+        a.exclude_hv = 1;
+        a.read_format =
+            PERF_FORMAT_GROUP |
+            PERF_FORMAT_ID;
+        return static_cast<int>(syscall(
+            __NR_perf_event_open,
+            &a, 0, -1, group, 0));
+    }
+#endif
+
+public:
+    counters() noexcept
+    {
+        for(int i = 0; i < count; ++i)
+        {
+            fd_[i] = -1;
+            id_[i] = 0;
+        }
+#ifdef BOOST_URL_BENCH_PERF_EVENT
+        fd_[cycles] = open(
+            PERF_TYPE_HARDWARE,
+            PERF_COUNT_HW_CPU_CYCLES, -1);
+        if(fd_[cycles] == -1)
+            return;
+        fd_[instructions] = open(
+            PERF_TYPE_HARDWARE,
+            PERF_COUNT_HW_INSTRUCTIONS,
+            fd_[cycles]);
+        fd_[branch_misses] = open(
+            PERF_TYPE_HARDWARE,
+            PERF_COUNT_HW_BRANCH_MISSES,
+            fd_[cycles]);
+        fd_[l1_misses] = open(
+            PERF_TYPE_HW_CACHE,
+            PERF_COUNT_HW_CACHE_L1D |
+            (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+            (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+            fd_[cycles]);
+        for(int i = 0; i < count; ++i)
+            if( fd_[i] != -1 &&
+                ioctl(fd_[i], PERF_EVENT_IOC_ID,
+                    &id_[i]) == -1)
+            {
+                ::close(fd_[i]);
+                fd_[i] = -1;
+            }
+#endif
+    }
+
+    ~counters()
+    {
+#ifdef BOOST_URL_BENCH_PERF_EVENT
+        for(int i = 0; i < count; ++i)
+            if(fd_[i] != -1)
+                ::close(fd_[i]);
+#endif
+    }
+
+    counters(counters const&) = delete;
+    counters& operator=(counters const&) = delete;
+
+    // Return where the counts come from:
+    // "perf", "rdtsc", or "none"
+    char const*
+    source() const noexcept
+    {
+        if(fd_[cycles] != -1)
+            return "perf";
+#ifdef BOOST_URL_BENCH_RDTSC
+        return "rdtsc";
+#else
+        return "none";
+#endif
+    }
+
+    void
+    start() noexcept
+    {
+#ifdef BOOST_URL_BENCH_PERF_EVENT
+        if(fd_[cycles] != -1)
+        {
+            ioctl(fd_[cycles], PERF_EVENT_IOC_RESET,
+                PERF_IOC_FLAG_GROUP);
+            ioctl(fd_[cycles], PERF_EVENT_IOC_ENABLE,
+                PERF_IOC_FLAG_GROUP);
+            return;
+        }
+#endif
+#ifdef BOOST_URL_BENCH_RDTSC
+        tsc_ = __rdtsc();
+#endif
+    }
+
+    // Return the counts since start,
+    // divided by n
+    counts
+    stop(std::size_t n) noexcept
+    {
+        counts c;
+        c.source = source();
+#ifdef BOOST_URL_BENCH_PERF_EVENT
+        if(fd_[cycles] != -1)
+        {
+            ioctl(fd_[cycles], PERF_EVENT_IOC_DISABLE,
+                PERF_IOC_FLAG_GROUP);
+            // nr, then { value, id } for each
+            std::uint64_t buf[1 + 2 * count];
+            auto const r = ::read(
+                fd_[cycles], buf, sizeof(buf));
+            if(r < static_cast<long>(
+                    sizeof(std::uint64_t)))
+                return c;
+            double* const out[count] = {
+                &c.cycles,
+                &c.instructions,
+                &c.branch_misses,
+                &c.l1_misses };
+            for(std::uint64_t j = 0;
+                j < buf[0] && j < count; ++j)
+                for(int i = 0; i < count; ++i)
+                    if( fd_[i] != -1 &&
+                        id_[i] == buf[2 + 2 * j])
+                        *out[i] = static_cast<
+                            double>(buf[1 + 2 * j]) / n;
+            return c;
+        }
+#endif
+#ifdef BOOST_URL_BENCH_RDTSC
+        c.cycles = static_cast<double>(
+            __rdtsc() - tsc_) / n;
+#endif
+        (void)n;
+        return c;
+    }
+};
+
+// Call f as many times as bench::measure
+// would in about ms milliseconds, and
+// return the counts per call.
+template<class F>
+counts
+measure_counters(
+    counters& pc,
+    F&& f,
+    int ms = 200)
+{
+    using clock_type =
+        std::chrono::steady_clock;
+    // warm up, and find the number
+    // of calls to make
+    f();
+    std::size_t n = 16;
+    for(;;)
+    {
+        auto const t0 = clock_type::now();
+        for(std::size_t i = 0; i < n; ++i)
+            f();
+        auto const t = clock_type::now() - t0;
+        if(t >= std::chrono::milliseconds(ms) / 8)
+        {
+            n *= 8;
+            break;
+        }
+        n *= 2;
+    }
+    pc.start();
+    for(std::size_t i = 0; i < n; ++i)
+        f();
+    return pc.stop(n);
+}
+
+} // bench
+
+#endif
@@ -0,0 +1,93 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+// Extract the typed parameters of a search
+// request, with lookups and conversions as
+// handlers do them and with a schema.
+
+#include <boost/url/query_schema.hpp>
+#include <boost/url/url_view.hpp>
+#include "bench.hpp"
+
+#include <string>
+#include <vector>
+
+namespace urls = boost::urls;
+
+namespace {
+
+struct search
+{
+    unsigned page = 1;
+    unsigned limit = 20;
+    urls::string_view sort;
+    bool debug = false;
+    std::vector<unsigned> ids;
+};
+
+} // (anon)
+
+int
+main()
+{
+    urls::url_view const u(
+        "/search?q=red+shoes&page=3&limit=50&sort=price"
+        "&utm_source=mail&id=10&id=20&id=30&debug=1");
+
+    {
+        auto const ps = u.params();
+        bench::report(
+            "params_view::find + std::stoul",
+            bench::measure([&]
+            {
+                search s;
+                auto it = ps.find("page");
+                if(it != ps.end())
+                    s.page = static_cast<unsigned>(std::stoul(
+                        (*it).value.to_string()));
+                it = ps.find("limit");
+                if(it != ps.end())
+                    s.limit = static_cast<unsigned>(std::stoul(
+                        (*it).value.to_string()));
+                auto const eps = u.encoded_params();
+                auto eit = eps.find("sort");
+                if(eit != eps.end())
+                    s.sort = (*eit).value;
+                it = ps.find("debug");
+                if(it != ps.end())
+                    s.debug = (*it).value == "1";
+                for(it = ps.find("id"); it != ps.end();
+                    it = ps.find(++it, "id"))
+                    s.ids.push_back(static_cast<unsigned>(
+                        std::stoul((*it).value.to_string())));
+                bench::do_not_optimize(s);
+            }),
+            1, "query");
+    }
+
+    {
+        auto const schema = urls::make_query_schema(
+            urls::query_field("page", &search::page),
+            urls::query_field("limit", &search::limit),
+            urls::query_field("sort", &search::sort),
+            urls::query_field("debug", &search::debug),
+            urls::query_field("id", &search::ids));
+        auto const q = u.encoded_query();
+        bench::report(
+            "query_schema::parse",
+            bench::measure([&]
+            {
+                search s;
+                bench::do_not_optimize(
+                    schema.parse(q, s));
+                bench::do_not_optimize(s);
+            }),
+            1, "query");
+    }
+}
@@ -0,0 +1,141 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+// Parse lists with a range rule which is
+// too large for the small buffer of range,
+// so that each parse acquires an instance
+// from the recycle bin, on one thread and
+// then on every core.
+
+#include <boost/url/grammar/delim_rule.hpp>
+#include <boost/url/grammar/parse.hpp>
+#include <boost/url/grammar/range_rule.hpp>
+#include <boost/url/grammar/recycled.hpp>
+#include <boost/url/grammar/tuple_rule.hpp>
+#include "bench.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace urls = boost::urls;
+namespace grammar = urls::grammar;
+
+namespace {
+
+// A field of a list, with a byte for
+// each char, which makes the rule
+// larger than the small buffer.
+struct field_rule_t
+{
+    using value_type = urls::string_view;
+
+    bool table[256];
+
+    field_rule_t() noexcept
+    {
+        for(int c = 0; c < 256; ++c)
+            table[c] =
+                (c >= 'a' && c <= 'z') ||
+                (c >= '0' && c <= '9') ||
+                c == '-' || c == '.';
+    }
+
+    urls::result<value_type>
+    parse(
+        char const*& it,
+        char const* end) const noexcept
+    {
+        auto const start = it;
+        while( it != end &&
+            table[static_cast<
+                unsigned char>(*it)])
+            ++it;
+        return urls::string_view(
+            start, it - start);
+    }
+};
+
+} // (anon)
+
+int
+main()
+{
+    field_rule_t const field;
+    auto const next = grammar::tuple_rule(
+        grammar::squelch(
+            grammar::delim_rule(',')),
+        field);
+    auto const r = grammar::range_rule(
+        field, next);
+
+    // the rules held by the range
+    struct impl
+    {
+        field_rule_t first;
+        decltype(next) n;
+    };
+    static_assert(
+        sizeof(impl) > 128,
+        "rule must not fit the small buffer");
+    std::string const s =
+        "gzip,deflate,br,zstd,identity";
+
+    auto const parse = [&]
+    {
+        auto rv = grammar::parse(s, r);
+        bench::do_not_optimize(rv->size());
+    };
+
+    bench::report(
+        "range_rule, one thread",
+        bench::measure(parse),
+        s.size());
+
+    // every core parses a fixed count,
+    // and the time per parse is the wall
+    // time over the total count
+    unsigned const n = (std::max)(
+        std::thread::hardware_concurrency(), 1u);
+    std::size_t const count = 500000;
+    std::vector<std::thread> v;
+    auto const t0 =
+        std::chrono::steady_clock::now();
+    for(unsigned i = 0; i < n; ++i)
+        v.emplace_back([&]
+        {
+            for(std::size_t j = 0; j < count; ++j)
+                parse();
+        });
+    for(auto& t : v)
+        t.join();
+    auto const t1 =
+        std::chrono::steady_clock::now();
+    double const ns = std::chrono::duration<
+        double, std::nano>(t1 - t0).count();
+    bench::report(
+        "range_rule, " + std::to_string(n) +
+            " threads (per core)",
+        ns / count,
+        s.size());
+
+    // the bin of every type erased rule
+    // of the same size as the range
+    auto const st = grammar::recycled<
+        grammar::aligned_storage<impl>>::
+            default_bin().stats();
+    std::cout <<
+        "    hits " << st.hits <<
+        ", misses " << st.misses <<
+        ", cross-thread frees " <<
+        st.cross_thread_frees << std::endl;
+}
@@ -0,0 +1,94 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+// Adversarial inputs for dot segment removal.
+// The time per segment should stay flat as the
+// number of segments grows.
+
+#include <boost/url/url.hpp>
+#include <boost/url/url_view.hpp>
+#include "bench.hpp"
+
+#include <string>
+
+namespace urls = boost::urls;
+
+int
+main()
+{
+    urls::url_view const base =
+        urls::parse_uri(
+            "http://www.example.com/a/b/c/d?q").value();
+
+    for(std::size_t n = 1000; n <= 16000; n *= 2)
+    {
+        // "x/./x/./.../../../g"
+        std::string ref;
+        for(std::size_t i = 0; i < n; ++i)
+            ref += "x/./";
+        for(std::size_t i = 0; i < n; ++i)
+            ref += "../";
+        ref += "g";
+        urls::url_view const r =
+            urls::parse_relative_ref(ref).value();
+        urls::url dest;
+        urls::error_code ec;
+        bench::report(
+            "resolve " + std::to_string(3 * n) + " segments",
+            bench::measure([&]
+            {
+                urls::resolve(base, r, dest, ec);
+                bench::do_not_optimize(dest.size());
+            }),
+            3 * n, "segment");
+    }
+
+    for(std::size_t n = 1000; n <= 16000; n *= 2)
+    {
+        // "/x/./x/./.../../.."
+        std::string path;
+        for(std::size_t i = 0; i < n; ++i)
+            path += "/x/.";
+        for(std::size_t i = 0; i < n; ++i)
+            path += "/..";
+        urls::url_view const r =
+            urls::parse_relative_ref(path).value();
+        urls::url u;
+        u.reserve(r.size());
+        bench::report(
+            "normalize_path " + std::to_string(3 * n) + " segments",
+            bench::measure([&]
+            {
+                u = r;
+                u.normalize_path();
+                bench::do_not_optimize(u.size());
+            }),
+            3 * n, "segment");
+    }
+
+    {
+        // no dot segments: only the pre-check runs
+        std::string path;
+        for(std::size_t i = 0; i < 1000; ++i)
+            path += "/segment";
+        urls::url_view const r =
+            urls::parse_relative_ref(path).value();
+        urls::url u;
+        u.reserve(r.size());
+        bench::report(
+            "normalize_path without dot segments",
+            bench::measure([&]
+            {
+                u = r;
+                u.normalize_path();
+                bench::do_not_optimize(u.size());
+            }),
+            path.size());
+    }
+}
@@ -0,0 +1,112 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+// Resolve the links of one page against
+// its base, as a crawler would.
+
+#include <boost/url/base_resolver.hpp>
+#include <boost/url/static_url.hpp>
+#include <boost/url/url.hpp>
+#include <boost/url/url_view.hpp>
+#include "bench.hpp"
+
+#include <vector>
+
+namespace urls = boost::urls;
+
+int
+main()
+{
+    urls::url_view const base =
+        urls::parse_uri(
+            "https://www.example.com/docs/guide/intro.html?lang=en").value();
+
+    char const* const links[] = {
+        "chapter1.html",
+        "./chapter2.html#section-3",
+        "../reference/index.html",
+        "../../blog/2022/05/post.html?utm_source=docs",
+        "/static/css/main.css",
+        "/search?q=url&page=2",
+        "//cdn.example.net/js/app.js",
+        "https://other.example.org/path/to/page",
+        "#top",
+        "?lang=fr",
+        "images/figure-1.png",
+        "../guide/./intro.html",
+        };
+    std::vector<urls::url_view> refs;
+    for(auto s : links)
+        refs.push_back(
+            urls::parse_uri_reference(s).value());
+
+    {
+        urls::url dest;
+        urls::error_code ec;
+        bench::report(
+            "resolve",
+            bench::measure([&]
+            {
+                for(auto const& r : refs)
+                {
+                    urls::resolve(base, r, dest, ec);
+                    bench::do_not_optimize(dest.size());
+                }
+            }),
+            refs.size(), "link");
+    }
+
+    urls::base_resolver const br(base);
+
+    {
+        urls::url dest;
+        bench::report(
+            "base_resolver into url",
+            bench::measure([&]
+            {
+                for(auto const& r : refs)
+                {
+                    br.resolve(r, dest);
+                    bench::do_not_optimize(dest.size());
+                }
+            }),
+            refs.size(), "link");
+    }
+
+    {
+        urls::static_url<1024> dest;
+        bench::report(
+            "base_resolver into static_url",
+            bench::measure([&]
+            {
+                for(auto const& r : refs)
+                {
+                    br.resolve(r, dest);
+                    bench::do_not_optimize(dest.size());
+                }
+            }),
+            refs.size(), "link");
+    }
+
+    {
+        char buf[1024];
+        bench::report(
+            "base_resolver into buffer",
+            bench::measure([&]
+            {
+                for(auto const& r : refs)
+                {
+                    auto const v = br.resolve(
+                        r, buf, sizeof(buf));
+                    bench::do_not_optimize(v.size());
+                }
+            }),
+            refs.size(), "link");
+    }
+}
@@ -0,0 +1,185 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+// Match request paths against a table of
+// about a thousand API routes, with a
+// linear scan over the patterns as a
+// handler table would do, with the radix
+// tree router, and with the router
+// compiled to jump tables.
+
+#include <boost/url/compiled_router.hpp>
+#include <boost/url/router.hpp>
+#include <boost/url/url_view.hpp>
+#include "bench.hpp"
+
+#include <string>
+#include <vector>
+
+namespace urls = boost::urls;
+
+namespace {
+
+char const* const resources[] = {
+    "users", "groups", "projects", "issues",
+    "comments", "files", "orders", "invoices",
+    "products", "carts", "reviews", "tags",
+    "teams", "events", "reports", "alerts",
+    "tokens", "hooks", "jobs", "builds",
+    "releases", "assets", "notes", "pages",
+    "sessions" };
+
+char const* const subs[] = {
+    "members", "history", "labels",
+    "settings", "stats", "owners" };
+
+std::vector<std::string>
+split(urls::string_view s)
+{
+    std::vector<std::string> v;
+    if(! s.empty() && s.front() == '/')
+        s.remove_prefix(1);
+    if(s.empty())
+        return v;
+    for(;;)
+    {
+        auto const pos = s.find('/');
+        v.emplace_back(s.substr(0, pos));
+        if(pos == urls::string_view::npos)
+            break;
+        s.remove_prefix(pos + 1);
+    }
+    return v;
+}
+
+// Match each pattern in turn, the first
+// one with all segments equal wins.
+struct linear_router
+{
+    std::vector<std::vector<std::string>> v;
+
+    void
+    insert(urls::string_view pattern)
+    {
+        v.push_back(split(pattern));
+    }
+
+    std::size_t
+    find(urls::segments_encoded_view path) const
+    {
+        for(std::size_t i = 0; i < v.size(); ++i)
+        {
+            auto const& p = v[i];
+            if(p.size() != path.size())
+                continue;
+            auto it = path.begin();
+            std::size_t j = 0;
+            for(; j < p.size(); ++j, ++it)
+            {
+                if(p[j].front() == '{')
+                {
+                    if((*it).empty())
+                        break;
+                    continue;
+                }
+                if(p[j] != *it)
+                    break;
+            }
+            if(j == p.size())
+                return i;
+        }
+        return std::size_t(-1);
+    }
+};
+
+} // (anon)
+
+int
+main()
+{
+    // 5 versions * 25 resources * 8
+    // patterns = 1000 routes
+    std::vector<std::string> patterns;
+    for(int ver = 1; ver <= 5; ++ver)
+    {
+        std::string const api =
+            "/api/v" + std::to_string(ver) + "/";
+        for(auto r : resources)
+        {
+            std::string const base = api + r;
+            patterns.push_back(base);
+            patterns.push_back(base + "/search");
+            patterns.push_back(base + "/{id}");
+            for(int k = 0; k < 5; ++k)
+                patterns.push_back(
+                    base + "/{id}/" + subs[k]);
+        }
+    }
+
+    std::vector<std::string> const targets = {
+        "/api/v1/users",
+        "/api/v3/projects/1234",
+        "/api/v5/sessions/abc/owners",
+        "/api/v4/invoices/search",
+        "/api/v2/reports/77/history",
+        "/api/v5/releases/v1.2.3/labels",
+        "/api/v6/users",
+        "/api/v3/orders/9/unknown" };
+    std::vector<urls::url_view> urls_;
+    for(auto const& t : targets)
+        urls_.emplace_back(t);
+
+    {
+        linear_router r;
+        for(auto const& p : patterns)
+            r.insert(p);
+        bench::report(
+            "linear scan",
+            bench::measure([&]
+            {
+                for(auto const& u : urls_)
+                    bench::do_not_optimize(
+                        r.find(u.encoded_segments()));
+            }),
+            urls_.size(), "path");
+    }
+
+    {
+        urls::router<std::size_t> r;
+        for(std::size_t i = 0; i < patterns.size(); ++i)
+            r.insert(patterns[i], i);
+        bench::report(
+            "router::find",
+            bench::measure([&]
+            {
+                urls::route_match m;
+                for(auto const& u : urls_)
+                    bench::do_not_optimize(
+                        r.find(u.encoded_segments(), m));
+            }),
+            urls_.size(), "path");
+    }
+
+    {
+        urls::router<std::size_t> r;
+        for(std::size_t i = 0; i < patterns.size(); ++i)
+            r.insert(patterns[i], i);
+        urls::compiled_router<std::size_t> const cr(r);
+        bench::report(
+            "compiled_router::find",
+            bench::measure([&]
+            {
+                urls::route_match m;
+                for(auto const& u : urls_)
+                    bench::do_not_optimize(
+                        cr.find(u.encoded_path(), m));
+            }),
+            urls_.size(), "path");
+    }
+}
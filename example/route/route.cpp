@@ -21,6 +21,7 @@
 #include <boost/url/error.hpp>
 #include <boost/url/segments_encoded.hpp>
 #include <boost/url/segments_encoded_view.hpp>
+#include <boost/url/segments_index.hpp>
 #include <boost/url/string_view.hpp>
 #include <boost/url/url.hpp>
 #include <boost/url/url_view.hpp>
@@ -120,15 +121,12 @@ public:
                 static_cast<urls::url_view>(prefix_).segments()))
         {
             result = root_;
-            auto segs = target.segments();
-            auto it = segs.begin();
-            auto end = segs.end();
-            std::advance(it, prefix_.segments().size());
-            while (it != end)
+            urls::segments_index segs(target.segments());
+            for (std::size_t i = prefix_.segments().size();
+                 i < segs.size(); ++i)
             {
-                auto seg = *it;
+                auto seg = segs[i];
                 result.append(seg.begin(), seg.end());
-                ++it;
             }
             return true;
         }
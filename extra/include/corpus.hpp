@@ -0,0 +1,326 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef CORPUS_HPP
+#define CORPUS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Shared by the benchmarks and the unit
+// tests, which use rng for their fuzzing
+
+namespace bench {
+
+// A generator with the same output on
+// every platform, unlike the engines and
+// distributions of <random>. (splitmix64)
+class rng
+{
+    std::uint64_t s_;
+
+public:
+    explicit
+    rng(std::uint64_t seed) noexcept
+        : s_(seed)
+    {
+    }
+
+    std::uint64_t
+    operator()() noexcept
+    {
+        std::uint64_t z =
+            (s_ += 0x9e3779b97f4a7c15ull);
+        z = (z ^ (z >> 30)) *
+            0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) *
+            0x94d049bb133111ebull;
+        return z ^ (z >> 31);
+    }
+
+    // uniform in [lo, hi]
+    std::size_t
+    range(
+        std::size_t lo,
+        std::size_t hi) noexcept
+    {
+        return lo + static_cast<std::size_t>(
+            (*this)() % (hi - lo + 1));
+    }
+
+    // true with probability p
+    bool
+    chance(double p) noexcept
+    {
+        return ((*this)() >> 11) *
+            (1.0 / 9007199254740992.0) < p;
+    }
+};
+
+// The distributions of the parts of
+// generated URLs. Lengths and counts are
+// uniform in [min, max], and each double
+// is a probability.
+struct corpus_options
+{
+    // schemes and their weights
+    std::vector<std::pair<
+        std::string, double>> schemes = {
+            { "https", 0.6 },
+            { "http", 0.3 },
+            { "wss", 0.05 },
+            { "ftp", 0.05 } };
+
+    // weights of the host types
+    double reg_name = 0.85;
+    double ipv4 = 0.1;
+    double ipv6 = 0.05;
+
+    double userinfo = 0.02;
+    double port = 0.1;
+
+    std::size_t min_depth = 0;
+    std::size_t max_depth = 6;
+    std::size_t min_segment = 1;
+    std::size_t max_segment = 12;
+
+    std::size_t min_params = 0;
+    std::size_t max_params = 5;
+
+    // each char of a segment, key or
+    // value is percent-escaped
+    double escape = 0.02;
+
+    double fragment = 0.1;
+};
+
+// Make seeded corpora of absolute URLs.
+// The same seed and options make the same
+// URLs on every platform.
+class corpus
+{
+    rng r_;
+    corpus_options opt_;
+
+    void
+    chars(
+        std::string& s,
+        std::size_t n)
+    {
+        static char const cs[] =
+            "abcdefghijklmnopqrstuvwxyz"
+            "abcdefghijklmnopqrstuvwxyz"
+            "ABCDEFGHIJ0123456789-._~";
+        static char const hex[] =
+            "0123456789ABCDEF";
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            if(r_.chance(opt_.escape))
+            {
+                auto const c = r_();
+                s.push_back('%');
+                s.push_back(hex[c & 0xf]);
+                s.push_back(hex[(c >> 4) & 0xf]);
+                continue;
+            }
+            s.push_back(cs[r_.range(
+                0, sizeof(cs) - 2)]);
+        }
+    }
+
+    void
+    name(std::string& s)
+    {
+        static char const* const tld[] = {
+            "com", "org", "net", "io", "dev",
+            "co.uk", "de", "example" };
+        auto const labels = r_.range(1, 3);
+        for(std::size_t i = 0; i < labels; ++i)
+        {
+            auto const n = r_.range(2, 10);
+            for(std::size_t j = 0; j < n; ++j)
+                s.push_back(static_cast<char>(
+                    'a' + r_.range(0, 25)));
+            s.push_back('.');
+        }
+        s += tld[r_.range(0, 7)];
+    }
+
+    void
+    ipv4(std::string& s)
+    {
+        for(int i = 0; i < 4; ++i)
+        {
+            if(i)
+                s.push_back('.');
+            s += std::to_string(
+                r_.range(0, 255));
+        }
+    }
+
+    void
+    ipv6(std::string& s)
+    {
+        static char const hex[] =
+            "0123456789abcdef";
+        auto const group = [&]
+        {
+            auto v = r_() & 0xffff;
+            if(r_.chance(0.5))
+                v &= 0xff;
+            char b[4];
+            int n = 0;
+            do
+            {
+                b[n++] = hex[v & 0xf];
+                v >>= 4;
+            }
+            while(v);
+            while(n)
+                s.push_back(b[--n]);
+        };
+        s.push_back('[');
+        if(r_.chance(0.6))
+        {
+            // a:b::c:d
+            group();
+            s.push_back(':');
+            group();
+            s += "::";
+            group();
+            s.push_back(':');
+            group();
+        }
+        else
+        {
+            for(int i = 0; i < 8; ++i)
+            {
+                if(i)
+                    s.push_back(':');
+                group();
+            }
+        }
+        s.push_back(']');
+    }
+
+public:
+    explicit
+    corpus(
+        std::uint64_t seed,
+        corpus_options opt = {})
+        : r_(seed)
+        , opt_(std::move(opt))
+    {
+    }
+
+    // Return the next URL
+    std::string
+    next()
+    {
+        std::string s;
+
+        // scheme
+        double w = 0;
+        for(auto const& e : opt_.schemes)
+            w += e.second;
+        double x = (r_() >> 11) *
+            (w / 9007199254740992.0);
+        std::size_t i = 0;
+        while( i + 1 < opt_.schemes.size() &&
+            x >= opt_.schemes[i].second)
+            x -= opt_.schemes[i++].second;
+        s += opt_.schemes[i].first;
+        s += "://";
+
+        // authority
+        if(r_.chance(opt_.userinfo))
+        {
+            chars(s, r_.range(1, 8));
+            s.push_back(':');
+            chars(s, r_.range(1, 8));
+            s.push_back('@');
+        }
+        x = (r_() >> 11) * ((
+            opt_.reg_name + opt_.ipv4 +
+            opt_.ipv6) / 9007199254740992.0);
+        if(x < opt_.reg_name)
+            name(s);
+        else if(x < opt_.reg_name + opt_.ipv4)
+            ipv4(s);
+        else
+            ipv6(s);
+        if(r_.chance(opt_.port))
+        {
+            s.push_back(':');
+            s += std::to_string(
+                r_.range(1, 65535));
+        }
+
+        // path
+        auto const depth = r_.range(
+            opt_.min_depth, opt_.max_depth);
+        if(depth == 0)
+            s.push_back('/');
+        for(std::size_t j = 0; j < depth; ++j)
+        {
+            s.push_back('/');
+            chars(s, r_.range(
+                opt_.min_segment,
+                opt_.max_segment));
+        }
+
+        // query
+        auto const params = r_.range(
+            opt_.min_params, opt_.max_params);
+        for(std::size_t j = 0; j < params; ++j)
+        {
+            s.push_back(j ? '&' : '?');
+            chars(s, r_.range(1, 8));
+            s.push_back('=');
+            chars(s, r_.range(0, 12));
+        }
+
+        // fragment
+        if(r_.chance(opt_.fragment))
+        {
+            s.push_back('#');
+            chars(s, r_.range(1, 12));
+        }
+        return s;
+    }
+
+    // Return the next n URLs
+    std::vector<std::string>
+    make(std::size_t n)
+    {
+        std::vector<std::string> v;
+        v.reserve(n);
+        while(v.size() < n)
+            v.push_back(next());
+        return v;
+    }
+
+    // Write the next n URLs, one per line
+    void
+    write(
+        std::ostream& os,
+        std::size_t n)
+    {
+        while(n--)
+            os << next() << '\n';
+    }
+};
+
+} // bench
+
+#endif
@@ -12,23 +12,33 @@
 
 #include <boost/url/grammar.hpp>
 
+#include <boost/url/alloc_stats.hpp>
 #include <boost/url/authority_view.hpp>
+#include <boost/url/base_resolver.hpp>
+#include <boost/url/cidr_map.hpp>
+#include <boost/url/compiled_router.hpp>
 #include <boost/url/error.hpp>
 #include <boost/url/error_code.hpp>
+#include <boost/url/host_router.hpp>
 #include <boost/url/host_type.hpp>
 #include <boost/url/ipv4_address.hpp>
 #include <boost/url/ipv6_address.hpp>
 #include <boost/url/params.hpp>
 #include <boost/url/params_encoded.hpp>
 #include <boost/url/params_encoded_view.hpp>
+#include <boost/url/params_index.hpp>
 #include <boost/url/params_view.hpp>
+#include <boost/url/parse_stats.hpp>
 #include <boost/url/pct_encoding.hpp>
 #include <boost/url/pct_encoded_view.hpp>
 #include <boost/url/query_param.hpp>
+#include <boost/url/query_schema.hpp>
+#include <boost/url/router.hpp>
 #include <boost/url/scheme.hpp>
 #include <boost/url/segments.hpp>
 #include <boost/url/segments_encoded.hpp>
 #include <boost/url/segments_encoded_view.hpp>
+#include <boost/url/segments_index.hpp>
 #include <boost/url/segments_view.hpp>
 #include <boost/url/static_url.hpp>
 #include <boost/url/string_view.hpp>
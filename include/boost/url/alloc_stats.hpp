@@ -0,0 +1,120 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_ALLOC_STATS_HPP
+#define BOOST_URL_ALLOC_STATS_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace urls {
+
+/** Counters of the memory operations of containers
+
+    These counters describe the work done
+    by @ref url and @ref static_url to make
+    room for their characters, and by the
+    recycle bins of the grammar. Each thread
+    has its own counters, which only change
+    when the macro `BOOST_URL_ALLOC_STATS`
+    is defined, so that no counting is done
+    otherwise.
+
+    The counting is done by inline functions,
+    so the macro must be defined for the
+    library and for every translation unit
+    which includes its headers, for example
+    on the command line of the whole build.
+    Defining it in only some of them
+    violates the one definition rule.
+
+    @par Example
+    @code
+    url u( "https://www.example.com/index.htm" );
+    reset_thread_alloc_stats();
+    u.set_query( "page=2" );
+    assert( thread_alloc_stats().allocations == 0 );
+    @endcode
+
+    @see
+        @ref reset_thread_alloc_stats,
+        @ref thread_alloc_stats.
+*/
+struct alloc_stats
+{
+    /** Buffers allocated by a url
+    */
+    std::size_t allocations = 0;
+
+    /** Bytes allocated by a url, including null terminators
+    */
+    std::size_t bytes = 0;
+
+    /** Buffers freed by a url
+    */
+    std::size_t deallocations = 0;
+
+    /** Calls to reserve which needed more capacity
+
+        For a @ref static_url these calls
+        throw, and for a @ref url each one
+        allocates a buffer.
+    */
+    std::size_t growths = 0;
+
+    /** Bytes moved within a buffer to open or close a gap
+    */
+    std::size_t moved = 0;
+
+    /** Operations whose argument pointed into the buffer
+
+        The characters of these operations are
+        written past the end of the string, or
+        the old buffer is kept until the
+        operation is done, instead of being
+        copied first.
+    */
+    std::size_t aliased = 0;
+
+    /** Instances allocated by a recycle bin
+
+        These are the misses of every @ref
+        grammar::recycled bin, such as those
+        used by @ref grammar::range_rule.
+    */
+    std::size_t recycled_allocations = 0;
+
+    /** Bytes allocated by recycle bins
+    */
+    std::size_t recycled_bytes = 0;
+};
+
+/** Return the counters of the calling thread
+
+    @see
+        @ref alloc_stats.
+*/
+BOOST_URL_DECL
+alloc_stats
+thread_alloc_stats() noexcept;
+
+/** Set the counters of the calling thread to zero
+
+    @see
+        @ref alloc_stats.
+*/
+BOOST_URL_DECL
+void
+reset_thread_alloc_stats() noexcept;
+
+} // urls
+} // boost
+
+#endif
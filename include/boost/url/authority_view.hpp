@@ -90,6 +90,10 @@ class BOOST_SYMBOL_VISIBLE
     // VFALCO docca emits this erroneously
     friend struct detail::url_impl;
 #endif
+    template<class>
+    friend class cidr_map;
+    template<class>
+    friend class host_router;
 
     explicit
     authority_view(
@@ -1085,13 +1089,79 @@ operator<<(
         >3.2. Authority (rfc3986)</a>
 
     @see
-        @ref authority_view.
+        @ref authority_view,
+        @ref parse_host_port.
 */
 BOOST_URL_DECL
 result<authority_view>
 parse_authority(
     string_view s) noexcept;
 
+/** Parse a host and optional port
+
+    This function parses a string such as the
+    value of an HTTP Host header or the target
+    of a CONNECT request, which is an authority
+    without userinfo, and returns an
+    @ref authority_view referencing the string.
+    The result is the same as the result of
+    @ref parse_authority for any string without
+    userinfo. Strings with userinfo, or with
+    any char which cannot appear in a host or
+    port, are rejected.
+
+    Unlike @ref parse_authority, the kind of
+    host is chosen from the first char: a
+    '[' starts an IP-literal and a digit may
+    start an IPv4 address, while a registered
+    name and the port are found by scanning
+    the string once, sixteen chars at a time
+    where SSE2 is available. Ownership of the
+    string is not transferred; the caller is
+    responsible for ensuring that the lifetime
+    of the string extends until the view is no
+    longer being accessed.
+
+    @par Example
+    @code
+    authority_view a = parse_host_port( "www.example.com:8080" ).value();
+
+    assert( a.host() == "www.example.com" );
+    assert( a.port_number() == 8080 );
+    assert( ! parse_host_port( "user@www.example.com" ) );
+    @endcode
+
+    @par BNF
+    @code
+    host-port     = host [ ":" port ]
+
+    host          = IP-literal / IPv4address / reg-name
+
+    port          = *DIGIT
+    @endcode
+
+    @par Exception Safety
+    Throws nothing.
+
+    @return A view to the parsed authority
+
+    @param s The string to parse
+
+    @par Specification
+    @li <a href="https://datatracker.ietf.org/doc/html/rfc7230#section-5.4"
+        >5.4. Host (rfc7230)</a>
+    @li <a href="https://datatracker.ietf.org/doc/html/rfc7231#section-4.3.6"
+        >4.3.6. CONNECT (rfc7231)</a>
+
+    @see
+        @ref authority_view,
+        @ref parse_authority.
+*/
+BOOST_URL_DECL
+result<authority_view>
+parse_host_port(
+    string_view s) noexcept;
+
 //------------------------------------------------
 
 } // urls
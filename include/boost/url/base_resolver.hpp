@@ -0,0 +1,249 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_BASE_RESOLVER_HPP
+#define BOOST_URL_BASE_RESOLVER_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/string_view.hpp>
+#include <boost/url/url_base.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/url/detail/parts_base.hpp>
+#include <boost/url/detail/url_impl.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace urls {
+
+/** Resolves many references against one base URL
+
+    This object analyzes a base URL once,
+    and then resolves any number of URL
+    references against it, with the same
+    results as @ref resolve. The origin
+    of the base and the directory prefix
+    used to merge relative paths are
+    computed by the constructor, so that
+    each resolution only copies the
+    characters of the result.
+
+    The size of each result is known before
+    it is written, so the result can be
+    placed into a reused container such as
+    @ref static_url, or into a caller
+    provided buffer without allocating.
+
+    @par Example
+    @code
+    base_resolver r( parse_uri( "http://a/b/c/d;p?q" ).value() );
+
+    static_url< 1024 > dest;
+    r.resolve( parse_uri_reference( "../g" ).value(), dest );
+    assert( dest.string() == "http://a/b/g" );
+
+    char buf[ 1024 ];
+    url_view v = r.resolve( parse_uri_reference( "g?y" ).value(), buf, sizeof(buf) );
+    assert( v.string() == "http://a/b/c/g?y" );
+    @endcode
+
+    @par Lifetime
+    The resolver references the characters
+    of the base URL. Ownership is not
+    transferred; the caller is responsible
+    for ensuring that the base outlives
+    the resolver.
+
+    @par Specification
+    <a href="https://datatracker.ietf.org/doc/html/rfc3986#section-5"
+        >5. Reference Resolution (rfc3986)</a>
+
+    @see
+        @ref resolve.
+*/
+class base_resolver
+    : private detail::parts_base
+{
+    detail::url_impl u_;
+
+    // end of the merged-path
+    // directory prefix in u_
+    std::size_t dir_;
+
+    // number of '/' in the prefix,
+    // not counting a leading one
+    std::size_t dir_slashes_;
+
+    // decoded size of the prefix
+    std::size_t dir_decoded_;
+
+    BOOST_URL_DECL
+    std::size_t
+    write(
+        url_view_base const& ref,
+        char* dest,
+        detail::url_impl& u) const noexcept;
+
+public:
+    /** Constructor
+
+        This function analyzes the base URL.
+        The base must satisfy the
+        <em>absolute-URI</em> grammar, or
+        else an exception is thrown.
+
+        @par BNF
+        @code
+        absolute-URI  = scheme ":" hier-part [ "?" query ]
+        @endcode
+
+        @throw std::invalid_argument `base` has no scheme.
+
+        @param base The URL to resolve against.
+    */
+    BOOST_URL_DECL
+    explicit
+    base_resolver(
+        url_view_base const& base);
+
+    /** Return the base URL
+    */
+    url_view
+    base() const noexcept
+    {
+        return u_.construct();
+    }
+
+    /** Return the origin of the base URL
+
+        This is the scheme and authority
+        which every reference without a
+        scheme of its own resolves to.
+
+        @par Example
+        @code
+        assert( base_resolver( url_view( "http://www.example.com:8080/index.htm?text=none#h1" ) ).encoded_origin() == "http://www.example.com:8080" );
+        @endcode
+    */
+    string_view
+    encoded_origin() const noexcept
+    {
+        return u_.get(id_scheme, id_path);
+    }
+
+    /** Return the directory of the base path
+
+        This is the prefix of the base path
+        which is merged with relative-path
+        references, up to and including the
+        last slash.
+
+        @par Example
+        @code
+        assert( base_resolver( url_view( "http://a/b/c/d;p?q" ) ).encoded_directory() == "/b/c/" );
+        @endcode
+
+        @par Specification
+        <a href="https://datatracker.ietf.org/doc/html/rfc3986#section-5.2.3"
+            >5.2.3. Merge Paths (rfc3986)</a>
+    */
+    string_view
+    encoded_directory() const noexcept
+    {
+        if( u_.len(id_user) > 0 &&
+            u_.len(id_path) == 0)
+            return "/";
+        return string_view(
+            u_.cs_ + u_.offset(id_path),
+            dir_ - u_.offset(id_path));
+    }
+
+    /** Return the size of a resolved reference
+
+        This function returns the number of
+        characters needed to hold the result
+        of resolving `ref`, not including a
+        null terminator. It is exact unless
+        the result contains dot segments,
+        whose removal can only make the
+        result smaller.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param ref The URL reference to resolve.
+    */
+    BOOST_URL_DECL
+    std::size_t
+    resolved_size(
+        url_view_base const& ref) const noexcept;
+
+    /** Resolve a reference into a container
+
+        The result of resolving `ref` against
+        the base replaces the contents of
+        `dest`. The capacity of `dest` is
+        reserved once, before the result is
+        written. A @ref static_url or a
+        @ref url with enough capacity never
+        allocates.
+
+        @par Exception Safety
+        Basic guarantee.
+        Calls to allocate may throw.
+
+        @throw std::bad_alloc `dest` is
+        a static URL with insufficient capacity.
+
+        @param ref The URL reference to resolve.
+
+        @param dest The container for the result,
+        which must not be `ref` or the base.
+    */
+    BOOST_URL_DECL
+    void
+    resolve(
+        url_view_base const& ref,
+        url_base& dest) const;
+
+    /** Resolve a reference into a buffer
+
+        The result of resolving `ref` against
+        the base is written to the caller
+        provided buffer, and a view of the
+        result is returned. No null terminator
+        is written. The buffer may come from
+        an arena or the stack.
+
+        @par Exception Safety
+        Strong guarantee.
+
+        @throw std::length_error `size` is less
+        than @ref resolved_size.
+
+        @return A view of the result, which
+        references the characters in `dest`.
+
+        @param ref The URL reference to resolve.
+
+        @param dest A pointer to the buffer.
+
+        @param size The size of the buffer.
+    */
+    BOOST_URL_DECL
+    url_view
+    resolve(
+        url_view_base const& ref,
+        char* dest,
+        std::size_t size) const;
+};
+
+} // urls
+} // boost
+
+#endif
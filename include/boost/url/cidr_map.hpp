@@ -0,0 +1,285 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_CIDR_MAP_HPP
+#define BOOST_URL_CIDR_MAP_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/authority_view.hpp>
+#include <boost/url/ipv4_address.hpp>
+#include <boost/url/ipv6_address.hpp>
+#include <boost/url/string_view.hpp>
+#include <boost/url/url_view_base.hpp>
+#include <boost/url/detail/cidr_trie.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+/** A map from IP address prefixes to values
+
+    Prefixes are written in CIDR notation,
+    as an IPv4 or IPv6 address followed by
+    a slash and the number of leading bits
+    which are matched, such as "10.0.0.0/8"
+    or "2001:db8::/32". An address without
+    a length is a prefix of all its bits.
+
+    An address is matched by the longest
+    prefix which contains it. IPv4-mapped
+    IPv6 addresses such as "::ffff:10.0.0.1"
+    are matched by the IPv4 prefixes first,
+    then by the IPv6 prefixes, so that a
+    list of IPv4 ranges also applies to the
+    IPv6 spelling of the same addresses.
+
+    The prefixes are held in a multibit trie
+    of four bits per level, where each node
+    is one cache line. A lookup reads one
+    node per level until the longest prefix
+    is found, without parsing: the hosts of
+    URLs and authorities are matched with
+    the address bytes stored when they were
+    parsed. Hosts which are registered names
+    have no match; they must be resolved
+    before they can be checked.
+
+    @par Example
+    @code
+    cidr_map< bool > allow;
+    allow.insert_list(
+        "0.0.0.0/0 ::/0", true );
+    allow.insert_list(
+        "10.0.0.0/8 127.0.0.0/8 "
+        "169.254.0.0/16 ::1 fc00::/7", false );
+
+    url_view u( "http://[::ffff:127.0.0.1]/admin" );
+    bool const* v = allow.find( u );
+
+    assert( v && ! *v );
+    @endcode
+
+    @tparam T The type of value held for
+    each prefix.
+
+    @see
+        @ref host_router.
+*/
+template<class T>
+class cidr_map
+{
+    // not std::vector<bool>, which
+    // has no pointers to elements
+    struct item
+    {
+        T value;
+    };
+
+    detail::cidr_trie impl_;
+    std::vector<item> v_;
+
+public:
+    /** The type of value held for each prefix
+    */
+    using value_type = T;
+
+    /** Constructor
+
+        Default constructed maps have
+        no prefixes.
+    */
+    cidr_map() = default;
+
+    /** Return the number of prefixes
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return impl_.size();
+    }
+
+    /** Return true if there are no prefixes
+    */
+    bool
+    empty() const noexcept
+    {
+        return impl_.size() == 0;
+    }
+
+    /** Add a prefix
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @throw std::invalid_argument The
+        prefix is malformed, has bits set
+        after its length, or is already
+        in the map.
+
+        @param prefix The prefix, in CIDR
+        notation.
+
+        @param value The value of the prefix.
+    */
+    void
+    insert(
+        string_view prefix,
+        T value);
+
+    /** Add a prefix
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @throw std::invalid_argument `len`
+        is greater than 32, `addr` has bits
+        set after `len`, or the prefix is
+        already in the map.
+
+        @param addr The address.
+
+        @param len The number of leading
+        bits of `addr` which are matched.
+
+        @param value The value of the prefix.
+    */
+    void
+    insert(
+        ipv4_address const& addr,
+        unsigned len,
+        T value);
+
+    /** Add a prefix
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @throw std::invalid_argument `len`
+        is greater than 128, `addr` has bits
+        set after `len`, or the prefix is
+        already in the map.
+
+        @param addr The address.
+
+        @param len The number of leading
+        bits of `addr` which are matched.
+
+        @param value The value of the prefix.
+    */
+    void
+    insert(
+        ipv6_address const& addr,
+        unsigned len,
+        T value);
+
+    /** Add the prefixes of a list
+
+        This function adds each prefix of a
+        list, in CIDR notation, all of which
+        share one copy of `value`. Prefixes
+        are separated by whitespace or commas,
+        and a '#' starts a comment which ends
+        at the end of the line, as in:
+
+        @code
+        # loopback
+        127.0.0.0/8, ::1
+        10.0.0.0/8       # private
+        @endcode
+
+        @par Complexity
+        Linear in the size of the list and
+        in the size of the map.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @throw std::invalid_argument A prefix
+        is malformed, has bits set after its
+        length, or is already in the map.
+
+        @return The number of prefixes added.
+
+        @param list The list of prefixes.
+
+        @param value The value of the prefixes.
+    */
+    std::size_t
+    insert_list(
+        string_view list,
+        T value);
+
+    /** Return the value of the longest prefix matching an address
+
+        @par Complexity
+        Linear in the length of the prefix.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param addr The address to match.
+    */
+    T const*
+    find(ipv4_address const& addr) const noexcept;
+
+    /// @copydoc find(ipv4_address const&) const
+    T const*
+    find(ipv6_address const& addr) const noexcept;
+
+    /** Return the value of the longest prefix matching a host
+
+        This function returns a pointer to the
+        value of the longest prefix which
+        matches the host of `u`, or null if
+        the host is not an IPv4 or IPv6
+        address, or no prefix matches.
+
+        @par Complexity
+        Linear in the length of the prefix.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param u The URL whose host is matched.
+    */
+    T const*
+    find(url_view_base const& u) const noexcept;
+
+    /** Return the value of the longest prefix matching a host
+
+        This function returns a pointer to the
+        value of the longest prefix which
+        matches the host of `a`, or null if
+        the host is not an IPv4 or IPv6
+        address, or no prefix matches.
+
+        @par Complexity
+        Linear in the length of the prefix.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param a The authority whose host
+        is matched.
+    */
+    T const*
+    find(authority_view const& a) const noexcept;
+};
+
+} // urls
+} // boost
+
+#include <boost/url/impl/cidr_map.hpp>
+
+#endif
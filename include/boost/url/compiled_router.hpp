@@ -0,0 +1,149 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_COMPILED_ROUTER_HPP
+#define BOOST_URL_COMPILED_ROUTER_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/router.hpp>
+#include <boost/url/string_view.hpp>
+#include <boost/url/detail/route_dfa.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+/** A router compiled to a deterministic automaton
+
+    This container holds the routes of a
+    @ref router compiled into jump tables
+    over the characters of an encoded path.
+    A path is matched with one scan of its
+    characters, decoding escapes as they
+    are read, with no backtracking and
+    without constructing the segments.
+    The route found and the params captured
+    are the same as those of the router it
+    was compiled from.
+
+    Compiling takes time and memory which
+    grow with the number of routes whose
+    params overlap with literals at the same
+    positions, so objects of this type are
+    meant to be constructed once, at startup,
+    and used for many paths.
+
+    @par Example
+    @code
+    router< int > r;
+    r.insert( "/api/users", 1 );
+    r.insert( "/api/users/{id}", 2 );
+
+    compiled_router< int > const cr( r );
+
+    url_view u( "/api/users/42" );
+    route_match m;
+    int const* v = cr.find( u.encoded_path(), m );
+
+    assert( v && *v == 2 );
+    assert( m.at( "id" ) == "42" );
+    @endcode
+
+    @tparam T The type of value held for
+    each route.
+
+    @see
+        @ref route_match,
+        @ref router.
+*/
+template<class T>
+class compiled_router
+{
+    detail::route_dfa impl_;
+    std::vector<T> v_;
+
+public:
+    /** The type of value held for each route
+    */
+    using value_type = T;
+
+    /** Constructor
+
+        The routes and values of `r` are
+        copied into the new object.
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @param r The router to compile.
+    */
+    explicit
+    compiled_router(
+        router<T> const& r);
+
+    /** Return the number of routes
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return v_.size();
+    }
+
+    /** Return the number of states of the automaton
+    */
+    std::size_t
+    states() const noexcept
+    {
+        return impl_.states();
+    }
+
+    /** Return the value of the route matching a path
+
+        This function returns a pointer to the
+        value of the route which matches the
+        encoded path `path`, or null. On a
+        match, `m` holds the captured params,
+        which reference the characters of
+        `path`.
+
+        @par Preconditions
+        `path` is a valid encoded path, such
+        as the one returned by
+        @ref url_view_base::encoded_path.
+
+        @par Complexity
+        Linear in `path.size()`.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param path The encoded path to match.
+
+        @param m The captured params.
+    */
+    T const*
+    find(
+        string_view path,
+        route_match& m) const noexcept;
+
+    /// @copydoc find
+    T*
+    find(
+        string_view path,
+        route_match& m) noexcept;
+};
+
+} // urls
+} // boost
+
+#include <boost/url/impl/compiled_router.hpp>
+
+#endif
@@ -0,0 +1,101 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_DETAIL_ALLOC_STATS_HPP
+#define BOOST_URL_DETAIL_ALLOC_STATS_HPP
+
+#include <boost/url/alloc_stats.hpp>
+#include <cstring>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+// The counters are only touched when
+// BOOST_URL_ALLOC_STATS is defined, and
+// each of these is empty otherwise. The
+// macro must be the same in the library
+// and in every file which includes it.
+
+BOOST_URL_DECL
+alloc_stats&
+thread_alloc_stats_ref() noexcept;
+
+inline
+void
+count_allocate(std::size_t n) noexcept
+{
+#ifdef BOOST_URL_ALLOC_STATS
+    auto& st = thread_alloc_stats_ref();
+    ++st.allocations;
+    st.bytes += n;
+#else
+    (void)n;
+#endif
+}
+
+inline
+void
+count_deallocate() noexcept
+{
+#ifdef BOOST_URL_ALLOC_STATS
+    ++thread_alloc_stats_ref().deallocations;
+#endif
+}
+
+inline
+void
+count_growth() noexcept
+{
+#ifdef BOOST_URL_ALLOC_STATS
+    ++thread_alloc_stats_ref().growths;
+#endif
+}
+
+inline
+void
+count_aliased() noexcept
+{
+#ifdef BOOST_URL_ALLOC_STATS
+    ++thread_alloc_stats_ref().aliased;
+#endif
+}
+
+inline
+void
+count_recycled(std::size_t n) noexcept
+{
+#ifdef BOOST_URL_ALLOC_STATS
+    auto& st = thread_alloc_stats_ref();
+    ++st.recycled_allocations;
+    st.recycled_bytes += n;
+#else
+    (void)n;
+#endif
+}
+
+// memmove, counting the bytes
+inline
+void
+move_chars(
+    char* dest,
+    char const* src,
+    std::size_t n) noexcept
+{
+#ifdef BOOST_URL_ALLOC_STATS
+    thread_alloc_stats_ref().moved += n;
+#endif
+    std::memmove(dest, src, n);
+}
+
+} // detail
+} // urls
+} // boost
+
+#endif
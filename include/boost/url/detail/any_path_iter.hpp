@@ -38,6 +38,14 @@ struct BOOST_SYMBOL_VISIBLE
     copy(
         char*& dest,
         char const* end) noexcept = 0;
+    // called before the first copy when
+    // the chars were moved by d. Ranges
+    // of strings read them through the
+    // range, so this does nothing.
+    BOOST_URL_DECL
+    virtual
+    void
+    rebase(std::ptrdiff_t d) noexcept;
 };
 
 //------------------------------------------------
@@ -69,6 +77,8 @@ public:
     copy(
         char*& dest,
         char const* end) noexcept override;
+    void
+    rebase(std::ptrdiff_t d) noexcept override;
 };
 
 //------------------------------------------------
@@ -100,6 +110,8 @@ public:
     copy(
         char*& dest,
         char const* end) noexcept override;
+    void
+    rebase(std::ptrdiff_t d) noexcept override;
 };
 
 //------------------------------------------------
@@ -110,6 +122,7 @@ class BOOST_SYMBOL_VISIBLE
     view_path_iter :
     public any_path_iter
 {
+    pct_encoded_view s_;
     std::size_t n_;
     pct_encoded_view::const_iterator p_;
     pct_encoded_view::const_iterator end_;
@@ -132,6 +145,8 @@ public:
     copy(
         char*& dest,
         char const* end) noexcept override;
+    void
+    rebase(std::ptrdiff_t d) noexcept override;
 };
 
 //------------------------------------------------
@@ -37,6 +37,14 @@ struct BOOST_SYMBOL_VISIBLE
     copy(
         char*& dest,
         char const* end) noexcept = 0;
+    // called before the first copy when
+    // the chars were moved by d. Ranges
+    // of strings read them through the
+    // range, so this does nothing.
+    BOOST_URL_DECL
+    virtual
+    void
+    rebase(std::ptrdiff_t d) noexcept;
 };
 
 //------------------------------------------------
@@ -67,6 +75,8 @@ public:
     copy(
         char*& dest,
         char const* end) noexcept override;
+    void
+    rebase(std::ptrdiff_t d) noexcept override;
 };
 
 //------------------------------------------------
@@ -97,6 +107,8 @@ public:
     copy(
         char*& dest,
         char const* end) noexcept override;
+    void
+    rebase(std::ptrdiff_t d) noexcept override;
 };
 
 //------------------------------------------------
@@ -104,6 +116,7 @@ public:
 class view_query_iter
     : public any_query_iter
 {
+    pct_encoded_view s_;
     pct_encoded_view::const_iterator p_;
     pct_encoded_view::const_iterator end_;
     std::size_t n_;
@@ -126,6 +139,8 @@ public:
     copy(
         char*& dest,
         char const* end) noexcept override;
+    void
+    rebase(std::ptrdiff_t d) noexcept override;
 };
 
 //------------------------------------------------
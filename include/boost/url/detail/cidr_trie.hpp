@@ -0,0 +1,155 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_DETAIL_CIDR_TRIE_HPP
+#define BOOST_URL_DETAIL_CIDR_TRIE_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/string_view.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+struct url_impl;
+
+// Multibit trie of IPv4 and IPv6 prefixes,
+// four bits per level. A node is sixteen
+// 32-bit entries, one cache line, each of
+// which is a child node or the route id of
+// the longest prefix covering it, pushed
+// down into the children when they are
+// made. A lookup reads one entry per level
+// and stops at the first which is not a
+// child.
+class cidr_trie
+{
+    static
+    constexpr
+    std::size_t
+    npos = string_view::npos;
+
+    // entries: 0 when no prefix covers
+    // it, child | node, or route id + 1
+    static
+    constexpr
+    std::uint32_t
+    child = 0x80000000;
+
+    struct tree
+    {
+        // sixteen entries per node,
+        // the root is node 0
+        std::vector<std::uint32_t> t;
+
+        // length of the prefix covering
+        // each entry, used by insert
+        std::vector<unsigned char> len;
+
+        // route id + 1 of the prefix
+        // covering each entry, which
+        // for a child is pushed down
+        std::vector<std::uint32_t> id;
+
+        // bit r is set when a prefix with
+        // r bits in the node starts at the
+        // entry, to find duplicates
+        std::vector<unsigned char> own;
+    };
+
+    tree v4_;
+    tree v6_;
+
+    // number of prefixes
+    std::size_t n_ = 0;
+
+    static
+    std::size_t
+    find(
+        tree const& tr,
+        unsigned char const* addr) noexcept;
+
+    static
+    void
+    insert(
+        tree& tr,
+        unsigned char const* addr,
+        unsigned bits,
+        std::size_t id);
+
+public:
+    // Parse "address/length" or an address,
+    // which is a full length prefix. Sets
+    // addr to 4 or 16 bytes. Returns false
+    // if malformed.
+    BOOST_URL_DECL
+    static
+    bool
+    parse(
+        string_view s,
+        bool& v6,
+        unsigned char* addr,
+        unsigned& bits) noexcept;
+
+    // Add a prefix for route id. Throws
+    // if the prefix has bits set after
+    // its length or is in the trie.
+    BOOST_URL_DECL
+    void
+    insert(
+        bool v6,
+        unsigned char const* addr,
+        unsigned bits,
+        std::size_t id);
+
+    // Add each prefix of a list for route
+    // id and return how many. On error the
+    // trie is unchanged.
+    BOOST_URL_DECL
+    std::size_t
+    insert_list(
+        string_view list,
+        std::size_t id);
+
+    std::size_t
+    size() const noexcept
+    {
+        return n_;
+    }
+
+    // Return the id of the longest
+    // prefix matching an address, or npos
+    BOOST_URL_DECL
+    std::size_t
+    find_v4(
+        unsigned char const* addr) const noexcept;
+
+    // IPv4-mapped addresses are looked up
+    // in the IPv4 prefixes, then in the
+    // IPv6 prefixes
+    BOOST_URL_DECL
+    std::size_t
+    find_v6(
+        unsigned char const* addr) const noexcept;
+
+    // Return the id of the longest prefix
+    // matching an address host, or npos
+    BOOST_URL_DECL
+    std::size_t
+    find(url_impl const& u) const noexcept;
+};
+
+} // detail
+} // urls
+} // boost
+
+#endif
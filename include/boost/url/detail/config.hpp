@@ -71,6 +71,23 @@
     return ::boost::system::error_code((ev), &loc ## __LINE__)
 #endif
 
+// Errors which a rule returns on a failed
+// trial, such as mismatch and need_more,
+// are usually discarded by the combinator
+// which made the trial. They carry no
+// source location unless
+// BOOST_URL_TRIAL_SOURCE_LOCATION is
+// defined, and grammar::parse adds its own
+// location when one escapes to the caller.
+#if defined(BOOST_URL_NO_SOURCE_LOCATION) || \
+    ! defined(BOOST_URL_TRIAL_SOURCE_LOCATION)
+# define BOOST_URL_TRIAL_ERR(ev) (ev)
+# define BOOST_URL_RETURN_TRIAL_EC(ev) return (ev)
+#else
+# define BOOST_URL_TRIAL_ERR(ev) BOOST_URL_ERR(ev)
+# define BOOST_URL_RETURN_TRIAL_EC(ev) BOOST_URL_RETURN_EC(ev)
+#endif
+
 // detect 32/64 bit
 #if UINTPTR_MAX == UINT64_MAX
 # define BOOST_URL_ARCH 64
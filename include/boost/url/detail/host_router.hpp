@@ -0,0 +1,116 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_DETAIL_HOST_ROUTER_HPP
+#define BOOST_URL_DETAIL_HOST_ROUTER_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/host_type.hpp>
+#include <boost/url/string_view.hpp>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+struct url_impl;
+
+// Open addressing table of host patterns,
+// keyed by the hash of the decoded and
+// lowercase name or by the address bytes
+class host_router_base
+{
+    static
+    constexpr
+    std::size_t
+    npos = string_view::npos;
+
+    enum class kind : unsigned char
+    {
+        name,
+        suffix,
+        ipv4,
+        ipv6,
+        ipvfuture
+    };
+
+    struct entry
+    {
+        std::size_t hash;
+        kind k;
+
+        // encoded name, or the
+        // part after "*." of a suffix
+        std::string name;
+
+        unsigned char addr[16];
+
+        // route id
+        std::size_t id;
+    };
+
+    std::vector<entry> v_;
+
+    // indexes into v_, npos when empty
+    std::vector<std::size_t> t_;
+
+    // number of suffix entries
+    std::size_t nsuffix_ = 0;
+
+    // route id of "*"
+    std::size_t any_ = npos;
+
+    BOOST_URL_DECL
+    static
+    std::size_t
+    hash_name(
+        kind k,
+        string_view s) noexcept;
+
+    BOOST_URL_DECL
+    static
+    std::size_t
+    hash_addr(
+        kind k,
+        unsigned char const* addr) noexcept;
+
+    // Return the entry matching
+    // the key, or nullptr
+    entry const*
+    probe(
+        std::size_t h,
+        kind k,
+        string_view name,
+        unsigned char const* addr) const noexcept;
+
+    void
+    rehash(std::size_t n);
+
+public:
+    // Add a host pattern for route id
+    BOOST_URL_DECL
+    void
+    insert(
+        string_view host,
+        std::size_t id);
+
+    // Return the id of the route
+    // matching the host, or npos
+    BOOST_URL_DECL
+    std::size_t
+    find(url_impl const& u) const noexcept;
+};
+
+} // detail
+} // urls
+} // boost
+
+#endif
@@ -11,6 +11,7 @@
 #define BOOST_URL_DETAIL_IMPL_ANY_PATH_ITER_IPP
 
 #include <boost/url/detail/any_path_iter.hpp>
+#include <boost/url/pct_encoded_view.hpp>
 #include <boost/url/string_view.hpp>
 #include <boost/url/pct_encoding.hpp>
 #include <boost/url/rfc/pchars.hpp>
@@ -22,6 +23,12 @@ namespace detail {
 any_path_iter::
 ~any_path_iter() noexcept = default;
 
+void
+any_path_iter::
+rebase(std::ptrdiff_t) noexcept
+{
+}
+
 //------------------------------------------------
 
 void
@@ -84,6 +91,17 @@ measure(
     return true;
 }
 
+void
+enc_path_iter::
+rebase(std::ptrdiff_t d) noexcept
+{
+    if(! p_)
+        return;
+    p_ += d;
+    end_ += d;
+    front = { p_, n_ };
+}
+
 void
 enc_path_iter::
 copy(
@@ -163,6 +181,17 @@ measure(
     return true;
 }
 
+void
+plain_path_iter::
+rebase(std::ptrdiff_t d) noexcept
+{
+    if(! p_)
+        return;
+    p_ += d;
+    end_ += d;
+    front = { p_, n_ };
+}
+
 void
 plain_path_iter::
 copy(
@@ -205,7 +234,8 @@ increment() noexcept
 view_path_iter::
 view_path_iter(
     pct_encoded_view s) noexcept
-    : n_(0)
+    : s_(s)
+    , n_(0)
     , end_(s.end())
 {
     if(s.empty())
@@ -243,6 +273,15 @@ measure(
     return true;
 }
 
+void
+view_path_iter::
+rebase(std::ptrdiff_t d) noexcept
+{
+    // nothing was read yet
+    *this = view_path_iter(
+        access::rebase(s_, d));
+}
+
 void
 view_path_iter::
 copy(
@@ -11,6 +11,7 @@
 #define BOOST_URL_DETAIL_IMPL_ANY_QUERY_ITER_IPP
 
 #include <boost/url/detail/any_query_iter.hpp>
+#include <boost/url/pct_encoded_view.hpp>
 #include <boost/url/string_view.hpp>
 #include <boost/url/rfc/detail/charsets.hpp>
 
@@ -21,6 +22,12 @@ namespace detail {
 any_query_iter::
 ~any_query_iter() noexcept = default;
 
+void
+any_query_iter::
+rebase(std::ptrdiff_t) noexcept
+{
+}
+
 //------------------------------------------------
 
 void
@@ -80,6 +87,16 @@ measure(
     return true;
 }
 
+void
+enc_query_iter::
+rebase(std::ptrdiff_t d) noexcept
+{
+    if(! p_)
+        return;
+    p_ += d;
+    end_ += d;
+}
+
 void
 enc_query_iter::
 copy(
@@ -156,6 +173,16 @@ measure(
     return true;
 }
 
+void
+plain_query_iter::
+rebase(std::ptrdiff_t d) noexcept
+{
+    if(! p_)
+        return;
+    p_ += d;
+    end_ += d;
+}
+
 void
 plain_query_iter::
 copy(
@@ -197,7 +224,8 @@ increment() noexcept
 view_query_iter::
 view_query_iter(
     pct_encoded_view s) noexcept
-    : end_(s.end())
+    : s_(s)
+    , end_(s.end())
     , n_(0)
 {
     if(s.empty())
@@ -233,6 +261,15 @@ measure(
     return true;
 }
 
+void
+view_query_iter::
+rebase(std::ptrdiff_t d) noexcept
+{
+    // nothing was read yet
+    *this = view_query_iter(
+        access::rebase(s_, d));
+}
+
 void
 view_query_iter::
 copy(
@@ -0,0 +1,370 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_DETAIL_IMPL_CIDR_TRIE_IPP
+#define BOOST_URL_DETAIL_IMPL_CIDR_TRIE_IPP
+
+#include <boost/url/detail/cidr_trie.hpp>
+#include <boost/url/detail/except.hpp>
+#include <boost/url/detail/ipv4.hpp>
+#include <boost/url/detail/ipv6.hpp>
+#include <boost/url/detail/url_impl.hpp>
+#include <utility>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+constexpr std::size_t cidr_trie::npos;
+constexpr std::uint32_t cidr_trie::child;
+
+namespace {
+
+// nibble i of an address,
+// most significant first
+inline
+unsigned
+cidr_nibble(
+    unsigned char const* addr,
+    unsigned i) noexcept
+{
+    return (addr[i / 2] >>
+        (4 * (~i & 1))) & 0xf;
+}
+
+// Cover entry i with a prefix of the
+// given length, unless a longer one
+// covers it, and push it down into
+// the children
+void
+cidr_cover(
+    std::vector<std::uint32_t>& t,
+    std::vector<unsigned char>& len,
+    std::vector<std::uint32_t>& id,
+    std::size_t i,
+    unsigned bits,
+    std::uint32_t v) noexcept
+{
+    if( id[i] != 0 &&
+        len[i] > bits)
+        return;
+    len[i] = static_cast<
+        unsigned char>(bits);
+    id[i] = v;
+    if(t[i] & 0x80000000)
+    {
+        std::size_t const c =
+            16 * (t[i] & 0x7fffffff);
+        for(std::size_t j = 0; j < 16; ++j)
+            cidr_cover(t, len, id,
+                c + j, bits, v);
+        return;
+    }
+    t[i] = v;
+}
+
+bool
+cidr_is_sep(char c) noexcept
+{
+    return
+        c == ' ' || c == '\t' ||
+        c == '\r' || c == '\n' ||
+        c == ',';
+}
+
+} // (anon)
+
+std::size_t
+cidr_trie::
+find(
+    tree const& tr,
+    unsigned char const* addr) noexcept
+{
+    if(tr.t.empty())
+        return npos;
+    std::uint32_t const* const t =
+        tr.t.data();
+    std::uint32_t e = t[addr[0] >> 4];
+    unsigned i = 1;
+    while(e & child)
+    {
+        e = t[16 * (e & ~child) +
+            cidr_nibble(addr, i)];
+        ++i;
+    }
+    if(e == 0)
+        return npos;
+    return e - 1;
+}
+
+void
+cidr_trie::
+insert(
+    tree& tr,
+    unsigned char const* addr,
+    unsigned bits,
+    std::size_t id)
+{
+    if(id >= child - 1)
+        throw_length_error(
+            "too many prefixes");
+    std::uint32_t const v =
+        static_cast<std::uint32_t>(id + 1);
+    if(tr.t.empty())
+    {
+        tr.t.resize(16);
+        tr.len.resize(16);
+        tr.id.resize(16);
+        tr.own.resize(16);
+    }
+
+    // Find the node of the last nibble,
+    // making children which are covered
+    // as their parent entry. These hold
+    // the same routes if we throw later.
+    std::size_t node = 0;
+    unsigned depth = 0;
+    while(bits > 4 * depth + 4)
+    {
+        std::size_t const i =
+            16 * node + cidr_nibble(addr, depth);
+        if(! (tr.t[i] & child))
+        {
+            std::size_t const n =
+                tr.t.size() + 16;
+            if(n > tr.t.capacity())
+            {
+                tr.t.reserve(2 * n);
+                tr.len.reserve(2 * n);
+                tr.id.reserve(2 * n);
+                tr.own.reserve(2 * n);
+            }
+            std::uint32_t const e = tr.t[i];
+            unsigned char const l = tr.len[i];
+            std::uint32_t const d = tr.id[i];
+            tr.t.resize(n, e);
+            tr.len.resize(n, l);
+            tr.id.resize(n, d);
+            tr.own.resize(n);
+            tr.t[i] = child | static_cast<
+                std::uint32_t>(n / 16 - 1);
+        }
+        node = tr.t[i] & ~child;
+        ++depth;
+    }
+
+    // The prefix covers the entries
+    // which share its remaining bits
+    unsigned const r = bits - 4 * depth;
+    std::size_t const first =
+        16 * node + (cidr_nibble(addr, depth) &
+            ~((1u << (4 - r)) - 1));
+    std::size_t const last =
+        first + (std::size_t(1) << (4 - r));
+    if(tr.own[first] & (1u << r))
+        throw_invalid_argument(
+            "duplicate prefix");
+    tr.own[first] = static_cast<
+        unsigned char>(tr.own[first] |
+            (1u << r));
+    for(std::size_t i = first; i < last; ++i)
+        cidr_cover(tr.t, tr.len, tr.id,
+            i, bits, v);
+}
+
+bool
+cidr_trie::
+parse(
+    string_view s,
+    bool& v6,
+    unsigned char* addr,
+    unsigned& bits) noexcept
+{
+    std::size_t const slash =
+        s.find('/');
+    string_view const a =
+        s.substr(0, slash);
+    char const* it = a.data();
+    char const* const end =
+        it + a.size();
+    grammar::error ev;
+    v6 = a.find(':') != npos;
+    if(v6)
+    {
+        if( ! parse_ipv6(it, end, addr, ev) ||
+            it != end)
+            return false;
+        bits = 128;
+    }
+    else
+    {
+        std::uint32_t u;
+        if( ! parse_ipv4(it, end, u, ev) ||
+            it != end)
+            return false;
+        addr[0] = static_cast<
+            unsigned char>(u >> 24);
+        addr[1] = static_cast<
+            unsigned char>(u >> 16);
+        addr[2] = static_cast<
+            unsigned char>(u >> 8);
+        addr[3] = static_cast<
+            unsigned char>(u);
+        bits = 32;
+    }
+    if(slash == npos)
+        return true;
+
+    // decimal length, without
+    // leading zeroes
+    string_view const n =
+        s.substr(slash + 1);
+    if( n.empty() ||
+        n.size() > 3 ||
+        (n[0] == '0' && n.size() > 1))
+        return false;
+    unsigned b = 0;
+    for(char c : n)
+    {
+        if(c < '0' || c > '9')
+            return false;
+        b = 10 * b + (c - '0');
+    }
+    if(b > bits)
+        return false;
+    bits = b;
+    return true;
+}
+
+void
+cidr_trie::
+insert(
+    bool v6,
+    unsigned char const* addr,
+    unsigned bits,
+    std::size_t id)
+{
+    unsigned const n = v6 ? 16 : 4;
+    if(bits > 8 * n)
+        throw_invalid_argument(
+            "bad prefix");
+    // no bits after the length
+    for(unsigned i = 0; i < n; ++i)
+    {
+        unsigned const keep =
+            bits >= 8 * i + 8 ? 8 :
+            bits > 8 * i ? bits - 8 * i : 0;
+        if(addr[i] & (0xff >> keep))
+            throw_invalid_argument(
+                "bad prefix");
+    }
+    insert(v6 ? v6_ : v4_,
+        addr, bits, id);
+    ++n_;
+}
+
+std::size_t
+cidr_trie::
+insert_list(
+    string_view list,
+    std::size_t id)
+{
+    // insert into a copy, for
+    // the strong guarantee
+    cidr_trie tmp(*this);
+    std::size_t n = 0;
+    char const* it = list.data();
+    char const* const end =
+        it + list.size();
+    while(it != end)
+    {
+        if(*it == '#')
+        {
+            // comment
+            while( it != end &&
+                *it != '\n')
+                ++it;
+            continue;
+        }
+        if(cidr_is_sep(*it))
+        {
+            ++it;
+            continue;
+        }
+        char const* const first = it;
+        while( it != end &&
+            *it != '#' &&
+            ! cidr_is_sep(*it))
+            ++it;
+        bool v6;
+        unsigned char addr[16];
+        unsigned bits;
+        if(! parse(string_view(first,
+                it - first), v6, addr, bits))
+            throw_invalid_argument(
+                "bad prefix");
+        tmp.insert(v6, addr, bits, id);
+        ++n;
+    }
+    *this = std::move(tmp);
+    return n;
+}
+
+std::size_t
+cidr_trie::
+find_v4(
+    unsigned char const* addr) const noexcept
+{
+    return find(v4_, addr);
+}
+
+std::size_t
+cidr_trie::
+find_v6(
+    unsigned char const* addr) const noexcept
+{
+    // ::ffff:0:0/96
+    if( addr[10] == 0xff &&
+        addr[11] == 0xff &&
+        addr[0] == 0 && addr[1] == 0 &&
+        addr[2] == 0 && addr[3] == 0 &&
+        addr[4] == 0 && addr[5] == 0 &&
+        addr[6] == 0 && addr[7] == 0 &&
+        addr[8] == 0 && addr[9] == 0)
+    {
+        std::size_t const i =
+            find(v4_, addr + 12);
+        if(i != npos)
+            return i;
+    }
+    return find(v6_, addr);
+}
+
+std::size_t
+cidr_trie::
+find(url_impl const& u) const noexcept
+{
+    switch(u.host_type_)
+    {
+    case urls::host_type::ipv4:
+        return find_v4(u.ip_addr_);
+
+    case urls::host_type::ipv6:
+        return find_v6(u.ip_addr_);
+
+    default:
+        return npos;
+    }
+}
+
+} // detail
+} // urls
+} // boost
+
+#endif
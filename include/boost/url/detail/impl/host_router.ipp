@@ -0,0 +1,295 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_DETAIL_IMPL_HOST_ROUTER_IPP
+#define BOOST_URL_DETAIL_IMPL_HOST_ROUTER_IPP
+
+#include <boost/url/detail/host_router.hpp>
+#include <boost/url/detail/except.hpp>
+#include <boost/url/detail/normalize.hpp>
+#include <boost/url/detail/url_impl.hpp>
+#include <boost/url/grammar/hexdig_chars.hpp>
+#include <boost/url/grammar/parse.hpp>
+#include <boost/url/rfc/detail/host_rule.hpp>
+#include <cstring>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+constexpr std::size_t host_router_base::npos;
+
+std::size_t
+host_router_base::
+hash_name(
+    kind k,
+    string_view s) noexcept
+{
+    fnv_1a h(static_cast<
+        std::size_t>(k));
+    ci_digest_encoded(s, h);
+    return h.digest();
+}
+
+std::size_t
+host_router_base::
+hash_addr(
+    kind k,
+    unsigned char const* addr) noexcept
+{
+    fnv_1a h(static_cast<
+        std::size_t>(k));
+    std::size_t const n =
+        k == kind::ipv4 ? 4 : 16;
+    for(std::size_t i = 0; i < n; ++i)
+        h.put(static_cast<char>(addr[i]));
+    return h.digest();
+}
+
+auto
+host_router_base::
+probe(
+    std::size_t h,
+    kind k,
+    string_view name,
+    unsigned char const* addr) const noexcept ->
+        entry const*
+{
+    if(t_.empty())
+        return nullptr;
+    std::size_t const mask =
+        t_.size() - 1;
+    std::size_t j = h & mask;
+    while(t_[j] != npos)
+    {
+        entry const& e = v_[t_[j]];
+        if( e.hash == h &&
+            e.k == k)
+        {
+            switch(k)
+            {
+            case kind::ipv4:
+                if(std::memcmp(
+                        e.addr, addr, 4) == 0)
+                    return &e;
+                break;
+
+            case kind::ipv6:
+                if(std::memcmp(
+                        e.addr, addr, 16) == 0)
+                    return &e;
+                break;
+
+            default:
+                if(ci_compare_encoded(
+                        e.name, name) == 0)
+                    return &e;
+                break;
+            }
+        }
+        j = (j + 1) & mask;
+    }
+    return nullptr;
+}
+
+void
+host_router_base::
+rehash(std::size_t n)
+{
+    // keep the load at most one half
+    std::size_t size = 8;
+    while(size < 2 * n)
+        size *= 2;
+    std::vector<std::size_t> t(size, npos);
+    std::size_t const mask = size - 1;
+    for(std::size_t i = 0; i < v_.size(); ++i)
+    {
+        std::size_t j = v_[i].hash & mask;
+        while(t[j] != npos)
+            j = (j + 1) & mask;
+        t[j] = i;
+    }
+    t_.swap(t);
+}
+
+void
+host_router_base::
+insert(
+    string_view host,
+    std::size_t id)
+{
+    if(host == "*")
+    {
+        if(any_ != npos)
+            throw_invalid_argument(
+                "duplicate host");
+        any_ = id;
+        return;
+    }
+
+    entry e;
+    e.id = id;
+    std::memset(e.addr, 0, sizeof(e.addr));
+    bool const suffix =
+        host.size() > 2 &&
+        host[0] == '*' &&
+        host[1] == '.';
+    if(suffix)
+        host.remove_prefix(2);
+    auto rv = grammar::parse(
+        host, host_rule);
+    if(! rv || host.empty())
+        throw_invalid_argument(
+            "bad host");
+    switch(rv->host_type)
+    {
+    case urls::host_type::ipv4:
+        e.k = kind::ipv4;
+        break;
+    case urls::host_type::ipv6:
+        e.k = kind::ipv6;
+        break;
+    case urls::host_type::ipvfuture:
+        e.k = kind::ipvfuture;
+        break;
+    default:
+        e.k = kind::name;
+        break;
+    }
+    if(suffix)
+    {
+        if(e.k != kind::name)
+            throw_invalid_argument(
+                "bad host");
+        e.k = kind::suffix;
+    }
+    if( e.k == kind::ipv4 ||
+        e.k == kind::ipv6)
+    {
+        std::memcpy(e.addr,
+            rv->addr, sizeof(e.addr));
+        e.hash = hash_addr(e.k, e.addr);
+    }
+    else
+    {
+        e.name.assign(
+            host.data(), host.size());
+        e.hash = hash_name(e.k, host);
+    }
+    if(probe(e.hash, e.k, e.name, e.addr))
+        throw_invalid_argument(
+            "duplicate host");
+
+    v_.push_back(std::move(e));
+    if(2 * v_.size() > t_.size())
+    {
+        try
+        {
+            rehash(v_.size());
+        }
+        catch(...)
+        {
+            v_.pop_back();
+            throw;
+        }
+    }
+    else
+    {
+        std::size_t const mask =
+            t_.size() - 1;
+        std::size_t j =
+            v_.back().hash & mask;
+        while(t_[j] != npos)
+            j = (j + 1) & mask;
+        t_[j] = v_.size() - 1;
+    }
+    if(suffix)
+        ++nsuffix_;
+}
+
+std::size_t
+host_router_base::
+find(url_impl const& u) const noexcept
+{
+    entry const* e = nullptr;
+    switch(u.host_type_)
+    {
+    case urls::host_type::none:
+        return npos;
+
+    case urls::host_type::ipv4:
+        e = probe(hash_addr(
+            kind::ipv4, u.ip_addr_),
+            kind::ipv4, {}, u.ip_addr_);
+        break;
+
+    case urls::host_type::ipv6:
+        e = probe(hash_addr(
+            kind::ipv6, u.ip_addr_),
+            kind::ipv6, {}, u.ip_addr_);
+        break;
+
+    case urls::host_type::ipvfuture:
+    {
+        string_view const s =
+            u.get(url_impl::id_host);
+        e = probe(hash_name(
+            kind::ipvfuture, s),
+            kind::ipvfuture, s, nullptr);
+        break;
+    }
+
+    case urls::host_type::name:
+    {
+        string_view const s =
+            u.get(url_impl::id_host);
+        if(s.empty())
+            return npos;
+        e = probe(hash_name(
+            kind::name, s),
+            kind::name, s, nullptr);
+        if(e || nsuffix_ == 0)
+            break;
+
+        // longest suffix after a dot
+        std::size_t i = 0;
+        while(i < s.size())
+        {
+            char c = s[i++];
+            if( c == '%' &&
+                s.size() - i >= 2)
+            {
+                c = static_cast<char>(
+                    (grammar::hexdig_value(s[i]) << 4) +
+                        grammar::hexdig_value(s[i + 1]));
+                i += 2;
+            }
+            if(c != '.')
+                continue;
+            string_view const rest =
+                s.substr(i);
+            e = probe(hash_name(
+                kind::suffix, rest),
+                kind::suffix, rest, nullptr);
+            if(e)
+                break;
+        }
+        break;
+    }
+    }
+    if(e)
+        return e->id;
+    return any_;
+}
+
+} // detail
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,177 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_DETAIL_IMPL_IPV4_IPP
+#define BOOST_URL_DETAIL_IMPL_IPV4_IPP
+
+#include <boost/url/detail/ipv4.hpp>
+#include <boost/core/bit.hpp>
+#include <cstring>
+
+#ifdef BOOST_URL_USE_SSE2
+# include <emmintrin.h>
+#endif
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+namespace {
+
+// weights of the digits of an
+// octet, by number of digits
+constexpr unsigned char ipv4_weights[4][3] = {
+    {   0,  0, 0 },
+    {   1,  0, 0 },
+    {  10,  1, 0 },
+    { 100, 10, 1 } };
+
+// Copy n <= 16 chars to b, with copies
+// of constant size which may overlap
+inline
+void
+copy_window(
+    unsigned char* b,
+    char const* p,
+    std::size_t n) noexcept
+{
+    if(n >= 8)
+    {
+        std::memcpy(b, p, 8);
+        std::memcpy(b + n - 8, p + n - 8, 8);
+    }
+    else if(n >= 4)
+    {
+        std::memcpy(b, p, 4);
+        std::memcpy(b + n - 4, p + n - 4, 4);
+    }
+    else
+    {
+        for(std::size_t i = 0; i < n; ++i)
+            b[i] = static_cast<
+                unsigned char>(p[i]);
+    }
+}
+
+} // (anon)
+
+bool
+parse_ipv4(
+    char const*& it,
+    char const* end,
+    std::uint32_t& v,
+    grammar::error& ev) noexcept
+{
+    // An address and the character after
+    // it fit in 16 bytes. Digit runs which
+    // reach the end of the window begin
+    // too late to be valid octets.
+    std::size_t const n =
+        end - it < 16 ? end - it : 16;
+    unsigned char b[16] = {};
+    unsigned digits = 0;
+    unsigned dots = 0;
+#ifdef BOOST_URL_USE_SSE2
+    __m128i x;
+    if(n == 16)
+    {
+        x = _mm_loadu_si128(
+            reinterpret_cast<__m128i const*>(it));
+        _mm_storeu_si128(
+            reinterpret_cast<__m128i*>(b), x);
+    }
+    else
+    {
+        copy_window(b, it, n);
+        x = _mm_loadu_si128(
+            reinterpret_cast<__m128i const*>(b));
+    }
+    digits = static_cast<unsigned>(
+        _mm_movemask_epi8(_mm_and_si128(
+            _mm_cmpgt_epi8(x, _mm_set1_epi8('0' - 1)),
+            _mm_cmplt_epi8(x, _mm_set1_epi8('9' + 1)))));
+    dots = static_cast<unsigned>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(
+            x, _mm_set1_epi8('.'))));
+#else
+    copy_window(b, it, n);
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        if( b[i] >= '0' &&
+            b[i] <= '9')
+            digits |= 1u << i;
+        else if(b[i] == '.')
+            dots |= 1u << i;
+    }
+#endif
+
+    std::uint32_t r = 0;
+    std::size_t pos = 0;
+    for(int k = 0; k < 4; ++k)
+    {
+        if(k > 0)
+        {
+            if(pos == n)
+            {
+                ev = grammar::error::need_more;
+                return false;
+            }
+            if(! ((dots >> pos) & 1))
+            {
+                ev = grammar::error::mismatch;
+                return false;
+            }
+            ++pos;
+        }
+        // number of digits
+        unsigned const len =
+            boost::core::countr_zero(
+                ~(digits >> pos));
+        if(len == 0)
+        {
+            // expected DIGIT
+            ev = grammar::error::mismatch;
+            return false;
+        }
+        if(len > 3)
+        {
+            // integer overflow
+            ev = grammar::error::invalid;
+            return false;
+        }
+        // without branches on len. Octets
+        // start before b + 13, and chars
+        // after the digits have weight 0.
+        unsigned char const* const w =
+            ipv4_weights[len];
+        unsigned const d0 = b[pos] - '0';
+        unsigned const o =
+            d0 * w[0] +
+            (b[pos + 1] - '0') * w[1] +
+            (b[pos + 2] - '0') * w[2];
+        if(((len > 1) & (d0 == 0)) |
+            (o > 255))
+        {
+            // leading '0' or overflow
+            ev = grammar::error::invalid;
+            return false;
+        }
+        r = (r << 8) | o;
+        pos += len;
+    }
+    it += pos;
+    v = r;
+    return true;
+}
+
+} // detail
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,453 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_DETAIL_IMPL_IPV6_IPP
+#define BOOST_URL_DETAIL_IMPL_IPV6_IPP
+
+#include <boost/url/detail/ipv6.hpp>
+#include <boost/url/detail/ipv4.hpp>
+#include <boost/core/bit.hpp>
+#include <cstdint>
+#include <cstring>
+
+#ifdef BOOST_URL_USE_SSE2
+# include <emmintrin.h>
+#endif
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+namespace {
+
+// return `true` if the hex
+// word could be 0..255 if
+// interpreted as decimal
+inline
+bool
+ipv6_maybe_octet(
+    std::uint16_t word) noexcept
+{
+    return
+        word <= 0x255 &&
+        ((word >> 4) & 0xf) <= 9 &&
+        (word & 0xf) <= 9;
+}
+
+#ifdef BOOST_URL_USE_SSE2
+// Value of each HEXDIG, in the low
+// four bits for any other char
+inline
+__m128i
+ipv6_nibbles(__m128i x) noexcept
+{
+    __m128i const m = _mm_set1_epi8(0x0f);
+    __m128i const hi = _mm_and_si128(
+        _mm_srli_epi16(x, 6), _mm_set1_epi8(3));
+    return _mm_and_si128(_mm_add_epi8(
+        _mm_add_epi8(_mm_and_si128(x, m), hi),
+        _mm_slli_epi16(hi, 3)), m);
+}
+
+// Bits of the HEXDIG, ':' and '.' in
+// 16 chars at shift, and the value of
+// each HEXDIG
+inline
+void
+ipv6_classify(
+    unsigned char const* p,
+    std::size_t shift,
+    std::uint64_t& hex,
+    std::uint64_t& colons,
+    std::uint64_t& dots,
+    unsigned char* nib) noexcept
+{
+    __m128i const x = _mm_loadu_si128(
+        reinterpret_cast<__m128i const*>(p));
+    __m128i const l = _mm_or_si128(
+        x, _mm_set1_epi8(0x20));
+    __m128i const h = _mm_or_si128(
+        _mm_and_si128(
+            _mm_cmpgt_epi8(x, _mm_set1_epi8('0' - 1)),
+            _mm_cmplt_epi8(x, _mm_set1_epi8('9' + 1))),
+        _mm_and_si128(
+            _mm_cmpgt_epi8(l, _mm_set1_epi8('a' - 1)),
+            _mm_cmplt_epi8(l, _mm_set1_epi8('f' + 1))));
+    hex |= static_cast<std::uint64_t>(
+        static_cast<unsigned>(
+            _mm_movemask_epi8(h))) << shift;
+    colons |= static_cast<std::uint64_t>(
+        static_cast<unsigned>(_mm_movemask_epi8(
+            _mm_cmpeq_epi8(x, _mm_set1_epi8(':'))))) << shift;
+    dots |= static_cast<std::uint64_t>(
+        static_cast<unsigned>(_mm_movemask_epi8(
+            _mm_cmpeq_epi8(x, _mm_set1_epi8('.'))))) << shift;
+    _mm_storeu_si128(
+        reinterpret_cast<__m128i*>(nib + shift),
+        ipv6_nibbles(x));
+}
+#else
+// Value of a HEXDIG, in the low
+// four bits for any other char
+inline
+unsigned
+ipv6_nibble(unsigned char c) noexcept
+{
+    return ((c & 0xf) + 9 * (c >> 6)) & 0xf;
+}
+#endif
+
+// Value of the h16 of len HEXDIG at p.
+// The nibbles after it are shifted out.
+inline
+std::uint16_t
+ipv6_word(
+    unsigned char const* nib,
+    unsigned p,
+    unsigned len) noexcept
+{
+    return static_cast<std::uint16_t>((
+        (nib[p    ] << 12) |
+        (nib[p + 1] <<  8) |
+        (nib[p + 2] <<  4) |
+         nib[p + 3]) >> (4 * (4 - len)));
+}
+
+// Store the words before "::" at the
+// front and the others at the back,
+// with zeroes between them
+inline
+void
+ipv6_store(
+    unsigned char* dest,
+    std::uint16_t const* w,
+    int nw,
+    int head) noexcept
+{
+    int const gap = 8 - nw;
+    for(int j = 0; j < 8; ++j)
+    {
+        int const i = j < head ? j : j - gap;
+        std::uint16_t const v =
+            (j < head || i >= head) ?
+                w[i & 7] : 0;
+        dest[2 * j    ] = static_cast<
+            unsigned char>(v >> 8);
+        dest[2 * j + 1] = static_cast<
+            unsigned char>(v & 0xff);
+    }
+}
+
+// Parse the usual forms of an address
+// with the masks alone: h16 separated by
+// one ':' and at most one "::", then the
+// end or an IPv4 tail. Return false for
+// anything else, which includes every
+// error, to take the slow path.
+inline
+bool
+ipv6_fast(
+    char const*& it,
+    char const* end,
+    std::uint64_t hex,
+    std::uint64_t colons,
+    std::uint64_t dots,
+    unsigned char const* nib,
+    unsigned char* dest) noexcept
+{
+    // the run of HEXDIG and ':'
+    unsigned const span =
+        boost::core::countr_zero(
+            ~(hex | colons));
+    if( span < 2 ||
+        span >= 48)
+        return false;
+    std::uint64_t const in =
+        (std::uint64_t(1) << span) - 1;
+    std::uint64_t const h = hex & in;
+    std::uint64_t const c = colons & in;
+    // first ':' of each "::"
+    std::uint64_t const dbl = c & (c >> 1);
+    if( (dbl & (dbl >> 1)) ||
+        (dbl & (dbl - 1)) ||
+        (h & (h >> 1) & (h >> 2) &
+            (h >> 3) & (h >> 4)))
+    {
+        // ":::", two "::", or
+        // five HEXDIG
+        return false;
+    }
+    if( ((c & 1) && ! (dbl & 1)) ||
+        (((c >> (span - 1)) & 1) &&
+            ! ((dbl >> (span - 2)) & 1)))
+    {
+        // one ':' first or last
+        return false;
+    }
+    // words in order, and the number
+    // of them before "::"
+    std::uint16_t w[8] = {};
+    int nw = 0;
+    int head = 0;
+    unsigned p = 0;
+    for(std::uint64_t m = h & ~(h << 1);
+        m; m &= m - 1)
+    {
+        if(nw == 8)
+            return false;
+        p = boost::core::countr_zero(m);
+        unsigned const len =
+            boost::core::countr_zero(
+                ~(h >> p));
+        w[nw++] = ipv6_word(nib, p, len);
+        head += (std::uint64_t(1) << p) < dbl;
+    }
+    if(! dbl)
+        head = nw;
+    char const* last = it + span;
+    if((dots >> span) & 1)
+    {
+        // the last h16 is the first
+        // octet, which leaves room
+        std::uint32_t v;
+        grammar::error ev;
+        if( ! ((h >> (span - 1)) & 1) ||
+            nw > (dbl ? 6 : 7) ||
+            (! dbl && nw < 7) ||
+            ! ipv6_maybe_octet(w[nw - 1]))
+            return false;
+        last = it + p;
+        if(! parse_ipv4(last, end, v, ev))
+            return false;
+        w[nw - 1] = static_cast<
+            std::uint16_t>(v >> 16);
+        w[nw] = static_cast<
+            std::uint16_t>(v & 0xffff);
+        if(! dbl)
+            ++head;
+        ++nw;
+    }
+    else if(
+        nw > (dbl ? 7 : 8) ||
+        (! dbl && nw < 8))
+    {
+        return false;
+    }
+    ipv6_store(dest, w, nw, head);
+    it = last;
+    return true;
+}
+
+} // (anon)
+
+bool
+parse_ipv6(
+    char const*& it,
+    char const* const end,
+    unsigned char* dest,
+    grammar::error& ev) noexcept
+{
+    // Every char consumed before the
+    // IPv4 tail is at most 40 chars in,
+    // and at most one more is examined,
+    // so a window of 48 chars holds the
+    // address and the char after it.
+    std::size_t const n =
+        end - it < 48 ? end - it : 48;
+    std::uint64_t hex = 0;
+    std::uint64_t colons = 0;
+    std::uint64_t dots = 0;
+    // the value of each HEXDIG, with
+    // zeroes past the end for the h16
+    unsigned char nib[64] = {};
+#ifdef BOOST_URL_USE_SSE2
+    if(n >= 16)
+    {
+        // the last block ends at the end
+        // and may overlap the others
+        auto const p = reinterpret_cast<
+            unsigned char const*>(it);
+        ipv6_classify(p, 0,
+            hex, colons, dots, nib);
+        if(n >= 32)
+            ipv6_classify(p + 16, 16,
+                hex, colons, dots, nib);
+        ipv6_classify(p + n - 16, n - 16,
+            hex, colons, dots, nib);
+    }
+    else
+    {
+        unsigned char b[16] = {};
+        std::memcpy(b, it, n);
+        ipv6_classify(b, 0,
+            hex, colons, dots, nib);
+    }
+#else
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        unsigned char const c =
+            static_cast<unsigned char>(it[i]);
+        unsigned char const l = c | 0x20;
+        std::uint64_t const bit =
+            std::uint64_t(1) << i;
+        if( (c >= '0' && c <= '9') ||
+            (l >= 'a' && l <= 'f'))
+            hex |= bit;
+        else if(c == ':')
+            colons |= bit;
+        else if(c == '.')
+            dots |= bit;
+        nib[i] = static_cast<
+            unsigned char>(ipv6_nibble(c));
+    }
+#endif
+
+    if(ipv6_fast(it, end, hex,
+            colons, dots, nib, dest))
+        return true;
+
+    // Otherwise one token at a time, as
+    // in the grammar. The words are in
+    // order, with the IPv4 tail as two.
+    std::uint16_t w[8] = {};
+    int nw = 0;
+    // nw when "::" seen
+    int dbl = -1;
+    // words needed, "::" is one
+    int room = 8;
+    // need colon
+    bool c = false;
+    std::size_t pos = 0;
+    // start of the last h16
+    std::size_t prev = 0;
+    char const* last = nullptr;
+    for(;;)
+    {
+        if(pos == n)
+        {
+            if(dbl != -1)
+            {
+                // end in "::"
+                break;
+            }
+            // not enough words
+            ev = grammar::error::invalid;
+            return false;
+        }
+        if((colons >> pos) & 1)
+        {
+            ++pos;
+            if(pos == n)
+            {
+                // expected ':'
+                ev = grammar::error::invalid;
+                return false;
+            }
+            if((colons >> pos) & 1)
+            {
+                if(dbl != -1)
+                {
+                    // extra "::" found
+                    ev = grammar::error::invalid;
+                    return false;
+                }
+                ++pos;
+                --room;
+                dbl = nw;
+                if(room == 0)
+                    break;
+                c = false;
+                continue;
+            }
+            if(! c)
+            {
+                // expected h16
+                ev = grammar::error::invalid;
+                return false;
+            }
+        }
+        else if((dots >> pos) & 1)
+        {
+            if( ! c ||
+                (dbl == -1 && room > 1) ||
+                ! ipv6_maybe_octet(w[nw - 1]))
+            {
+                // not enough h16, or
+                // invalid octet
+                ev = grammar::error::invalid;
+                return false;
+            }
+            // parse the last h16
+            // again as ipv4
+            char const* p = it + prev;
+            std::uint32_t v;
+            if(! parse_ipv4(p, end, v, ev))
+                return false;
+            w[nw - 1] = static_cast<
+                std::uint16_t>(v >> 16);
+            w[nw++] = static_cast<
+                std::uint16_t>(v & 0xffff);
+            last = p;
+            break;
+        }
+        else if(! ((hex >> pos) & 1))
+        {
+            if(dbl != -1)
+            {
+                // ends in "::"
+                break;
+            }
+            // expected HEXDIG
+            ev = grammar::error::invalid;
+            return false;
+        }
+        else if(c)
+        {
+            // ':' divides a word
+            ev = grammar::error::invalid;
+            return false;
+        }
+
+        // h16, up to four HEXDIG. Chars
+        // after them are shifted out.
+        unsigned len =
+            boost::core::countr_zero(
+                ~(hex >> pos));
+        if(len == 0)
+        {
+            // expected HEXDIG
+            ev = grammar::error::invalid;
+            return false;
+        }
+        if(len > 4)
+            len = 4;
+        prev = pos;
+        w[nw++] = ipv6_word(nib,
+            static_cast<unsigned>(pos), len);
+        pos += len;
+        --room;
+        if(room == 0)
+            break;
+        c = true;
+    }
+
+    ipv6_store(dest, w, nw,
+        dbl == -1 ? nw : dbl);
+    if(last)
+        it = last;
+    else
+        it += pos;
+    return true;
+}
+
+} // detail
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,111 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_DETAIL_IMPL_PARAMS_INDEX_IPP
+#define BOOST_URL_DETAIL_IMPL_PARAMS_INDEX_IPP
+
+#include <boost/url/detail/params_index.hpp>
+#include <boost/url/detail/except.hpp>
+#include <boost/url/detail/normalize.hpp>
+#include <boost/url/detail/query_split.hpp>
+#include <boost/assert.hpp>
+#include <cstdint>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+params_index_impl::
+params_index_impl(
+    string_view s,
+    std::size_t n,
+    bool plus,
+    void* storage,
+    std::size_t size)
+    : s_(s)
+    , n_(n)
+{
+    std::size_t const m = table_size(n);
+    if(size < m * sizeof(params_index_slot))
+        detail::throw_length_error(
+            "storage too small");
+    if(m == 0)
+        return;
+    BOOST_ASSERT(reinterpret_cast<
+        std::uintptr_t>(storage) %
+            alignof(params_index_slot) == 0);
+    t_ = static_cast<
+        params_index_slot*>(storage);
+    mask_ = m - 1;
+    for(std::size_t j = 0; j < m; ++j)
+        t_[j].pos = npos;
+
+    // one pass over the query
+    std::size_t i = 0;
+    split_query(s, [this, s, plus, &i](
+        std::size_t pos,
+        std::size_t,
+        std::size_t nk)
+    {
+        std::size_t const prefix = i > 0;
+        std::size_t const h = hash_encoded(
+            s.substr(pos + prefix, nk - prefix),
+            plus);
+        std::size_t j = h & mask_;
+        while(t_[j].pos != npos)
+            j = (j + 1) & mask_;
+        t_[j].hash = h;
+        t_[j].pos = pos;
+        t_[j].i = i++;
+    });
+    BOOST_ASSERT(i == n);
+}
+
+std::size_t
+params_index_impl::
+hash(string_view key) noexcept
+{
+    fnv_1a h(0);
+    h.put(key);
+    return h.digest();
+}
+
+std::size_t
+params_index_impl::
+hash_encoded(
+    string_view key,
+    bool plus) noexcept
+{
+    fnv_1a h(0);
+    if(! plus)
+    {
+        digest_encoded(key, h);
+        return h.digest();
+    }
+    char c = 0;
+    std::size_t n = 0;
+    while(! key.empty())
+    {
+        if(key.front() == '+')
+        {
+            h.put(' ');
+            key.remove_prefix(1);
+            continue;
+        }
+        pop_encoded_front(key, c, n);
+        h.put(c);
+    }
+    return h.digest();
+}
+
+} // detail
+} // urls
+} // boost
+
+#endif
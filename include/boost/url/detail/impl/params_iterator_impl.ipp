@@ -12,6 +12,7 @@
 #define BOOST_URL_DETAIL_IMPL_PARAMS_ITERATOR_IMPL_IPP
 
 #include <boost/url/detail/params_iterator_impl.hpp>
+#include <boost/url/detail/query_split.hpp>
 #include <boost/assert.hpp>
 
 namespace boost {
@@ -29,32 +30,19 @@ scan() noexcept
         return;
     }
 
-    string_view s(pos_, end_ - pos_);
-    std::size_t i;
+    char const* first = pos_;
     if(pos_ != begin_ || i_ != 0)
     {
-        BOOST_ASSERT(
-            s.starts_with('&'));
-        i = s.find_first_of('&', 1);
-    }
-    else
-    {
-        i = s.find_first_of('&');
-    }
-    if( i == string_view::npos)
-        i = s.size();
-    nk_ = string_view(
-        pos_, i).find_first_of('=');
-    if(nk_ != string_view::npos)
-    {
-        nv_ = i - nk_;
-    }
-    else
-    {
-        // has_value==false
-        nk_ = i;
-        nv_ = 0;
+        BOOST_ASSERT(*pos_ == '&');
+        ++first;
     }
+    // one pass for '&' and '=', where
+    // has_value==false leaves nv_ == 0
+    char const* eq;
+    char const* const e =
+        find_param_end(first, end_, eq);
+    nk_ = eq - pos_;
+    nv_ = e - eq;
 }
 
 params_iterator_impl::
@@ -82,6 +70,19 @@ params_iterator_impl(
 {
 }
 
+params_iterator_impl::
+params_iterator_impl(
+    string_view s,
+    std::size_t i,
+    std::size_t pos) noexcept
+    : begin_(s.data())
+    , end_(s.data() + s.size())
+    , pos_(s.data() + pos)
+    , i_(i)
+{
+    scan();
+}
+
 params_view::reference
 params_iterator_impl::
 dereference() const noexcept
@@ -129,7 +130,8 @@ encoded_key() const noexcept
 {
     BOOST_ASSERT(begin_ != nullptr);
     BOOST_ASSERT(end_ != nullptr);
-    BOOST_ASSERT(pos_ != end_);
+    BOOST_ASSERT(
+        pos_ != end_ || nk_ == 0);
     BOOST_ASSERT(pos_ != nullptr);
 
     if(pos_ != begin_)
@@ -32,6 +32,16 @@ construct(
     return pct_encoded_view(s, n, opt);
 }
 
+pct_encoded_view
+access::
+rebase(
+    pct_encoded_view s,
+    std::ptrdiff_t d) noexcept
+{
+    s.p_ += d;
+    return s;
+}
+
 } // detail
 } // urls
 } // boost
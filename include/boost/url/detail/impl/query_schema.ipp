@@ -0,0 +1,182 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_DETAIL_IMPL_QUERY_SCHEMA_IPP
+#define BOOST_URL_DETAIL_IMPL_QUERY_SCHEMA_IPP
+
+#include <boost/url/detail/query_schema.hpp>
+#include <boost/url/detail/normalize.hpp>
+#include <cstring>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+namespace {
+
+// Pop one decoded character of an
+// encoded value, where '+' is a space
+char
+pop_schema_char(string_view& s) noexcept
+{
+    if(s.front() == '+')
+    {
+        s.remove_prefix(1);
+        return ' ';
+    }
+    char c = 0;
+    std::size_t n = 0;
+    pop_encoded_front(s, c, n);
+    return c;
+}
+
+} // (anon)
+
+result<unsigned long long>
+parse_schema_unsigned(
+    string_view s,
+    unsigned long long max) noexcept
+{
+    if(s.empty())
+    {
+        // expected digit
+        BOOST_URL_RETURN_EC(
+            grammar::error::mismatch);
+    }
+    unsigned long long u = 0;
+    while(! s.empty())
+    {
+        char const c = pop_schema_char(s);
+        if(c < '0' || c > '9')
+        {
+            // expected digit
+            BOOST_URL_RETURN_EC(
+                grammar::error::invalid);
+        }
+        unsigned const d = c - '0';
+        if( u > max / 10 || (
+            u == max / 10 &&
+            d > max % 10))
+        {
+            BOOST_URL_RETURN_EC(
+                grammar::error::overflow);
+        }
+        u = u * 10 + d;
+    }
+    return u;
+}
+
+result<long long>
+parse_schema_signed(
+    string_view s,
+    long long min,
+    long long max) noexcept
+{
+    bool neg = false;
+    if(! s.empty())
+    {
+        string_view t = s;
+        if(pop_schema_char(t) == '-')
+        {
+            neg = true;
+            s = t;
+        }
+    }
+    // magnitude of min, without
+    // overflowing long long
+    unsigned long long const lim = neg ?
+        static_cast<unsigned long long>(
+            -(min + 1)) + 1 :
+        static_cast<unsigned long long>(max);
+    auto rv = parse_schema_unsigned(s, lim);
+    if(! rv)
+        return rv.error();
+    if(! neg)
+        return static_cast<long long>(*rv);
+    if(*rv == 0)
+        return 0;
+    return -static_cast<long long>(
+        *rv - 1) - 1;
+}
+
+result<bool>
+parse_schema_bool(
+    string_view s,
+    bool has_value) noexcept
+{
+    if(! has_value)
+        return true;
+    if( key_equal(s, "1", true) ||
+        key_equal(s, "true", true))
+        return true;
+    if( key_equal(s, "0", true) ||
+        key_equal(s, "false", true))
+        return false;
+    BOOST_URL_RETURN_EC(
+        grammar::error::invalid);
+}
+
+void
+build_schema_table(
+    std::size_t const* h,
+    std::size_t n,
+    unsigned char* slots,
+    unsigned min_bits,
+    unsigned max_bits,
+    std::size_t& seed,
+    unsigned& bits) noexcept
+{
+    // the number of seeds tried
+    // for each size of table
+    std::size_t const tries = 256;
+    for(bits = min_bits;
+        bits <= max_bits; ++bits)
+    {
+        std::size_t const size =
+            std::size_t(1) << bits;
+        for(seed = 0; seed < tries; ++seed)
+        {
+            std::memset(slots, 0, size);
+            std::size_t i = 0;
+            for(; i < n; ++i)
+            {
+                std::size_t const j =
+                    schema_slot(h[i], seed, bits);
+                if(slots[j] != 0)
+                    break;
+                slots[j] = static_cast<
+                    unsigned char>(i + 1);
+            }
+            if(i == n)
+                return;
+        }
+    }
+
+    // keys whose hashes collide
+    bits = max_bits;
+    seed = 0;
+    std::size_t const mask =
+        (std::size_t(1) << bits) - 1;
+    std::memset(slots, 0, mask + 1);
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        std::size_t j =
+            schema_slot(h[i], seed, bits);
+        while(slots[j] != 0)
+            j = (j + 1) & mask;
+        slots[j] = static_cast<
+            unsigned char>(i + 1);
+    }
+}
+
+} // detail
+} // urls
+} // boost
+
+#endif
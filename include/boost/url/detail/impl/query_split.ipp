@@ -0,0 +1,162 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_DETAIL_IMPL_QUERY_SPLIT_IPP
+#define BOOST_URL_DETAIL_IMPL_QUERY_SPLIT_IPP
+
+#include <boost/url/detail/query_split.hpp>
+#include <boost/url/detail/normalize.hpp>
+#include <boost/url/pct_encoded_view.hpp>
+#include <cstring>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+char const*
+find_param_end(
+    char const* first,
+    char const* last,
+    char const*& eq) noexcept
+{
+    eq = nullptr;
+#ifdef BOOST_URL_USE_SSE2
+    __m128i const amp = _mm_set1_epi8('&');
+    __m128i const equ = _mm_set1_epi8('=');
+    while(last - first >= 16)
+    {
+        __m128i const v = _mm_loadu_si128(
+            reinterpret_cast<__m128i const*>(first));
+        unsigned const ma = static_cast<unsigned>(
+            _mm_movemask_epi8(
+                _mm_cmpeq_epi8(v, amp)));
+        unsigned me = static_cast<unsigned>(
+            _mm_movemask_epi8(
+                _mm_cmpeq_epi8(v, equ)));
+        if(ma)
+        {
+            char const* const e = first +
+                boost::core::countr_zero(ma);
+            me &= (ma & (0u - ma)) - 1;
+            if(! eq)
+                eq = me ? first +
+                    boost::core::countr_zero(me) : e;
+            return e;
+        }
+        if( ! eq && me)
+            eq = first +
+                boost::core::countr_zero(me);
+        first += 16;
+    }
+#endif
+    for(; first != last; ++first)
+    {
+        if(*first == '&')
+            break;
+        if( *first == '=' &&
+            ! eq)
+            eq = first;
+    }
+    if(! eq)
+        eq = first;
+    return first;
+}
+
+char const*
+find_key_escape(
+    char const* first,
+    char const* last,
+    bool plus) noexcept
+{
+#ifdef BOOST_URL_USE_SSE2
+    __m128i const pct = _mm_set1_epi8('%');
+    // when plus is false, look
+    // for '%' twice instead
+    __m128i const pls = _mm_set1_epi8(
+        plus ? '+' : '%');
+    while(last - first >= 16)
+    {
+        __m128i const v = _mm_loadu_si128(
+            reinterpret_cast<__m128i const*>(first));
+        unsigned const m = static_cast<unsigned>(
+            _mm_movemask_epi8(_mm_or_si128(
+                _mm_cmpeq_epi8(v, pct),
+                _mm_cmpeq_epi8(v, pls))));
+        if(m)
+            return first +
+                boost::core::countr_zero(m);
+        first += 16;
+    }
+#endif
+    for(; first != last; ++first)
+    {
+        if( *first == '%' ||
+            (plus && *first == '+'))
+            break;
+    }
+    return first;
+}
+
+bool
+key_equal(
+    string_view ek,
+    string_view key,
+    bool plus) noexcept
+{
+    // decoding never grows a key
+    if(ek.size() < key.size())
+        return false;
+    if(ek.size() == key.size())
+    {
+        char const* const end =
+            ek.data() + ek.size();
+        if(ek.empty())
+            return true;
+        if(find_key_escape(
+            ek.data(), end, plus) == end)
+            return std::memcmp(
+                ek.data(), key.data(),
+                ek.size()) == 0;
+    }
+    pct_decode_opts opt;
+    opt.plus_to_space = plus;
+    return pct_encoded_view(ek, opt) == key;
+}
+
+bool
+encoded_key_equal(
+    string_view ek,
+    string_view key,
+    bool plain) noexcept
+{
+    if(plain)
+    {
+        if(ek.size() < key.size())
+            return false;
+        if(ek.empty())
+            return true;
+        if(ek.size() == key.size())
+        {
+            char const* const end =
+                ek.data() + ek.size();
+            return find_key_escape(
+                ek.data(), end, false) == end &&
+                std::memcmp(
+                    ek.data(), key.data(),
+                    ek.size()) == 0;
+        }
+    }
+    return compare_encoded(ek, key) == 0;
+}
+
+} // detail
+} // urls
+} // boost
+
+#endif
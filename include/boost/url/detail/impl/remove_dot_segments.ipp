@@ -11,177 +11,239 @@
 #define BOOST_URL_DETAIL_IMPL_REMOVE_DOT_SEGMENTS_IPP
 
 #include <boost/url/detail/remove_dot_segments.hpp>
+#include <boost/url/detail/alloc_stats.hpp>
+#include <boost/url/detail/path.hpp>
+#include <boost/url/pct_encoding.hpp>
 #include <boost/assert.hpp>
+#include <boost/core/bit.hpp>
+#include <algorithm>
 #include <cstring>
 
+#ifdef BOOST_URL_USE_SSE2
+# include <emmintrin.h>
+#endif
+
 namespace boost {
 namespace urls {
 namespace detail {
 
+bool
+has_dot_segments(
+    string_view s) noexcept
+{
+    char const* it = s.data();
+    char const* const end =
+        it + s.size();
+    // a segment starts at the beginning
+    // of the path and after each '/'
+    unsigned carry = 1;
+#ifdef BOOST_URL_USE_SSE2
+    __m128i const dot = _mm_set1_epi8('.');
+    __m128i const slash = _mm_set1_epi8('/');
+    while(end - it >= 16)
+    {
+        __m128i const v = _mm_loadu_si128(
+            reinterpret_cast<__m128i const*>(it));
+        unsigned const dots = _mm_movemask_epi8(
+            _mm_cmpeq_epi8(v, dot));
+        unsigned const slashes = _mm_movemask_epi8(
+            _mm_cmpeq_epi8(v, slash));
+        if(dots & ((slashes << 1) | carry))
+            return true;
+        carry = (slashes >> 15) & 1;
+        it += 16;
+    }
+#endif
+    while(it != end)
+    {
+        if( *it == '.' &&
+            carry)
+            return true;
+        carry = *it == '/';
+        ++it;
+    }
+    return false;
+}
+
 std::size_t
 remove_dot_segments(
-    char* dest0,
-    char const* end,
-    string_view s,
+    char* first,
+    char const* last,
+    std::size_t& nseg,
     bool remove_unmatched) noexcept
 {
-    // 1. The input buffer is initialized with
-    // the now-appended path components and the
-    // output buffer is initialized to the empty
-    // string.
-    char* dest = dest0;
-    auto append =
-        [&dest, &end]
-        (string_view in)
-    {
-        BOOST_ASSERT(in.size() <= std::size_t(end - dest));
-        std::memcpy(dest, in.data(), in.size());
-        dest += in.size();
-        (void)end;
-    };
+    // The output never grows faster than
+    // the input is consumed, so segments
+    // can be moved down into the same
+    // buffer as they are read.
+    char* dest = first;
+    char const* it = first;
+    std::size_t nout = 0;
+    // number of output segments
+    // which a ".." may remove
+    std::size_t n = 0;
 
-    auto find_last_slash =
-        [&dest0, &dest]() -> std::size_t
+    auto const push =
+        [&dest, &nout]
+        (char const* p, std::size_t len)
     {
-        char* const first = dest0;
-        char* last = dest;
-        while (last != first)
-        {
-            --last;
-            if (*last == '/')
-                return last - first;
-        }
-        return string_view::npos;
+        if(nout > 0)
+            *dest++ = '/';
+        move_chars(dest, p, len);
+        dest += len;
+        ++nout;
     };
 
-    // Step 2 is a loop through 5 production rules
-    // There are no transitions between all rules,
-    // which enables some optimizations.
-    // A.  If the input buffer begins with a
-    // prefix of "../" or "./", then remove
-    // that prefix from the input buffer;
-    // otherwise,
-    // Rule A can only happen at the beginning:
-    // - B and C write "/" to the output
-    // - D can only happen at the end
-    // - E leaves "/" or happens at the end
-    while (!s.empty())
-    {
-        if (s.starts_with("../"))
-        {
-            if (!remove_unmatched)
-                append(s.substr(0, 3));
-            s.remove_prefix(3);
-            continue;
-        }
-        if (!s.starts_with("./"))
-            break;
-        s.remove_prefix(2);
-    }
-
-    // D.  if the input buffer consists only
-    // of "." or "..", then remove that from
-    // the input buffer; otherwise,
-    // Rule D can only happen after A is consumed:
-    // - B and C write "/" to the output
-    // - D can only happen at the end
-    // - E leaves "/" or happens at the end
-    if( s == "." ||
-        s == "..")
+    auto const pop =
+        [&dest, &nout, first]
     {
-        if( ! remove_unmatched &&
-                s == "..")
-            append(s);
-        s = {};
-    }
-
-    // 2. While the input buffer is not empty,
-    // loop as follows:
-    while (!s.empty())
-    {
-        // B.  if the input buffer begins with a
-        // prefix of "/./" or "/.", where "." is
-        // a complete path segment, then replace
-        // that prefix with "/" in the input
-        // buffer; otherwise,
-        if (s.starts_with("/./"))
+        // each output char is scanned
+        // at most once, since the
+        // segment is then discarded
+        if(--nout == 0)
         {
-            s.remove_prefix(2);
-            continue;
+            dest = first;
+            return;
         }
-        if (s == "/.")
+        while(*--dest != '/')
         {
-            // equivalent to replacing s with '/'
-            // and executing the next iteration
-            append(s.substr(0, 1));
-            s.remove_prefix(2);
-            continue;
         }
+    };
 
-        // C. if the input buffer begins with a
-        // prefix of "/../" or "/..", where ".."
-        // is a complete path segment, then
-        // replace that prefix with "/" in the
-        // input buffer and remove the last
-        // segment and its preceding "/"
-        // (if any) from the output buffer;
-        // otherwise,
-        if (s.starts_with("/../"))
+    for(std::size_t i = 0; i < nseg; ++i)
+    {
+        char const* end = static_cast<
+            char const*>(std::memchr(
+                it, '/', last - it));
+        if(! end)
+            end = last;
+        BOOST_ASSERT(
+            (i + 1 == nseg) == (end == last));
+        std::size_t const len = end - it;
+        char const* const p = it;
+        it = end == last ? last : end + 1;
+        if( len == 1 &&
+            p[0] == '.')
         {
-            std::size_t p = find_last_slash();
-            if (p != string_view::npos)
-                // "erase" [p, end]
-                dest = dest0 + p;
-            else if (!remove_unmatched)
-                append(s.substr(0, 3));
-            s.remove_prefix(3);
+            // a trailing "." leaves
+            // an empty segment
+            if(i + 1 == nseg)
+                push(p, 0);
             continue;
         }
-        if (s == "/..")
+        if( len == 2 &&
+            p[0] == '.' &&
+            p[1] == '.')
         {
-            std::size_t p = find_last_slash();
-            if (p != string_view::npos)
+            if( n == 0 &&
+                ! remove_unmatched)
             {
-                // erase [p, end]
-                dest = dest0 + p;
-                // equivalent to replacing s with '/'
-                // and executing the next iteration.
-                // this is the only point that would
-                // require input memory allocations
-                // in remove_dot_segments
-                append(s.substr(0, 1));
+                // Errata 4547
+                push(p, len);
+                continue;
             }
-            else if (remove_unmatched)
-                append(s.substr(0, 1));
-            else
-                append(s.substr(0, 3));
-            s.remove_prefix(3);
+            if(n == 0)
+            {
+                // nothing to remove
+                if( i + 1 == nseg &&
+                    nout > 0)
+                    push(p, 0);
+                continue;
+            }
+            pop();
+            --n;
+            if( i + 1 == nseg &&
+                nout > 0)
+                push(p, 0);
             continue;
         }
+        push(p, len);
+        ++n;
+    }
+    nseg = nout;
+    return dest - first;
+}
 
-        // E.  move the first path segment in the
-        // input buffer to the end of the output
-        // buffer, including the initial "/"
-        // character (if any) and any subsequent
-        // characters up to, but not including,
-        // the next "/" character or the end of
-        // the input buffer.
-        std::size_t p = s.find_first_of('/', 1);
-        if (p != string_view::npos)
-        {
-            append(s.substr(0, p));
-            s.remove_prefix(p);
-        }
-        else
-        {
-            append(s);
-            s = {};
-        }
+std::size_t
+remove_dot_segments(
+    char* s,
+    url_impl& u,
+    bool remove_unmatched) noexcept
+{
+    // segments follow the malleable prefix
+    char* const p =
+        s + u.offset(url_impl::id_path);
+    std::size_t const pn =
+        u.len(url_impl::id_path);
+    std::size_t const pre = path_prefix(
+        string_view(p, pn));
+    // "./" and "/./" are dot segments
+    // too, when not needed as a prefix
+    if( pre < 2 &&
+        ! has_dot_segments(
+            string_view(p + pre, pn - pre)))
+        return u.offset(url_impl::id_end);
+    std::size_t nseg = u.nseg_;
+    std::size_t const n = remove_dot_segments(
+        p + pre, p + pn, nseg,
+        remove_unmatched);
+    // a lone empty segment is
+    // just the prefix, if any
+    if( n == 0 &&
+        nseg == 1)
+        nseg = 0;
+    string_view const front(p + pre,
+        std::find(p + pre, p + pre + n, '/') -
+            (p + pre));
+
+    // choose the shortest prefix
+    // which keeps the path valid
+    bool const abs =
+        pn > 0 && p[0] == '/';
+    std::size_t np;
+    if(u.len(url_impl::id_user) > 0)
+    {
+        // authority: path-abempty
+        np = (abs || nseg > 0) ? 1 : 0;
+    }
+    else if(
+        nseg > 1 &&
+        front.empty())
+    {
+        // avoid "//", which
+        // starts an authority
+        np = 3;
+    }
+    else if(
+        ! abs &&
+        u.len(url_impl::id_scheme) == 0 &&
+        nseg > 0 &&
+        (front.empty() ||
+            front.find_first_of(':') !=
+                string_view::npos))
+    {
+        // path-noscheme
+        np = 2;
+    }
+    else
+    {
+        np = abs ? 1 : 0;
     }
 
-    // 3. Finally, the output buffer is returned
-    // as the result of remove_dot_segments.
-    return dest - dest0;
+    // np is the size of a suffix of "/./"
+    std::size_t const new_len = np + n;
+    BOOST_ASSERT(new_len <= pn);
+    move_chars(p + np, p + pre, n);
+    std::memcpy(p, "/./" + 3 - np, np);
+    move_chars(p + new_len, p + pn,
+        u.len(url_impl::id_query,
+            url_impl::id_end));
+    u.set_size(url_impl::id_path, new_len);
+    u.nseg_ = nseg;
+    u.decoded_[url_impl::id_path] =
+        pct_decode_bytes_unchecked(
+            string_view(p, new_len));
+    return u.offset(url_impl::id_end);
 }
 
 char
@@ -0,0 +1,456 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_DETAIL_IMPL_ROUTE_DFA_IPP
+#define BOOST_URL_DETAIL_IMPL_ROUTE_DFA_IPP
+
+#include <boost/url/detail/route_dfa.hpp>
+#include <boost/url/detail/router.hpp>
+#include <boost/url/router.hpp>
+#include <boost/url/detail/path.hpp>
+#include <boost/url/grammar/hexdig_chars.hpp>
+#include <boost/assert.hpp>
+#include <algorithm>
+#include <cstring>
+#include <map>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+namespace {
+
+// symbol of an unescaped '/'
+constexpr std::uint16_t sep_sym = 256;
+
+// Nondeterministic automaton with one
+// chain of states per node of the tree
+struct route_nfa
+{
+    enum kind
+    {
+        // match sym
+        lit,
+
+        // match any byte
+        any,
+
+        // end of a segment
+        end,
+
+        // match the rest
+        wild
+    };
+
+    struct state
+    {
+        kind k;
+        std::uint16_t sym = 0;
+        std::uint32_t next = 0;
+
+        // end of a param, which
+        // loops on any byte
+        bool loop = false;
+
+        // next states after a separator
+        std::vector<std::uint32_t> out;
+
+        // priority on end of input
+        std::size_t acc = string_view::npos;
+    };
+
+    std::vector<state> v;
+
+    std::uint32_t
+    add(kind k)
+    {
+        state x;
+        x.k = k;
+        v.push_back(std::move(x));
+        return static_cast<
+            std::uint32_t>(v.size() - 1);
+    }
+};
+
+// Append the symbols of an encoded
+// literal label to v
+void
+label_symbols(
+    string_view s,
+    std::vector<std::uint16_t>& v)
+{
+    auto p = s.data();
+    auto const end = p + s.size();
+    while(p != end)
+    {
+        if(*p == '/')
+        {
+            v.push_back(sep_sym);
+            ++p;
+            continue;
+        }
+        if(*p == '%')
+        {
+            // validated by router_base
+            BOOST_ASSERT(end - p >= 3);
+            v.push_back(static_cast<std::uint16_t>(
+                (grammar::hexdig_value(p[1]) << 4) +
+                    grammar::hexdig_value(p[2])));
+            p += 3;
+            continue;
+        }
+        v.push_back(static_cast<
+            unsigned char>(*p));
+        ++p;
+    }
+}
+
+} // (anon)
+
+constexpr std::size_t route_dfa::npos;
+
+route_dfa::
+route_dfa(
+    router_base const& r)
+{
+    auto const& nodes = r.nodes_;
+    std::size_t const npos_ = npos;
+
+    // kind of each tree node
+    std::vector<route_nfa::kind> kinds(
+        nodes.size(), route_nfa::end);
+    std::size_t nid = 0;
+    for(auto const& nd : nodes)
+    {
+        if(nd.param != npos)
+            kinds[nd.param] = route_nfa::any;
+        if(nd.wild != npos)
+            kinds[nd.wild] = route_nfa::wild;
+        if(nd.id != npos)
+            nid = (std::max)(nid, nd.id + 1);
+    }
+
+    // rank and captures of each route,
+    // literals before params before the
+    // wildcard, one segment at a time
+    std::vector<std::string> rank(nid);
+    caps_.resize(nid);
+    {
+        struct item
+        {
+            std::size_t n;
+            std::size_t depth;
+            std::string rank;
+            std::vector<capture> caps;
+        };
+        std::vector<item> st;
+        st.push_back({0, 0, {}, {}});
+        while(! st.empty())
+        {
+            item it = std::move(st.back());
+            st.pop_back();
+            auto const& nd = nodes[it.n];
+            if(nd.id != npos)
+            {
+                rank[nd.id] = it.rank;
+                if(kinds[it.n] != route_nfa::wild)
+                    rank[nd.id].push_back('/');
+                caps_[nd.id] = it.caps;
+            }
+            for(auto i : nd.literals)
+            {
+                item x{i,
+                    it.depth + nodes[i].nlabel,
+                    it.rank, it.caps};
+                x.rank.append(nodes[i].nlabel, '0');
+                st.push_back(std::move(x));
+            }
+            if(nd.param != npos)
+            {
+                item x{nd.param, it.depth + 1,
+                    it.rank + '1', it.caps};
+                x.caps.push_back({it.depth,
+                    nodes[nd.param].label, false});
+                st.push_back(std::move(x));
+            }
+            if(nd.wild != npos)
+            {
+                item x{nd.wild, it.depth,
+                    it.rank + '2', it.caps};
+                x.caps.push_back({it.depth, "*", true});
+                st.push_back(std::move(x));
+            }
+        }
+    }
+
+    // priority of each route id
+    std::vector<std::size_t> order(nid);
+    for(std::size_t i = 0; i < nid; ++i)
+        order[i] = i;
+    std::sort(order.begin(), order.end(),
+        [&rank](std::size_t a, std::size_t b)
+        {
+            if(rank[a] != rank[b])
+                return rank[a] < rank[b];
+            return a < b;
+        });
+    std::vector<std::size_t> prio(nid, npos);
+    for(std::size_t i = 0; i < nid; ++i)
+        prio[order[i]] = i;
+    auto const prio_of =
+        [&prio, npos_](std::size_t id)
+    {
+        return id == npos_ ? npos_ : prio[id];
+    };
+
+    // one end state per tree node, with
+    // a chain of states leading to it
+    route_nfa nfa;
+    bool used[256] = {};
+    std::vector<std::uint32_t> ends(nodes.size());
+    std::vector<std::uint32_t> starts(nodes.size());
+    std::vector<std::uint16_t> syms;
+    for(std::size_t n = 0; n < nodes.size(); ++n)
+    {
+        auto const k = kinds[n];
+        ends[n] = nfa.add(k == route_nfa::wild ?
+            route_nfa::wild : route_nfa::end);
+        if(k == route_nfa::any)
+        {
+            nfa.v[ends[n]].loop = true;
+            auto const s = nfa.add(route_nfa::any);
+            nfa.v[s].next = ends[n];
+            starts[n] = s;
+            continue;
+        }
+        if(k == route_nfa::wild)
+        {
+            starts[n] = ends[n];
+            continue;
+        }
+        syms.clear();
+        label_symbols(nodes[n].label, syms);
+        std::uint32_t next = ends[n];
+        for(auto it = syms.rbegin();
+            it != syms.rend(); ++it)
+        {
+            auto const s = nfa.add(route_nfa::lit);
+            nfa.v[s].sym = *it;
+            nfa.v[s].next = next;
+            if(*it != sep_sym)
+                used[*it] = true;
+            next = s;
+        }
+        starts[n] = next;
+    }
+    for(std::size_t n = 0; n < nodes.size(); ++n)
+    {
+        auto const& nd = nodes[n];
+        auto& e = nfa.v[ends[n]];
+        for(auto i : nd.literals)
+            e.out.push_back(starts[i]);
+        if(nd.param != npos)
+            e.out.push_back(starts[nd.param]);
+        e.acc = prio_of(nd.id);
+        if(nd.wild != npos)
+        {
+            e.out.push_back(starts[nd.wild]);
+            // the rest may be empty
+            e.acc = (std::min)(e.acc,
+                prio_of(nodes[nd.wild].id));
+        }
+    }
+    {
+        auto const acc0 = nfa.v[ends[0]].acc;
+        accept0_ = acc0 == npos ?
+            npos : order[acc0];
+    }
+
+    // byte classes: the separator, bytes
+    // in no literal, then one class for
+    // each byte in a literal
+    nclass_ = 2;
+    for(std::size_t b = 0; b < 256; ++b)
+    {
+        if(used[b])
+            cls_[b] = static_cast<
+                std::uint16_t>(nclass_++);
+        else
+            cls_[b] = 1;
+        raw_[b] = cls_[b];
+    }
+    raw_[static_cast<unsigned char>('/')] = 0;
+    esc_ = static_cast<std::uint16_t>(nclass_);
+    raw_[static_cast<unsigned char>('%')] = esc_;
+
+    // subset construction
+    using set_type = std::vector<std::uint32_t>;
+    std::map<set_type, std::uint32_t> ids;
+    std::vector<set_type> sets;
+    auto const lookup = [&ids, &sets](set_type& s)
+    {
+        std::sort(s.begin(), s.end());
+        s.erase(std::unique(
+            s.begin(), s.end()), s.end());
+        auto const it = ids.find(s);
+        if(it != ids.end())
+            return it->second;
+        auto const id = static_cast<
+            std::uint32_t>(sets.size());
+        ids.emplace(s, id);
+        sets.push_back(s);
+        return id;
+    };
+    {
+        set_type dead;
+        lookup(dead);
+        set_type s = nfa.v[ends[0]].out;
+        start_ = lookup(s);
+    }
+    next_.assign(nclass_, 0);
+    accept_.assign(1, npos);
+    std::vector<set_type> t(nclass_);
+    set_type any;
+    for(std::size_t s = 1; s < sets.size(); ++s)
+    {
+        for(auto& x : t)
+            x.clear();
+        any.clear();
+        std::size_t acc = npos;
+        for(auto i : sets[s])
+        {
+            auto const& x = nfa.v[i];
+            switch(x.k)
+            {
+            case route_nfa::lit:
+                if(x.sym == sep_sym)
+                    t[0].push_back(x.next);
+                else
+                    t[cls_[x.sym]].push_back(x.next);
+                break;
+
+            case route_nfa::any:
+                any.push_back(x.next);
+                break;
+
+            case route_nfa::end:
+                if(x.loop)
+                    any.push_back(i);
+                t[0].insert(t[0].end(),
+                    x.out.begin(), x.out.end());
+                acc = (std::min)(acc, x.acc);
+                break;
+
+            case route_nfa::wild:
+                any.push_back(i);
+                t[0].push_back(i);
+                acc = (std::min)(acc, x.acc);
+                break;
+            }
+        }
+        for(std::size_t c = 0; c < nclass_; ++c)
+        {
+            if(c > 0)
+                t[c].insert(t[c].end(),
+                    any.begin(), any.end());
+            next_.push_back(lookup(t[c]));
+        }
+        accept_.push_back(
+            acc == npos ? npos : order[acc]);
+    }
+}
+
+std::size_t
+route_dfa::
+find(
+    string_view path,
+    route_match& m) const noexcept
+{
+    auto const pre = path_prefix(path);
+    path.remove_prefix(pre);
+    m.n_ = 0;
+    std::size_t id;
+    if( path.empty() &&
+        pre < 2)
+    {
+        // no segments
+        id = accept0_;
+    }
+    else
+    {
+        auto p = path.data();
+        auto const end =
+            p + path.size();
+        std::uint32_t s = start_;
+        while(p != end)
+        {
+            std::uint16_t k = raw_[
+                static_cast<unsigned char>(*p++)];
+            if(k == esc_)
+            {
+                k = cls_[static_cast<
+                    unsigned char>('%')];
+                if(end - p >= 2)
+                {
+                    auto const d0 =
+                        grammar::hexdig_value(p[0]);
+                    auto const d1 =
+                        grammar::hexdig_value(p[1]);
+                    if(d0 >= 0 && d1 >= 0)
+                    {
+                        k = cls_[(d0 << 4) + d1];
+                        p += 2;
+                    }
+                }
+            }
+            s = next_[s * nclass_ + k];
+            if(s == 0)
+                return npos;
+        }
+        id = accept_[s];
+    }
+    if(id == npos)
+        return npos;
+
+    // walk the segments for the captures
+    auto p = path.data();
+    auto const end = p + path.size();
+    std::size_t seg = 0;
+    for(auto const& c : caps_[id])
+    {
+        while(seg < c.seg)
+        {
+            auto const q = static_cast<
+                char const*>(std::memchr(
+                    p, '/', end - p));
+            p = q ? q + 1 : end;
+            ++seg;
+        }
+        char const* e = end;
+        if(! c.wild)
+        {
+            auto const q = static_cast<
+                char const*>(std::memchr(
+                    p, '/', end - p));
+            if(q)
+                e = q;
+        }
+        m.names_[m.n_] = c.name;
+        m.values_[m.n_] = string_view(
+            p, e - p);
+        ++m.n_;
+    }
+    return id;
+}
+
+} // detail
+} // urls
+} // boost
+
+#endif
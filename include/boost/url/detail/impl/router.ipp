@@ -0,0 +1,422 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_DETAIL_IMPL_ROUTER_IPP
+#define BOOST_URL_DETAIL_IMPL_ROUTER_IPP
+
+#include <boost/url/detail/router.hpp>
+#include <boost/url/router.hpp>
+#include <boost/url/pct_encoding.hpp>
+#include <boost/url/segments_encoded_view.hpp>
+#include <boost/url/detail/except.hpp>
+#include <boost/url/detail/normalize.hpp>
+#include <boost/url/detail/path.hpp>
+#include <boost/url/detail/query_split.hpp>
+#include <boost/url/rfc/pchars.hpp>
+#include <boost/assert.hpp>
+#include <algorithm>
+#include <cstring>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+namespace {
+
+bool
+is_param(string_view s) noexcept
+{
+    return
+        s.size() > 2 &&
+        s.front() == '{' &&
+        s.back() == '}';
+}
+
+bool
+is_plain(string_view s) noexcept
+{
+    char const* const end =
+        s.data() + s.size();
+    return find_key_escape(
+        s.data(), end, false) == end;
+}
+
+// Return the first segment of s
+string_view
+first_segment(string_view s) noexcept
+{
+    auto const pos = s.find('/');
+    if(pos == string_view::npos)
+        return s;
+    return s.substr(0, pos);
+}
+
+// Return the end of the segment at p
+char const*
+segment_end(
+    char const* p,
+    char const* end) noexcept
+{
+    if(p == end)
+        return end;
+    auto const q = static_cast<char const*>(
+        std::memchr(p, '/', end - p));
+    return q ? q : end;
+}
+
+} // (anon)
+
+router_base::
+router_base()
+    : nodes_(1)
+{
+}
+
+std::size_t
+router_base::
+add_literal(
+    std::size_t n,
+    string_view const* segs,
+    std::size_t count)
+{
+    while(count > 0)
+    {
+        std::size_t c = npos;
+        for(auto i : nodes_[n].literals)
+        {
+            // the same comparison as
+            // match_label, so routes
+            // which match alike share
+            // a node
+            if(compare_encoded(
+                first_segment(
+                    nodes_[i].label),
+                segs[0]) == 0)
+            {
+                c = i;
+                break;
+            }
+        }
+
+        if(c == npos)
+        {
+            node x;
+            for(std::size_t i = 0; i < count; ++i)
+            {
+                if(i > 0)
+                    x.label.push_back('/');
+                x.label.append(
+                    segs[i].data(), segs[i].size());
+            }
+            x.nlabel = count;
+            x.plain = is_plain(x.label);
+            nodes_.push_back(std::move(x));
+            nodes_[n].literals.push_back(
+                nodes_.size() - 1);
+            return nodes_.size() - 1;
+        }
+
+        // number of leading
+        // segments in common
+        std::size_t k = 0;
+        std::size_t pos = 0;
+        {
+            string_view const label =
+                nodes_[c].label;
+            while(
+                k < count &&
+                k < nodes_[c].nlabel)
+            {
+                auto e = label.find('/', pos);
+                if(e == string_view::npos)
+                    e = label.size();
+                if(compare_encoded(
+                    label.substr(pos, e - pos),
+                    segs[k]) != 0)
+                    break;
+                ++k;
+                pos = e + 1;
+            }
+        }
+        BOOST_ASSERT(k > 0);
+
+        if(k < nodes_[c].nlabel)
+        {
+            // split the node
+            node tail;
+            tail.label = nodes_[c].label.substr(pos);
+            tail.nlabel = nodes_[c].nlabel - k;
+            tail.plain = is_plain(tail.label);
+            tail.literals = std::move(nodes_[c].literals);
+            tail.param = nodes_[c].param;
+            tail.wild = nodes_[c].wild;
+            tail.id = nodes_[c].id;
+            nodes_.push_back(std::move(tail));
+            node& head = nodes_[c];
+            head.label.resize(pos - 1);
+            head.nlabel = k;
+            head.plain = is_plain(head.label);
+            head.literals.assign(
+                1, nodes_.size() - 1);
+            head.param = npos;
+            head.wild = npos;
+            head.id = npos;
+        }
+        n = c;
+        segs += k;
+        count -= k;
+    }
+    return n;
+}
+
+void
+router_base::
+insert(
+    string_view pattern,
+    std::size_t id)
+{
+    // split the pattern into segments
+    std::vector<string_view> segs;
+    if(! pattern.empty() &&
+        pattern.front() == '/')
+        pattern.remove_prefix(1);
+    if(! pattern.empty())
+    {
+        for(;;)
+        {
+            auto const pos = pattern.find('/');
+            segs.push_back(pattern.substr(0, pos));
+            if(pos == string_view::npos)
+                break;
+            pattern.remove_prefix(pos + 1);
+        }
+    }
+
+    // validate
+    std::size_t nparam = 0;
+    for(std::size_t i = 0; i < segs.size(); ++i)
+    {
+        string_view const s = segs[i];
+        if(s == "*")
+        {
+            if(i + 1 != segs.size())
+                throw_invalid_argument(
+                    "wildcard not last");
+            ++nparam;
+            continue;
+        }
+        if(is_param(s))
+        {
+            if(s.substr(1, s.size() - 2).find_first_of(
+                    "{}") != string_view::npos)
+                throw_invalid_argument(
+                    "bad route param");
+            ++nparam;
+            continue;
+        }
+        error_code ec;
+        validate_pct_encoding(s, ec, pchars);
+        if(ec.failed())
+            throw_invalid_argument(
+                "bad route segment");
+    }
+    if(nparam > route_match::max_size)
+        throw_invalid_argument(
+            "too many route params");
+
+    // walk the tree, adding nodes
+    std::size_t n = 0;
+    std::size_t i = 0;
+    while(i < segs.size())
+    {
+        string_view const s = segs[i];
+        if(s == "*")
+        {
+            if(nodes_[n].wild == npos)
+            {
+                node x;
+                x.label = "*";
+                nodes_.push_back(std::move(x));
+                nodes_[n].wild = nodes_.size() - 1;
+            }
+            n = nodes_[n].wild;
+            ++i;
+            continue;
+        }
+        if(is_param(s))
+        {
+            string_view const name =
+                s.substr(1, s.size() - 2);
+            if(nodes_[n].param == npos)
+            {
+                node x;
+                x.label = std::string(
+                    name.data(), name.size());
+                nodes_.push_back(std::move(x));
+                nodes_[n].param = nodes_.size() - 1;
+            }
+            else if(nodes_[nodes_[n].param].label != name)
+            {
+                throw_invalid_argument(
+                    "route param name conflict");
+            }
+            n = nodes_[n].param;
+            ++i;
+            continue;
+        }
+        std::size_t j = i + 1;
+        while(
+            j < segs.size() &&
+            segs[j] != "*" &&
+            ! is_param(segs[j]))
+            ++j;
+        n = add_literal(n, &segs[i], j - i);
+        i = j;
+    }
+    if(nodes_[n].id != npos)
+        throw_invalid_argument(
+            "duplicate route");
+    nodes_[n].id = id;
+}
+
+bool
+router_base::
+match_label(
+    node const& nd,
+    cursor& c) const noexcept
+{
+    if(c.n < nd.nlabel)
+        return false;
+    if(c.plain && nd.plain)
+    {
+        std::size_t const len =
+            nd.label.size();
+        if(static_cast<std::size_t>(
+                c.end - c.p) < len)
+            return false;
+        if( len > 0 &&
+            std::memcmp(c.p,
+                nd.label.data(), len) != 0)
+            return false;
+        char const* const q = c.p + len;
+        if(c.n == nd.nlabel)
+        {
+            if(q != c.end)
+                return false;
+            c.p = q;
+            c.n = 0;
+            return true;
+        }
+        if(*q != '/')
+            return false;
+        c.p = q + 1;
+        c.n -= nd.nlabel;
+        return true;
+    }
+
+    // compare one segment at a time
+    string_view label = nd.label;
+    for(std::size_t i = 0;
+        i < nd.nlabel; ++i)
+    {
+        string_view const s =
+            first_segment(label);
+        char const* const e =
+            segment_end(c.p, c.end);
+        if(compare_encoded(s, string_view(
+            c.p, e - c.p)) != 0)
+            return false;
+        label.remove_prefix((std::min)(
+            s.size() + 1, label.size()));
+        --c.n;
+        c.p = c.n > 0 ? e + 1 : e;
+    }
+    return true;
+}
+
+std::size_t
+router_base::
+match(
+    std::size_t n,
+    cursor c,
+    route_match& m) const noexcept
+{
+    node const& nd = nodes_[n];
+    if( c.n == 0 &&
+        nd.id != npos)
+        return nd.id;
+
+    for(auto i : nd.literals)
+    {
+        cursor c1 = c;
+        if(! match_label(nodes_[i], c1))
+            continue;
+        auto const r = match(i, c1, m);
+        if(r != npos)
+            return r;
+    }
+
+    if( nd.param != npos &&
+        c.n > 0)
+    {
+        char const* const e =
+            segment_end(c.p, c.end);
+        if(e != c.p)
+        {
+            std::size_t const k = m.n_++;
+            m.names_[k] = nodes_[nd.param].label;
+            m.values_[k] = string_view(
+                c.p, e - c.p);
+            cursor c1 = c;
+            --c1.n;
+            c1.p = c1.n > 0 ? e + 1 : e;
+            auto const r = match(nd.param, c1, m);
+            if(r != npos)
+                return r;
+            m.n_ = k;
+        }
+    }
+
+    if(nd.wild != npos)
+    {
+        node const& w = nodes_[nd.wild];
+        if(w.id != npos)
+        {
+            std::size_t const k = m.n_++;
+            m.names_[k] = w.label;
+            m.values_[k] = string_view(
+                c.p, c.end - c.p);
+            return w.id;
+        }
+    }
+    return npos;
+}
+
+std::size_t
+router_base::
+find(
+    segments_encoded_view const& path,
+    route_match& m) const noexcept
+{
+    string_view s = path.s_;
+    s.remove_prefix(path_prefix(s));
+    m.n_ = 0;
+    cursor c;
+    c.p = s.data();
+    c.end = s.data() + s.size();
+    c.n = path.n_;
+    c.plain = is_plain(s);
+    return match(0, c, m);
+}
+
+} // detail
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,125 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_DETAIL_IMPL_SEGMENTS_INDEX_IPP
+#define BOOST_URL_DETAIL_IMPL_SEGMENTS_INDEX_IPP
+
+#include <boost/url/detail/segments_index.hpp>
+#include <boost/url/detail/path.hpp>
+#include <boost/core/bit.hpp>
+#include <cstring>
+
+#ifdef BOOST_URL_USE_SSE2
+# include <emmintrin.h>
+#endif
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+void
+segments_index_impl::
+build()
+{
+    if(n_ == 0)
+        return;
+    char const* const first = s_.data();
+    char const* const last =
+        first + s_.size();
+    char const* p = first;
+    std::size_t k = 0;
+    off_[k++] = 0;
+
+#ifdef BOOST_URL_USE_SSE2
+    __m128i const slash = _mm_set1_epi8('/');
+    while(last - p >= 16)
+    {
+        __m128i const v = _mm_loadu_si128(
+            reinterpret_cast<__m128i const*>(p));
+        unsigned m = static_cast<unsigned>(
+            _mm_movemask_epi8(
+                _mm_cmpeq_epi8(v, slash)));
+        while(m)
+        {
+            BOOST_ASSERT(k < n_);
+            off_[k++] = (p - first) +
+                boost::core::countr_zero(m) + 1;
+            m &= m - 1;
+        }
+        p += 16;
+    }
+#endif
+
+    for(; p != last; ++p)
+    {
+        if(*p != '/')
+            continue;
+        BOOST_ASSERT(k < n_);
+        off_[k++] = (p - first) + 1;
+    }
+    BOOST_ASSERT(k == n_);
+    off_[n_] = s_.size() + 1;
+}
+
+segments_index_impl::
+segments_index_impl(
+    string_view path,
+    std::size_t nseg)
+    : s_(path.substr(
+        path_prefix(path)))
+    , n_(nseg)
+{
+    if(n_ + 1 > inline_size)
+        off_ = new std::size_t[n_ + 1];
+    build();
+}
+
+segments_index_impl::
+segments_index_impl(
+    segments_index_impl const& other)
+    : s_(other.s_)
+    , n_(other.n_)
+{
+    if(n_ + 1 > inline_size)
+        off_ = new std::size_t[n_ + 1];
+    std::memcpy(off_, other.off_,
+        (n_ + 1) * sizeof(std::size_t));
+}
+
+segments_index_impl&
+segments_index_impl::
+operator=(segments_index_impl const& other)
+{
+    if(this == &other)
+        return *this;
+    std::size_t* off = buf_;
+    if(other.n_ + 1 > inline_size)
+        off = new std::size_t[other.n_ + 1];
+    std::memcpy(off, other.off_,
+        (other.n_ + 1) * sizeof(std::size_t));
+    if(off_ != buf_)
+        delete[] off_;
+    off_ = off;
+    s_ = other.s_;
+    n_ = other.n_;
+    return *this;
+}
+
+segments_index_impl::
+~segments_index_impl()
+{
+    if(off_ != buf_)
+        delete[] off_;
+}
+
+} // detail
+} // urls
+} // boost
+
+#endif
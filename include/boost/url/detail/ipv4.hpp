@@ -0,0 +1,38 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_DETAIL_IPV4_HPP
+#define BOOST_URL_DETAIL_IPV4_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/grammar/error.hpp>
+#include <cstdint>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+// Parse a dotted-quad at it, as the
+// dec-octets of ipv4_address_rule, and
+// store the address in host order to v.
+// On error, ev is set to the error of
+// the rule and it is unchanged.
+BOOST_URL_DECL
+bool
+parse_ipv4(
+    char const*& it,
+    char const* end,
+    std::uint32_t& v,
+    grammar::error& ev) noexcept;
+
+} // detail
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,38 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_DETAIL_IPV6_HPP
+#define BOOST_URL_DETAIL_IPV6_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/grammar/error.hpp>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+// Parse an IPv6address at it, as in
+// ipv6_address_rule, including "::"
+// and a trailing IPv4address, and
+// store the 16 bytes to dest. On
+// error, ev is set to the error of
+// the rule and it is unchanged.
+BOOST_URL_DECL
+bool
+parse_ipv6(
+    char const*& it,
+    char const* end,
+    unsigned char* dest,
+    grammar::error& ev) noexcept;
+
+} // detail
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,124 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_DETAIL_PARAMS_INDEX_HPP
+#define BOOST_URL_DETAIL_PARAMS_INDEX_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/string_view.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+struct params_index_slot
+{
+    // hash of the decoded key
+    std::size_t hash;
+
+    // offset of the element in the
+    // query, or npos when empty
+    std::size_t pos;
+
+    // index of the element
+    std::size_t i;
+};
+
+// Open-addressing table of the keys in
+// an encoded query, built in one pass.
+// Linear probing keeps the elements
+// with the same key in query order.
+class params_index_impl
+{
+    static
+    constexpr
+    std::size_t
+    npos = string_view::npos;
+
+    static
+    constexpr
+    std::size_t
+    table_size(
+        std::size_t n,
+        std::size_t m) noexcept
+    {
+        return m >= 2 * n ? m :
+            table_size(n, 2 * m);
+    }
+
+public:
+    string_view s_;
+    std::size_t n_ = 0;
+    params_index_slot* t_ = nullptr;
+    std::size_t mask_ = 0;
+
+    // number of slots for n elements,
+    // keeping the load at most one half
+    static
+    constexpr
+    std::size_t
+    table_size(std::size_t n) noexcept
+    {
+        return n == 0 ? 0 :
+            table_size(n, 1);
+    }
+
+    // Build the table in storage. When
+    // plus is true, '+' in a key is
+    // hashed as a space.
+    BOOST_URL_DECL
+    params_index_impl(
+        string_view s,
+        std::size_t n,
+        bool plus,
+        void* storage,
+        std::size_t size);
+
+    // hash of a plain key
+    BOOST_URL_DECL
+    static
+    std::size_t
+    hash(string_view key) noexcept;
+
+    // hash of a percent-encoded key,
+    // as if it were decoded
+    BOOST_URL_DECL
+    static
+    std::size_t
+    hash_encoded(
+        string_view key,
+        bool plus) noexcept;
+
+    // Return the first slot at or after j
+    // in the probe sequence whose hash
+    // is h, or npos. Use j = h to start.
+    std::size_t
+    probe(
+        std::size_t h,
+        std::size_t j) const noexcept
+    {
+        if(n_ == 0)
+            return npos;
+        j &= mask_;
+        while(t_[j].pos != npos)
+        {
+            if(t_[j].hash == h)
+                return j;
+            j = (j + 1) & mask_;
+        }
+        return npos;
+    }
+};
+
+} // detail
+} // urls
+} // boost
+
+#endif
@@ -46,6 +46,14 @@ struct params_iterator_impl
         std::size_t nparam,
         int) noexcept;
 
+    // element ctor, where pos is the
+    // offset of the i-th element
+    BOOST_URL_DECL
+    params_iterator_impl(
+        string_view s,
+        std::size_t i,
+        std::size_t pos) noexcept;
+
     params_iterator_impl() = default;
 
     params_iterator_impl(
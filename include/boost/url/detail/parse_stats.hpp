@@ -0,0 +1,65 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_DETAIL_PARSE_STATS_HPP
+#define BOOST_URL_DETAIL_PARSE_STATS_HPP
+
+#include <boost/url/parse_stats.hpp>
+#include <boost/url/result.hpp>
+#include <boost/url/string_view.hpp>
+
+namespace boost {
+namespace urls {
+
+class authority_view;
+class params_encoded_view;
+class segments_encoded_view;
+class url_view;
+
+namespace detail {
+
+BOOST_URL_DECL
+parse_stats&
+thread_parse_stats_ref() noexcept;
+
+#ifdef BOOST_URL_PARSE_STATS
+BOOST_URL_DECL void record_parse(string_view,
+    result<url_view> const&) noexcept;
+BOOST_URL_DECL void record_parse(string_view,
+    result<authority_view> const&) noexcept;
+BOOST_URL_DECL void record_parse(string_view,
+    result<params_encoded_view> const&) noexcept;
+BOOST_URL_DECL void record_parse(string_view,
+    result<segments_encoded_view> const&) noexcept;
+#endif
+
+// Count the result of parsing s, when
+// BOOST_URL_PARSE_STATS is defined. The
+// macro must be the same in the library
+// and in every file which includes it.
+template<class T>
+inline
+void
+count_parse(
+    string_view s,
+    result<T> const& rv) noexcept
+{
+#ifdef BOOST_URL_PARSE_STATS
+    record_parse(s, rv);
+#else
+    (void)s;
+    (void)rv;
+#endif
+}
+
+} // detail
+} // urls
+} // boost
+
+#endif
@@ -27,6 +27,15 @@ struct access
         string_view s,
         std::size_t n,
         pct_decode_opts const& opt = {}) noexcept;
+
+    // the same view of chars
+    // which were moved by d
+    BOOST_URL_DECL
+    static
+    pct_encoded_view
+    rebase(
+        pct_encoded_view s,
+        std::ptrdiff_t d) noexcept;
 };
 
 } // detail
@@ -0,0 +1,344 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_DETAIL_QUERY_SCHEMA_HPP
+#define BOOST_URL_DETAIL_QUERY_SCHEMA_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/error_code.hpp>
+#include <boost/url/pct_encoded_view.hpp>
+#include <boost/url/result.hpp>
+#include <boost/url/string_view.hpp>
+#include <boost/url/detail/params_index.hpp>
+#include <boost/url/detail/query_split.hpp>
+#include <boost/url/grammar/error.hpp>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+//------------------------------------------------
+//
+// Values
+//
+//------------------------------------------------
+
+// Parse an unsigned decimal from the
+// encoded characters of a value
+BOOST_URL_DECL
+result<unsigned long long>
+parse_schema_unsigned(
+    string_view s,
+    unsigned long long max) noexcept;
+
+// Parse a decimal with an optional
+// leading '-' from the encoded
+// characters of a value
+BOOST_URL_DECL
+result<long long>
+parse_schema_signed(
+    string_view s,
+    long long min,
+    long long max) noexcept;
+
+// "1" or "true" are true, "0" or
+// "false" are false, and a key
+// without a value is true
+BOOST_URL_DECL
+result<bool>
+parse_schema_bool(
+    string_view s,
+    bool has_value) noexcept;
+
+// Converts the encoded value of a
+// param to a field of a schema
+struct schema_value
+{
+    error_code
+    operator()(
+        bool& v,
+        string_view s,
+        bool has_value) const noexcept
+    {
+        auto rv = parse_schema_bool(
+            s, has_value);
+        if(! rv)
+            return rv.error();
+        v = *rv;
+        return {};
+    }
+
+    error_code
+    operator()(
+        string_view& v,
+        string_view s,
+        bool) const noexcept
+    {
+        v = s;
+        return {};
+    }
+
+    error_code
+    operator()(
+        pct_encoded_view& v,
+        string_view s,
+        bool) const noexcept
+    {
+        v = pct_encoded_view(s);
+        return {};
+    }
+
+    template<class I>
+    typename std::enable_if<
+        std::is_integral<I>::value &&
+        ! std::is_same<I, bool>::value,
+        error_code>::type
+    operator()(
+        I& v,
+        string_view s,
+        bool) const noexcept
+    {
+        return integer(v, s,
+            std::is_signed<I>{});
+    }
+
+private:
+    template<class I>
+    static
+    error_code
+    integer(
+        I& v,
+        string_view s,
+        std::false_type) noexcept
+    {
+        auto rv = parse_schema_unsigned(
+            s, (std::numeric_limits<I>::max)());
+        if(! rv)
+            return rv.error();
+        v = static_cast<I>(*rv);
+        return {};
+    }
+
+    template<class I>
+    static
+    error_code
+    integer(
+        I& v,
+        string_view s,
+        std::true_type) noexcept
+    {
+        auto rv = parse_schema_signed(s,
+            (std::numeric_limits<I>::min)(),
+            (std::numeric_limits<I>::max)());
+        if(! rv)
+            return rv.error();
+        v = static_cast<I>(*rv);
+        return {};
+    }
+};
+
+// Converts the encoded value of a
+// param to an enumerator by name
+template<class E>
+struct schema_enum
+{
+    std::pair<string_view, E> const* p;
+    std::size_t n;
+
+    error_code
+    operator()(
+        E& v,
+        string_view s,
+        bool) const noexcept
+    {
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            if(key_equal(s, p[i].first, true))
+            {
+                v = p[i].second;
+                return {};
+            }
+        }
+        BOOST_URL_RETURN_EC(
+            grammar::error::invalid);
+    }
+};
+
+template<class V, class Conv>
+error_code
+schema_put(
+    V& v,
+    string_view s,
+    bool has_value,
+    Conv const& conv)
+{
+    return conv(v, s, has_value);
+}
+
+// repeated values
+template<class V, class A, class Conv>
+error_code
+schema_put(
+    std::vector<V, A>& v,
+    string_view s,
+    bool has_value,
+    Conv const& conv)
+{
+    V x{};
+    auto const ec =
+        conv(x, s, has_value);
+    if(! ec)
+        v.push_back(x);
+    return ec;
+}
+
+// A key of a schema mapped to a
+// member of the destination
+template<class T, class M, class Conv>
+struct schema_field
+{
+    using object_type = T;
+
+    string_view key;
+    M T::* member;
+    Conv conv;
+
+    error_code
+    assign(
+        T& t,
+        string_view s,
+        bool has_value) const
+    {
+        return schema_put(
+            t.*member, s, has_value, conv);
+    }
+};
+
+//------------------------------------------------
+//
+// Keys
+//
+//------------------------------------------------
+
+// smallest b >= 1 with 2^b >= n
+constexpr
+unsigned
+schema_bits(
+    std::size_t n,
+    unsigned b = 1) noexcept
+{
+    return (std::size_t(1) << b) >= n ?
+        b : schema_bits(n, b + 1);
+}
+
+inline
+std::size_t
+schema_slot(
+    std::size_t h,
+    std::size_t seed,
+    unsigned bits) noexcept
+{
+#if BOOST_URL_ARCH == 64
+    std::size_t const k = static_cast<
+        std::size_t>(0x9E3779B97F4A7C15ULL);
+#else
+    std::size_t const k = static_cast<
+        std::size_t>(0x9E3779B9UL);
+#endif
+    return ((h ^ seed) * k) >>
+        (BOOST_URL_ARCH - bits);
+}
+
+// Search for a table size in [min_bits,
+// max_bits] and a seed which place the
+// hashes h[0, n) in distinct slots. When
+// there is none, the largest table is
+// filled with linear probing. Each slot
+// holds the index of its key plus one,
+// or zero.
+BOOST_URL_DECL
+void
+build_schema_table(
+    std::size_t const* h,
+    std::size_t n,
+    unsigned char* slots,
+    unsigned min_bits,
+    unsigned max_bits,
+    std::size_t& seed,
+    unsigned& bits) noexcept;
+
+// Perfect hash of the keys of a schema
+template<std::size_t N>
+class schema_table
+{
+    static constexpr unsigned min_bits =
+        schema_bits(2 * N);
+    static constexpr unsigned max_bits =
+        min_bits + 2;
+
+    std::size_t seed_ = 0;
+    unsigned bits_ = 0;
+    string_view k_[N];
+    std::size_t h_[N];
+    unsigned char slot_[
+        std::size_t(1) << max_bits];
+
+public:
+    static constexpr std::size_t npos =
+        std::size_t(-1);
+
+    explicit
+    schema_table(
+        string_view const (&keys)[N]) noexcept
+    {
+        for(std::size_t i = 0; i < N; ++i)
+        {
+            k_[i] = keys[i];
+            h_[i] = params_index_impl::hash(
+                keys[i]);
+        }
+        build_schema_table(h_, N, slot_,
+            min_bits, max_bits, seed_, bits_);
+    }
+
+    // Return the index of the encoded
+    // key ek, or npos
+    std::size_t
+    find(string_view ek) const noexcept
+    {
+        std::size_t const h =
+            params_index_impl::hash_encoded(
+                ek, true);
+        std::size_t const mask =
+            (std::size_t(1) << bits_) - 1;
+        std::size_t j =
+            schema_slot(h, seed_, bits_);
+        while(slot_[j] != 0)
+        {
+            std::size_t const i =
+                slot_[j] - 1u;
+            if( h_[i] == h &&
+                key_equal(ek, k_[i], true))
+                return i;
+            j = (j + 1) & mask;
+        }
+        return npos;
+    }
+};
+
+} // detail
+} // urls
+} // boost
+
+#endif
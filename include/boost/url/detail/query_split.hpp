@@ -0,0 +1,158 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_DETAIL_QUERY_SPLIT_HPP
+#define BOOST_URL_DETAIL_QUERY_SPLIT_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/string_view.hpp>
+#include <boost/core/bit.hpp>
+#include <cstddef>
+
+#ifdef BOOST_URL_USE_SSE2
+# include <emmintrin.h>
+#endif
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+// Return the first '&' in [first, last),
+// or last. eq is set to the first '='
+// before it, or to the returned value.
+BOOST_URL_DECL
+char const*
+find_param_end(
+    char const* first,
+    char const* last,
+    char const*& eq) noexcept;
+
+// Return the first '%' in [first, last),
+// or the first '+' too when plus is
+// true, or last.
+BOOST_URL_DECL
+char const*
+find_key_escape(
+    char const* first,
+    char const* last,
+    bool plus) noexcept;
+
+// Return true if the encoded key ek
+// decodes to the plain key. When plus
+// is true, '+' in ek decodes to space.
+BOOST_URL_DECL
+bool
+key_equal(
+    string_view ek,
+    string_view key,
+    bool plus) noexcept;
+
+// Return true if the encoded keys ek
+// and key are equal once decoded, as
+// by compare_encoded. plain is true
+// if key has no escapes.
+BOOST_URL_DECL
+bool
+encoded_key_equal(
+    string_view ek,
+    string_view key,
+    bool plain) noexcept;
+
+// Call f(pos, n, nk) for each param of
+// the encoded query s, in order, where
+// pos is the offset of the param, n its
+// size and nk the size of its key. Like
+// the params iterators, every param but
+// the first starts with its '&'. All the
+// delimiters are found in one pass.
+template<class F>
+void
+split_query(
+    string_view s,
+    F const& f)
+{
+    char const* const first = s.data();
+    char const* const last =
+        first + s.size();
+    char const* p = first;
+    // current param
+    char const* start = first;
+    char const* eq = nullptr;
+
+#ifdef BOOST_URL_USE_SSE2
+    __m128i const amp = _mm_set1_epi8('&');
+    __m128i const equ = _mm_set1_epi8('=');
+    while(last - p >= 16)
+    {
+        __m128i const v = _mm_loadu_si128(
+            reinterpret_cast<__m128i const*>(p));
+        unsigned ma = static_cast<unsigned>(
+            _mm_movemask_epi8(
+                _mm_cmpeq_epi8(v, amp)));
+        unsigned me = static_cast<unsigned>(
+            _mm_movemask_epi8(
+                _mm_cmpeq_epi8(v, equ)));
+        while(ma)
+        {
+            // '=' before this '&'
+            unsigned const below =
+                (ma & (0u - ma)) - 1;
+            if( ! eq &&
+                (me & below))
+                eq = p + boost::core::countr_zero(
+                    me & below);
+            me &= ~below;
+            char const* const e = p +
+                boost::core::countr_zero(ma);
+            if(! eq)
+                eq = e;
+            f(static_cast<std::size_t>(start - first),
+                static_cast<std::size_t>(e - start),
+                static_cast<std::size_t>(eq - start));
+            start = e;
+            eq = nullptr;
+            ma &= ma - 1;
+        }
+        if( ! eq && me)
+            eq = p + boost::core::countr_zero(me);
+        p += 16;
+    }
+#endif
+
+    for(; p != last; ++p)
+    {
+        if(*p == '&')
+        {
+            if(! eq)
+                eq = p;
+            f(static_cast<std::size_t>(start - first),
+                static_cast<std::size_t>(p - start),
+                static_cast<std::size_t>(eq - start));
+            start = p;
+            eq = nullptr;
+        }
+        else if(
+            *p == '=' &&
+            ! eq)
+        {
+            eq = p;
+        }
+    }
+    if(! eq)
+        eq = last;
+    f(static_cast<std::size_t>(start - first),
+        static_cast<std::size_t>(last - start),
+        static_cast<std::size_t>(eq - start));
+}
+
+} // detail
+} // urls
+} // boost
+
+#endif
@@ -11,17 +11,45 @@
 #define BOOST_URL_DETAIL_REMOVE_DOT_SEGMENTS_HPP
 
 #include <boost/url/string_view.hpp>
+#include <boost/url/detail/normalize.hpp>
+#include <boost/url/detail/url_impl.hpp>
 #include <cstdint>
 
 namespace boost {
 namespace urls {
 namespace detail {
 
+// return true if any segment in the
+// encoded path s starts with a '.'
+bool
+has_dot_segments(
+    string_view s) noexcept;
+
+// Remove the "." and ".." segments from
+// the nseg segments in [first, last),
+// which exclude the malleable prefix.
+// The output is written in place, in
+// a single pass. Unmatched ".." segments
+// are removed if remove_unmatched is true,
+// and kept otherwise (Errata 4547).
+// Returns the new size, and sets nseg to
+// the new number of segments.
 std::size_t
 remove_dot_segments(
-    char* dest,
-    char const* end,
-    string_view s,
+    char* first,
+    char const* last,
+    std::size_t& nseg,
+    bool remove_unmatched) noexcept;
+
+// Remove the dot segments from the path
+// of the URL in s described by u, in place.
+// The parts after the path are moved down
+// and u is updated. The URL never grows.
+// Returns the new size of the URL.
+std::size_t
+remove_dot_segments(
+    char* s,
+    url_impl& u,
     bool remove_unmatched) noexcept;
 
 void
@@ -0,0 +1,105 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_DETAIL_ROUTE_DFA_HPP
+#define BOOST_URL_DETAIL_ROUTE_DFA_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/string_view.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+class route_match;
+
+namespace detail {
+
+class router_base;
+
+// Deterministic automaton over the bytes
+// of an encoded path, compiled from the
+// radix tree of a router. Escapes are
+// decoded as the path is scanned, and an
+// unescaped '/' has its own class so that
+// "%2F" never separates segments.
+class route_dfa
+{
+    static
+    constexpr
+    std::size_t
+    npos = string_view::npos;
+
+    struct capture
+    {
+        // index of the segment
+        std::size_t seg;
+
+        // name of the param, or "*"
+        std::string name;
+
+        // capture the rest of the path
+        bool wild;
+    };
+
+    // class of each unescaped byte, with
+    // '/' the separator and '%' esc_
+    std::uint16_t raw_[256];
+
+    // class of each decoded byte
+    std::uint16_t cls_[256];
+
+    std::uint16_t esc_ = 0;
+    std::size_t nclass_ = 0;
+    std::uint32_t start_ = 0;
+
+    // state * nclass_ + class
+    std::vector<std::uint32_t> next_;
+
+    // route id on end of input
+    std::vector<std::size_t> accept_;
+
+    // route id of a path
+    // without segments
+    std::size_t accept0_ = npos;
+
+    // captures of each route id
+    std::vector<
+        std::vector<capture>> caps_;
+
+public:
+    BOOST_URL_DECL
+    explicit
+    route_dfa(
+        router_base const& r);
+
+    // Return the number of states
+    std::size_t
+    states() const noexcept
+    {
+        return accept_.size();
+    }
+
+    // Return the id of the route
+    // matching the path, or npos
+    BOOST_URL_DECL
+    std::size_t
+    find(
+        string_view path,
+        route_match& m) const noexcept;
+};
+
+} // detail
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,120 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_DETAIL_ROUTER_HPP
+#define BOOST_URL_DETAIL_ROUTER_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/string_view.hpp>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+class route_match;
+class segments_encoded_view;
+
+namespace detail {
+
+class route_dfa;
+
+// Radix tree over the encoded segments of
+// route patterns. Each edge to a literal
+// node is labeled with one or more whole
+// segments; chains of literal segments
+// with no branches share one node.
+class router_base
+{
+    friend class route_dfa;
+
+    static
+    constexpr
+    std::size_t
+    npos = string_view::npos;
+
+    struct node
+    {
+        // literal segments joined by '/',
+        // or the name of a param
+        std::string label;
+
+        // number of segments in label
+        std::size_t nlabel = 0;
+
+        // label has no escapes
+        bool plain = true;
+
+        std::vector<std::size_t> literals;
+        std::size_t param = npos;
+        std::size_t wild = npos;
+
+        // route ending here
+        std::size_t id = npos;
+    };
+
+    // target of a match
+    struct cursor
+    {
+        // start of the next segment
+        char const* p;
+        char const* end;
+
+        // number of segments left
+        std::size_t n;
+
+        // no escapes in the path
+        bool plain;
+    };
+
+    std::vector<node> nodes_;
+
+    std::size_t
+    add_literal(
+        std::size_t n,
+        string_view const* segs,
+        std::size_t count);
+
+    bool
+    match_label(
+        node const& nd,
+        cursor& c) const noexcept;
+
+    std::size_t
+    match(
+        std::size_t n,
+        cursor c,
+        route_match& m) const noexcept;
+
+public:
+    BOOST_URL_DECL
+    router_base();
+
+    // Add a pattern for route id
+    BOOST_URL_DECL
+    void
+    insert(
+        string_view pattern,
+        std::size_t id);
+
+    // Return the id of the route
+    // matching the path, or npos
+    BOOST_URL_DECL
+    std::size_t
+    find(
+        segments_encoded_view const& path,
+        route_match& m) const noexcept;
+};
+
+} // detail
+} // urls
+} // boost
+
+#endif
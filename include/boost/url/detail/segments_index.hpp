@@ -0,0 +1,74 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_DETAIL_SEGMENTS_INDEX_HPP
+#define BOOST_URL_DETAIL_SEGMENTS_INDEX_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/string_view.hpp>
+#include <boost/assert.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace urls {
+namespace detail {
+
+// Offsets of the segments of a path,
+// found in one pass. Segment i is
+// [off_[i], off_[i+1] - 1) of s_.
+class segments_index_impl
+{
+    // segments which fit without
+    // allocating, plus the sentinel
+    static constexpr std::size_t
+        inline_size = 16;
+
+    std::size_t buf_[inline_size];
+
+    BOOST_URL_DECL
+    void
+    build();
+
+public:
+    // the path after its prefix
+    string_view s_;
+    std::size_t n_ = 0;
+    std::size_t* off_ = buf_;
+
+    BOOST_URL_DECL
+    segments_index_impl(
+        string_view path,
+        std::size_t nseg);
+
+    BOOST_URL_DECL
+    segments_index_impl(
+        segments_index_impl const& other);
+
+    BOOST_URL_DECL
+    segments_index_impl&
+    operator=(segments_index_impl const& other);
+
+    BOOST_URL_DECL
+    ~segments_index_impl();
+
+    string_view
+    get(std::size_t i) const noexcept
+    {
+        BOOST_ASSERT(i < n_);
+        return string_view(
+            s_.data() + off_[i],
+            off_[i + 1] - off_[i] - 1);
+    }
+};
+
+} // detail
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,107 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_DETAIL_USDT_HPP
+#define BOOST_URL_DETAIL_USDT_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <cstdint>
+
+/*  Static tracepoints
+
+    Each probe is a nop in the code, and a
+    note in the .note.stapsdt section which
+    gives its address and where to find its
+    arguments, in the format of <sys/sdt.h>.
+    Tracers such as bpftrace, perf and
+    SystemTap find the probes in the binary
+    and patch the nop when they attach:
+
+        bpftrace -e 'usdt:./app:boost_url:parse_uri_reference_entry
+            { @len = hist(arg0); }'
+
+    Every argument is passed as a signed
+    64-bit integer. The probes are emitted
+    for ELF targets built with GCC or Clang
+    on x86-64 and AArch64, unless
+    BOOST_URL_NO_USDT is defined, and are
+    empty elsewhere.
+*/
+
+#if ! defined(BOOST_URL_NO_USDT) && \
+    ! defined(BOOST_URL_USE_USDT)
+# if defined(__ELF__) && \
+    (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__aarch64__))
+#  define BOOST_URL_USE_USDT
+# endif
+#endif
+
+#ifdef BOOST_URL_USE_USDT
+
+// The note of a probe, whose arguments are
+// described by args, such as "-8@%0 -8@%1"
+#define BOOST_URL_USDT_NOTE(name, args)                 \
+    "990: nop\n"                                        \
+    ".pushsection .note.stapsdt,\"?\",\"note\"\n"       \
+    ".balign 4\n"                                       \
+    ".4byte 992f-991f, 994f-993f, 3\n"                  \
+    "991: .asciz \"stapsdt\"\n"                         \
+    "992: .balign 4\n"                                  \
+    "993: .8byte 990b\n"                                \
+    ".8byte _.stapsdt.base\n"                           \
+    ".8byte 0\n"                                        \
+    ".asciz \"boost_url\"\n"                            \
+    ".asciz \"" #name "\"\n"                            \
+    ".asciz \"" args "\"\n"                             \
+    "994: .balign 4\n"                                  \
+    ".popsection\n"                                     \
+    ".ifndef _.stapsdt.base\n"                          \
+    ".pushsection .stapsdt.base,\"aG\",\"progbits\","   \
+        ".stapsdt.base,comdat\n"                        \
+    ".weak _.stapsdt.base\n"                            \
+    ".hidden _.stapsdt.base\n"                          \
+    "_.stapsdt.base: .space 1\n"                        \
+    ".size _.stapsdt.base, 1\n"                         \
+    ".popsection\n"                                     \
+    ".endif\n"
+
+#define BOOST_URL_USDT_ARG(x) \
+    "nor"(static_cast<std::int64_t>(x))
+
+#define BOOST_URL_PROBE1(name, a0)                      \
+    __asm__ __volatile__(                               \
+        BOOST_URL_USDT_NOTE(name, "-8@%0")              \
+        : : BOOST_URL_USDT_ARG(a0))
+
+#define BOOST_URL_PROBE2(name, a0, a1)                  \
+    __asm__ __volatile__(                               \
+        BOOST_URL_USDT_NOTE(name, "-8@%0 -8@%1")        \
+        : : BOOST_URL_USDT_ARG(a0),                     \
+            BOOST_URL_USDT_ARG(a1))
+
+#define BOOST_URL_PROBE3(name, a0, a1, a2)              \
+    __asm__ __volatile__(                               \
+        BOOST_URL_USDT_NOTE(name, "-8@%0 -8@%1 -8@%2")  \
+        : : BOOST_URL_USDT_ARG(a0),                     \
+            BOOST_URL_USDT_ARG(a1),                     \
+            BOOST_URL_USDT_ARG(a2))
+
+#else
+
+#define BOOST_URL_PROBE1(name, a0) \
+    ((void)0)
+#define BOOST_URL_PROBE2(name, a0, a1) \
+    ((void)0)
+#define BOOST_URL_PROBE3(name, a0, a1, a2) \
+    ((void)0)
+
+#endif
+
+#endif
@@ -26,6 +26,7 @@
 #include <boost/url/grammar/not_empty_rule.hpp>
 #include <boost/url/grammar/optional_rule.hpp>
 #include <boost/url/grammar/parse.hpp>
+#include <boost/url/grammar/profile.hpp>
 #include <boost/url/grammar/range_rule.hpp>
 #include <boost/url/grammar/recycled.hpp>
 #include <boost/url/grammar/token_rule.hpp>
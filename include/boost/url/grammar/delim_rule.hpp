@@ -143,13 +143,13 @@ struct cs_delim_rule
         if(it == end)
         {
             // end
-            BOOST_URL_RETURN_EC(
+            BOOST_URL_RETURN_TRIAL_EC(
                 error::need_more);
         }
         if(! cs_(*it))
         {
             // wrong character
-            BOOST_URL_RETURN_EC(
+            BOOST_URL_RETURN_TRIAL_EC(
                 error::mismatch);
         }
         return string_view{
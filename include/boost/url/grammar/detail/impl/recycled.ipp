@@ -10,6 +10,7 @@
 #ifndef BOOST_URL_GRAMMAR_DETAIL_IMPL_RECYCLED_IPP
 #define BOOST_URL_GRAMMAR_DETAIL_IMPL_RECYCLED_IPP
 
+#include <boost/url/grammar/detail/recycled.hpp>
 #include <cstdlib>
 #include <mutex>
 #include <utility>
@@ -90,6 +91,211 @@ recycled_remove_impl(
     all_reports_.bytes-=n;
 }
 
+//------------------------------------------------
+
+namespace {
+
+// Pointers are packed in the low bits
+// of the head, and a counter which
+// changes with each push and pop in
+// the high bits. User space addresses
+// fit in 48 bits on 64-bit targets.
+constexpr unsigned recycled_ptr_bits =
+    sizeof(void*) < 8 ? 32 : 48;
+
+constexpr std::uint64_t recycled_ptr_mask =
+    (std::uint64_t(1) << recycled_ptr_bits) - 1;
+
+inline
+recycled_node*
+recycled_unpack(
+    std::uint64_t v) noexcept
+{
+    return reinterpret_cast<recycled_node*>(
+        static_cast<std::uintptr_t>(
+            v & recycled_ptr_mask));
+}
+
+inline
+std::uint64_t
+recycled_pack(
+    recycled_node* p,
+    std::uint64_t old) noexcept
+{
+    return
+        ((old & ~recycled_ptr_mask) +
+            (recycled_ptr_mask + 1)) |
+        static_cast<std::uint64_t>(
+            reinterpret_cast<
+                std::uintptr_t>(p));
+}
+
+} // (anon)
+
+constexpr std::size_t recycled_cache::keep;
+constexpr std::size_t recycled_cache::limit;
+
+void
+recycled_stack::
+push(
+    recycled_node* first,
+    std::size_t n) noexcept
+{
+    if(static_cast<std::uint64_t>(
+        reinterpret_cast<std::uintptr_t>(
+            first)) & ~recycled_ptr_mask)
+    {
+        // can't be packed
+        while(first)
+        {
+            auto const next = first->next;
+            destroy_(first);
+            first = next;
+        }
+        return;
+    }
+    first->size = n;
+    auto old = head_.load(
+        std::memory_order_relaxed);
+    for(;;)
+    {
+        first->batch.store(
+            recycled_unpack(old),
+            std::memory_order_relaxed);
+        if(head_.compare_exchange_weak(
+            old, recycled_pack(first, old),
+            std::memory_order_release,
+            std::memory_order_relaxed))
+            return;
+    }
+}
+
+recycled_node*
+recycled_stack::
+pop() noexcept
+{
+    auto old = head_.load(
+        std::memory_order_acquire);
+    for(;;)
+    {
+        auto const p =
+            recycled_unpack(old);
+        if(! p)
+            return nullptr;
+        // p may be popped by another
+        // thread after the load, but
+        // nodes are only deleted with
+        // the stack, and the counter
+        // fails the exchange below.
+        auto const next = p->batch.load(
+            std::memory_order_relaxed);
+        if(head_.compare_exchange_weak(
+            old, recycled_pack(next, old),
+            std::memory_order_acquire,
+            std::memory_order_acquire))
+            return p;
+    }
+}
+
+recycled_node*
+recycled_stack::
+pop_all() noexcept
+{
+    auto old = head_.load(
+        std::memory_order_acquire);
+    while(! head_.compare_exchange_weak(
+        old, recycled_pack(nullptr, old),
+        std::memory_order_acquire,
+        std::memory_order_acquire))
+    {
+    }
+    return recycled_unpack(old);
+}
+
+//------------------------------------------------
+
+void
+recycled_cache::
+publish() noexcept
+{
+    if(hits_)
+        s_->hits.fetch_add(hits_,
+            std::memory_order_relaxed);
+    if(misses_)
+        s_->misses.fetch_add(misses_,
+            std::memory_order_relaxed);
+    if(cross_)
+        s_->cross.fetch_add(cross_,
+            std::memory_order_relaxed);
+    hits_ = 0;
+    misses_ = 0;
+    cross_ = 0;
+}
+
+recycled_cache::
+~recycled_cache()
+{
+    if(head_)
+        s_->push(head_, n_);
+    publish();
+}
+
+recycled_node*
+recycled_cache::
+acquire() noexcept
+{
+    if(! head_)
+    {
+        head_ = s_->pop();
+        if(! head_)
+        {
+            ++misses_;
+            return nullptr;
+        }
+        n_ = head_->size;
+        publish();
+    }
+    auto const p = head_;
+    head_ = p->next;
+    --n_;
+    ++hits_;
+    return p;
+}
+
+void
+recycled_cache::
+release(
+    recycled_node* p) noexcept
+{
+    if(p->owner != recycled_thread())
+        ++cross_;
+    p->next = head_;
+    head_ = p;
+    if(++n_ <= limit)
+        return;
+
+    // keep the most recently used
+    // nodes, and hand off the rest
+    auto last = head_;
+    for(std::size_t i = 1; i < keep; ++i)
+        last = last->next;
+    s_->push(last->next, n_ - keep);
+    last->next = nullptr;
+    n_ = keep;
+    publish();
+}
+
+void const*
+recycled_thread() noexcept
+{
+#ifndef BOOST_NO_CXX11_THREAD_LOCAL
+    static thread_local char id;
+    return &id;
+#else
+    return nullptr;
+#endif
+}
+
 } // detail
 } // grammar
 } // urls
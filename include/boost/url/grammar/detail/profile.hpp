@@ -0,0 +1,111 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_GRAMMAR_DETAIL_PROFILE_HPP
+#define BOOST_URL_GRAMMAR_DETAIL_PROFILE_HPP
+
+#include <boost/url/grammar/profile.hpp>
+#include <boost/core/typeinfo.hpp>
+#include <chrono>
+
+namespace boost {
+namespace urls {
+namespace grammar {
+namespace detail {
+
+struct profile_node;
+
+// Make the node of the rule the current
+// node, and count the call
+BOOST_URL_DECL
+profile_node*
+profile_enter(
+    core::typeinfo const& ti);
+
+// Make the parent of the node current
+BOOST_URL_DECL
+void
+profile_leave(
+    profile_node* p,
+    std::size_t bytes,
+    bool failed,
+    std::uint64_t ns) noexcept;
+
+BOOST_URL_DECL
+void
+profile_backtrack() noexcept;
+
+// Records one call to a rule
+class profile_scope
+{
+    using clock_type =
+        std::chrono::steady_clock;
+
+    profile_node* p_;
+    char const* it0_;
+    std::size_t bytes_ = 0;
+    bool failed_ = true;
+    clock_type::time_point t0_;
+
+public:
+    profile_scope(
+        core::typeinfo const& ti,
+        char const* it)
+        : p_(profile_enter(ti))
+        , it0_(it)
+        , t0_(clock_type::now())
+    {
+    }
+
+    ~profile_scope()
+    {
+        auto const t = clock_type::now() - t0_;
+        profile_leave(p_, bytes_, failed_,
+            static_cast<std::uint64_t>(
+                std::chrono::duration_cast<
+                    std::chrono::nanoseconds>(
+                        t).count()));
+    }
+
+    profile_scope(
+        profile_scope const&) = delete;
+    profile_scope& operator=(
+        profile_scope const&) = delete;
+
+    void
+    done(
+        char const* it,
+        bool failed) noexcept
+    {
+        failed_ = failed;
+        if(! failed)
+            bytes_ = it - it0_;
+    }
+};
+
+// Count a backtrack of the rule which
+// returned most recently, when profiling.
+// BOOST_URL_GRAMMAR_PROFILE must be the
+// same in the library and in every file
+// which includes it.
+inline
+void
+note_backtrack() noexcept
+{
+#ifdef BOOST_URL_GRAMMAR_PROFILE
+    profile_backtrack();
+#endif
+}
+
+} // detail
+} // grammar
+} // urls
+} // boost
+
+#endif
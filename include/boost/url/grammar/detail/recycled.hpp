@@ -10,7 +10,10 @@
 #ifndef BOOST_URL_GRAMMAR_DETAIL_RECYCLED_HPP
 #define BOOST_URL_GRAMMAR_DETAIL_RECYCLED_HPP
 
-#include <mutex>
+#include <boost/url/detail/config.hpp>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <utility>
 
 namespace boost {
@@ -54,6 +57,120 @@ nearest_pow2(
 
 //------------------------------------------------
 
+// Base of the instances held in a bin.
+// Free instances are linked in batches,
+// and the first of each batch links
+// the next batch.
+struct recycled_node
+{
+    // next node of the batch
+    recycled_node* next = nullptr;
+
+    // next batch, if first
+    std::atomic<recycled_node*> batch{nullptr};
+
+    // nodes in the batch, if first
+    std::size_t size = 0;
+
+    // thread which last acquired it
+    void const* owner = nullptr;
+};
+
+// A lock-free stack of batches of nodes.
+// The head is a pointer and a counter
+// packed in one word, so that a pop
+// whose next batch was popped and
+// pushed back by another thread fails.
+class recycled_stack
+{
+    std::atomic<std::uint64_t> head_{0};
+    void (*destroy_)(recycled_node*) noexcept;
+
+public:
+    std::atomic<std::size_t> hits{0};
+    std::atomic<std::size_t> misses{0};
+    std::atomic<std::size_t> cross{0};
+
+    constexpr
+    explicit
+    recycled_stack(
+        void (*destroy)(
+            recycled_node*) noexcept) noexcept
+        : destroy_(destroy)
+    {
+    }
+
+    // push n nodes linked by next
+    BOOST_URL_DECL
+    void
+    push(
+        recycled_node* first,
+        std::size_t n) noexcept;
+
+    // pop one batch, or null
+    BOOST_URL_DECL
+    recycled_node*
+    pop() noexcept;
+
+    // pop every batch, or null
+    BOOST_URL_DECL
+    recycled_node*
+    pop_all() noexcept;
+};
+
+// A bounded list of nodes owned by one
+// thread, which hands batches to and
+// from a stack. The counters are added
+// to the stack with each batch.
+class recycled_cache
+{
+    recycled_stack* s_;
+    recycled_node* head_ = nullptr;
+    std::size_t n_ = 0;
+    std::size_t hits_ = 0;
+    std::size_t misses_ = 0;
+    std::size_t cross_ = 0;
+
+    void
+    publish() noexcept;
+
+public:
+    // nodes kept after a hand-off
+    static constexpr
+    std::size_t keep = 16;
+
+    // most nodes held
+    static constexpr
+    std::size_t limit = 2 * keep;
+
+    explicit
+    recycled_cache(
+        recycled_stack& s) noexcept
+        : s_(&s)
+    {
+    }
+
+    BOOST_URL_DECL
+    ~recycled_cache();
+
+    // return a node, or null
+    BOOST_URL_DECL
+    recycled_node*
+    acquire() noexcept;
+
+    BOOST_URL_DECL
+    void
+    release(
+        recycled_node* p) noexcept;
+};
+
+// identifies the calling thread
+BOOST_URL_DECL
+void const*
+recycled_thread() noexcept;
+
+//------------------------------------------------
+
 BOOST_URL_DECL
 void
 recycled_add_impl(
@@ -28,13 +28,13 @@ parse(
     if(it == end)
     {
         // end
-        BOOST_URL_RETURN_EC(
+        BOOST_URL_RETURN_TRIAL_EC(
             error::mismatch);
     }
     if(! digit_chars(*it))
     {
         // expected DIGIT
-        BOOST_URL_RETURN_EC(
+        BOOST_URL_RETURN_TRIAL_EC(
             error::mismatch);
     }
     unsigned v = *it - '0';
@@ -26,13 +26,13 @@ parse(
     if(it == end)
     {
         // end
-        BOOST_URL_RETURN_EC(
+        BOOST_URL_RETURN_TRIAL_EC(
             error::need_more);
     }
     if(*it != ch_)
     {
         // wrong character
-        BOOST_URL_RETURN_EC(
+        BOOST_URL_RETURN_TRIAL_EC(
             error::mismatch);
     }
     return string_view{
@@ -36,7 +36,7 @@ parse(
             it, s_, n_) != 0)
         {
             // non-match
-            BOOST_URL_RETURN_EC(
+            BOOST_URL_RETURN_TRIAL_EC(
                 error::mismatch);
         }
         it += n_;
@@ -50,15 +50,15 @@ parse(
             it, s_, n) != 0)
         {
             // non-match
-            BOOST_URL_RETURN_EC(
+            BOOST_URL_RETURN_TRIAL_EC(
                 error::mismatch);
         }
         // prefix matches
-        BOOST_URL_RETURN_EC(
+        BOOST_URL_RETURN_TRIAL_EC(
             error::need_more);
     }
     // end
-    BOOST_URL_RETURN_EC(
+    BOOST_URL_RETURN_TRIAL_EC(
         error::need_more);
 }
 
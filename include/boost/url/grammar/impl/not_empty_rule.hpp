@@ -28,11 +28,15 @@ parse(
     if(it == end)
     {
         // empty
-        BOOST_URL_RETURN_EC(
+        BOOST_URL_RETURN_TRIAL_EC(
             error::mismatch);
     }
     auto const it0 = it;
+#ifdef BOOST_URL_GRAMMAR_PROFILE
+    auto rv = (grammar::parse)(it, end, r_);
+#else
     auto rv = r_.parse(it, end);
+#endif
     if( rv.has_error())
     {
         // error
@@ -41,7 +45,7 @@ parse(
     if(it == it0)
     {
         // empty
-        BOOST_URL_RETURN_EC(
+        BOOST_URL_RETURN_TRIAL_EC(
             error::mismatch);
     }
     // value
@@ -11,6 +11,7 @@
 #define BOOST_URL_GRAMMAR_IMPL_OPTIONAL_RULE_HPP
 
 #include <boost/url/grammar/error.hpp>
+#include <boost/url/grammar/parse.hpp>
 
 namespace boost {
 namespace urls {
@@ -27,10 +28,15 @@ parse(
     if(it == end)
         return boost::none;
     auto const it0 = it;
+#ifdef BOOST_URL_GRAMMAR_PROFILE
+    auto rv = (grammar::parse)(it, end, r_);
+#else
     auto rv = r_.parse(it, end);
+#endif
     if(! rv.has_error())
         return value_type(*rv);
     it = it0;
+    detail::note_backtrack();
     return boost::none;
 }
 
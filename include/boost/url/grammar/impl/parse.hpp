@@ -12,6 +12,7 @@
 
 #include <boost/url/grammar/error.hpp>
 #include <boost/url/grammar/type_traits.hpp>
+#include <boost/url/grammar/detail/profile.hpp>
 
 namespace boost {
 namespace urls {
@@ -33,7 +34,15 @@ parse(
         is_rule<R>::value,
         "Rule requirements not met");
 
+#ifdef BOOST_URL_GRAMMAR_PROFILE
+    detail::profile_scope ps(
+        BOOST_CORE_TYPEID(R), it);
+    auto rv = r.parse(it, end);
+    ps.done(it, rv.has_error());
+    return rv;
+#else
     return r.parse(it, end);
+#endif
 }
 
 template<class R>
@@ -53,10 +62,31 @@ parse(
 
     auto it = s.data();
     auto const end = it + s.size();
+#ifdef BOOST_URL_GRAMMAR_PROFILE
+    // make the rule the root of its tree
+    auto rv = (grammar::parse)(it, end, r);
+#else
     auto rv = r.parse(it, end);
+#endif
     if( rv.has_value() &&
             it != end)
-        return error::leftover;
+    {
+        BOOST_URL_RETURN_EC(
+            error::leftover);
+    }
+#ifndef BOOST_URL_NO_SOURCE_LOCATION
+    // a trial error escaped the rule
+    if( rv.has_error() &&
+        ! rv.error().has_location())
+    {
+        static constexpr auto loc(
+            BOOST_CURRENT_LOCATION);
+        return error_code(
+            rv.error().value(),
+            rv.error().category(),
+            &loc);
+    }
+#endif
     return rv;
 }
 
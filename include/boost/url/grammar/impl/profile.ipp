@@ -0,0 +1,266 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_GRAMMAR_IMPL_PROFILE_IPP
+#define BOOST_URL_GRAMMAR_IMPL_PROFILE_IPP
+
+#include <boost/url/grammar/profile.hpp>
+#include <boost/url/grammar/detail/profile.hpp>
+#include <boost/assert.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <ostream>
+
+namespace boost {
+namespace urls {
+namespace grammar {
+
+namespace detail {
+
+struct profile_node
+{
+    core::typeinfo const* ti = nullptr;
+    profile_node* parent = nullptr;
+    std::vector<std::unique_ptr<
+        profile_node>> children;
+    std::size_t calls = 0;
+    std::size_t bytes = 0;
+    std::size_t failures = 0;
+    std::size_t backtracks = 0;
+    std::uint64_t ns = 0;
+};
+
+namespace {
+
+struct profile_tree
+{
+    profile_node root;
+    profile_node* current = &root;
+    profile_node* last = nullptr;
+};
+
+profile_tree&
+thread_tree() noexcept
+{
+#ifndef BOOST_NO_CXX11_THREAD_LOCAL
+    static thread_local profile_tree t;
+#else
+    static profile_tree t;
+#endif
+    return t;
+}
+
+void
+snapshot(
+    profile_node const& p,
+    rule_stats& st)
+{
+    if(p.ti)
+        st.name = core::demangled_name(*p.ti);
+    st.calls = p.calls;
+    st.bytes = p.bytes;
+    st.failures = p.failures;
+    st.backtracks = p.backtracks;
+    st.nanoseconds = p.ns;
+    st.children.resize(p.children.size());
+    for(std::size_t i = 0;
+            i < p.children.size(); ++i)
+        snapshot(*p.children[i],
+            st.children[i]);
+}
+
+// Remove the namespaces of the library
+// and the arguments of templates
+std::string
+short_name(std::string const& s)
+{
+    static char const* const ns[] = {
+        "boost::urls::grammar::detail::",
+        "boost::urls::grammar::",
+        "boost::urls::detail::",
+        "boost::urls::" };
+    std::string r;
+    std::size_t depth = 0;
+    std::size_t i = 0;
+    while(i < s.size())
+    {
+        auto const c = s[i];
+        if(c == '<')
+        {
+            if(depth++ == 0)
+                r += "<...>";
+            ++i;
+            continue;
+        }
+        if(c == '>' && depth > 0)
+        {
+            --depth;
+            ++i;
+            continue;
+        }
+        if(depth > 0)
+        {
+            ++i;
+            continue;
+        }
+        bool skip = false;
+        for(auto const p : ns)
+        {
+            auto const n =
+                std::char_traits<char>::length(p);
+            if(s.compare(i, n, p) == 0)
+            {
+                i += n;
+                skip = true;
+                break;
+            }
+        }
+        if(! skip)
+            r += s[i++];
+    }
+    return r;
+}
+
+void
+write_node(
+    std::ostream& os,
+    rule_stats const& st,
+    std::size_t indent)
+{
+    char buf[96];
+    std::snprintf(buf, sizeof(buf),
+        "%10llu %10llu %9llu %10llu %12.3f  ",
+        static_cast<unsigned long long>(st.calls),
+        static_cast<unsigned long long>(st.bytes),
+        static_cast<unsigned long long>(st.failures),
+        static_cast<unsigned long long>(st.backtracks),
+        static_cast<double>(st.nanoseconds) / 1e3);
+    os << buf << std::string(2 * indent, ' ') <<
+        short_name(st.name) << '\n';
+}
+
+void
+write_tree(
+    std::ostream& os,
+    rule_stats const& st,
+    std::size_t indent)
+{
+    std::vector<rule_stats const*> v;
+    v.reserve(st.children.size());
+    for(auto const& c : st.children)
+        v.push_back(&c);
+    std::stable_sort(v.begin(), v.end(),
+        [](rule_stats const* a,
+            rule_stats const* b)
+        {
+            return a->nanoseconds >
+                b->nanoseconds;
+        });
+    for(auto const p : v)
+    {
+        write_node(os, *p, indent);
+        write_tree(os, *p, indent + 1);
+    }
+}
+
+} // (anon)
+
+profile_node*
+profile_enter(
+    core::typeinfo const& ti)
+{
+    auto& t = thread_tree();
+    auto& v = t.current->children;
+    profile_node* p = nullptr;
+    for(auto const& c : v)
+        if(*c->ti == ti)
+        {
+            p = c.get();
+            break;
+        }
+    if(! p)
+    {
+        v.emplace_back(new profile_node);
+        p = v.back().get();
+        p->ti = &ti;
+        p->parent = t.current;
+    }
+    ++p->calls;
+    t.current = p;
+    return p;
+}
+
+void
+profile_leave(
+    profile_node* p,
+    std::size_t bytes,
+    bool failed,
+    std::uint64_t ns) noexcept
+{
+    auto& t = thread_tree();
+    BOOST_ASSERT(t.current == p);
+    if(failed)
+        ++p->failures;
+    else
+        p->bytes += bytes;
+    p->ns += ns;
+    t.current = p->parent;
+    t.last = p;
+}
+
+void
+profile_backtrack() noexcept
+{
+    auto& t = thread_tree();
+    if(t.last)
+        ++t.last->backtracks;
+}
+
+} // detail
+
+rule_stats
+thread_rule_profile()
+{
+    rule_stats st;
+    detail::snapshot(
+        detail::thread_tree().root, st);
+    return st;
+}
+
+void
+reset_thread_rule_profile() noexcept
+{
+    auto& t = detail::thread_tree();
+    BOOST_ASSERT(t.current == &t.root);
+    t.root.children.clear();
+    t.last = nullptr;
+}
+
+void
+write_rule_profile(
+    std::ostream& os,
+    rule_stats const& profile)
+{
+    os << "     calls      bytes  failures "
+        "backtracks   incl. (us)  rule\n";
+    if(profile.name.empty())
+    {
+        detail::write_tree(os, profile, 0);
+        return;
+    }
+    detail::write_node(os, profile, 0);
+    detail::write_tree(os, profile, 1);
+}
+
+} // grammar
+} // urls
+} // boost
+
+#endif
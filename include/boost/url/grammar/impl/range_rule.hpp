@@ -536,11 +536,12 @@ parse(
         {
             // rewind unless error::range_end
             it = it1;
+            detail::note_backtrack();
         }
         if(n < N_)
         {
             // too few
-            BOOST_URL_RETURN_EC(
+            BOOST_URL_RETURN_TRIAL_EC(
                 error::mismatch);
         }
         // good
@@ -560,20 +561,21 @@ parse(
             {
                 // rewind unless error::range_end
                 it = it1;
+                detail::note_backtrack();
             }
             break;
         }
         if(n >= M_)
         {
             // too many
-            BOOST_URL_RETURN_EC(
+            BOOST_URL_RETURN_TRIAL_EC(
                 error::mismatch);
         }
     }
     if(n < N_)
     {
         // too few
-        BOOST_URL_RETURN_EC(
+        BOOST_URL_RETURN_TRIAL_EC(
             error::mismatch);
     }
     // good
@@ -606,11 +608,12 @@ parse(
         {
             // rewind unless error::range_end
             it = it1;
+            detail::note_backtrack();
         }
         if(n < N_)
         {
             // too few
-            BOOST_URL_RETURN_EC(
+            BOOST_URL_RETURN_TRIAL_EC(
                 error::mismatch);
         }
         // good
@@ -630,20 +633,21 @@ parse(
             {
                 // rewind unless error::range_end
                 it = it1;
+                detail::note_backtrack();
             }
             break;
         }
         if(n >= M_)
         {
             // too many
-            BOOST_URL_RETURN_EC(
+            BOOST_URL_RETURN_TRIAL_EC(
                 error::mismatch);
         }
     }
     if(n < N_)
     {
         // too few
-        BOOST_URL_RETURN_EC(
+        BOOST_URL_RETURN_TRIAL_EC(
             error::mismatch);
     }
     // good
@@ -29,23 +29,15 @@ recycled_ptr<T>::
 recycled_ptr(
     recycled<T>& bin)
     : bin_(&bin)
-    , p_(bin.try_acquire())
+    , p_(bin.acquire())
 {
-    if(! p_)
-        p_ = new U;
 }
 
 template<class T>
 recycled_ptr<T>::
 recycled_ptr()
     : recycled_ptr(
-        []() -> B&
-        {
-            // VFALCO this needs the guaranteed
-            // constexpr-init macro treatment
-            static B r;
-            return r;
-        }())
+        B::default_bin())
 {
 }
 
@@ -69,13 +61,20 @@ recycled<T>::
     // VFALCO we should probably deallocate
     // in reverse order of allocation but
     // that requires a doubly-linked list.
-    auto it = head_;
-    while(it)
+    auto b = s_.pop_all();
+    while(b)
     {
-        ++n;
-        auto next = it->next;
-        delete it;
-        it = next;
+        auto const next = b->batch.load(
+            std::memory_order_relaxed);
+        auto it = b;
+        while(it)
+        {
+            ++n;
+            auto const p = it;
+            it = it->next;
+            destroy(p);
+        }
+        b = next;
     }
     detail::recycled_remove(
         sizeof(U) * n);
@@ -84,19 +83,90 @@ recycled<T>::
 template<class T>
 auto
 recycled<T>::
-try_acquire() ->
+default_bin() noexcept ->
+    recycled&
+{
+    // constant initialized
+    static recycled r;
+    return r;
+}
+
+template<class T>
+recycled_stats
+recycled<T>::
+stats() const noexcept
+{
+    recycled_stats st;
+    st.hits = s_.hits.load(
+        std::memory_order_relaxed);
+    st.misses = s_.misses.load(
+        std::memory_order_relaxed);
+    st.cross_thread_frees = s_.cross.load(
+        std::memory_order_relaxed);
+    return st;
+}
+
+template<class T>
+detail::recycled_cache*
+recycled<T>::
+cache() noexcept
+{
+#ifndef BOOST_NO_CXX11_THREAD_LOCAL
+    static thread_local
+        detail::recycled_cache c(
+            default_bin().s_);
+    return &c;
+#else
+    return nullptr;
+#endif
+}
+
+template<class T>
+auto
+recycled<T>::
+acquire() ->
     U*
 {
-    std::lock_guard<
-        std::mutex> lock(m_);
-    auto p = head_;
+    detail::recycled_node* p;
+    auto const c = this == &default_bin() ?
+        cache() : nullptr;
+    if(c)
+    {
+        p = c->acquire();
+    }
+    else
+    {
+        p = s_.pop();
+        if(p)
+        {
+            // return the rest of the batch
+            if(p->next)
+                s_.push(p->next, p->size - 1);
+            s_.hits.fetch_add(1,
+                std::memory_order_relaxed);
+        }
+        else
+        {
+            s_.misses.fetch_add(1,
+                std::memory_order_relaxed);
+        }
+    }
+    U* u;
     if(p)
     {
         // recycle
-        head_ = head_->next;
+        u = static_cast<U*>(p);
         detail::recycled_remove(sizeof(U));
     }
-    return p;
+    else
+    {
+        u = new U;
+        urls::detail::count_recycled(
+            sizeof(U));
+    }
+    u->next = nullptr;
+    u->owner = detail::recycled_thread();
+    return u;
 }
 
 template<class T>
@@ -104,11 +174,19 @@ void
 recycled<T>::
 release(U* u) noexcept
 {
-    m_.lock();
-    u->next = head_;
-    head_ = u;
-    m_.unlock();
     detail::recycled_add(sizeof(U));
+    auto const c = this == &default_bin() ?
+        cache() : nullptr;
+    if(c)
+    {
+        c->release(u);
+        return;
+    }
+    if(u->owner != detail::recycled_thread())
+        s_.cross.fetch_add(1,
+            std::memory_order_relaxed);
+    u->next = nullptr;
+    s_.push(u, 1);
 }
 
 } // grammar
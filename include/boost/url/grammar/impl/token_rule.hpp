@@ -28,13 +28,13 @@ parse(
     auto const it0 = it;
     if(it == end)
     {
-        BOOST_URL_RETURN_EC(
+        BOOST_URL_RETURN_TRIAL_EC(
             error::need_more);
     }
     it = (find_if_not)(it, end, cs_);
     if(it != it0)
         return string_view(it0, it - it0);
-    BOOST_URL_RETURN_EC(
+    BOOST_URL_RETURN_TRIAL_EC(
         error::mismatch);
 }
 
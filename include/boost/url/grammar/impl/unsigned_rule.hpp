@@ -30,7 +30,7 @@ parse(
     if(it == end)
     {
         // end
-        BOOST_URL_RETURN_EC(
+        BOOST_URL_RETURN_TRIAL_EC(
             error::mismatch);
     }
     if(*it == '0')
@@ -48,7 +48,7 @@ parse(
     if(! digit_chars(*it))
     {
         // expected digit
-        BOOST_URL_RETURN_EC(
+        BOOST_URL_RETURN_TRIAL_EC(
             error::mismatch);
     }
     static constexpr U Digits10 =
@@ -40,7 +40,7 @@ parse_variant(
             typename Rn::value_type...>>
 {
     // no match
-    BOOST_URL_RETURN_EC(
+    BOOST_URL_RETURN_TRIAL_EC(
         error::mismatch);
 }
 
@@ -70,6 +70,7 @@ parse_variant(
             typename Rn::value_type...>{
                 variant2::in_place_index_t<I>{}, *rv};
     it = it0;
+    note_backtrack();
     return parse_variant(
         it, end, rn,
         std::integral_constant<
@@ -0,0 +1,148 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_GRAMMAR_PROFILE_HPP
+#define BOOST_URL_GRAMMAR_PROFILE_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace urls {
+namespace grammar {
+
+/** The counters of a rule in a profile
+
+    When the library and the program are
+    built with the macro
+    `BOOST_URL_GRAMMAR_PROFILE` defined,
+    every call to @ref parse on a thread
+    is recorded in a tree, where each node
+    is a rule type and its children are the
+    rules it invoked. The same rule type
+    invoked from two places in a grammar has
+    two nodes. This includes the rules of
+    the library, and those of the program.
+
+    The tree of the calling thread is
+    returned by @ref thread_rule_profile.
+    Inclusive times include the cost of
+    measuring the children, and should be
+    compared with each other rather than
+    with unprofiled builds.
+
+    The hooks are in inline functions and
+    templates, such as @ref parse, so the
+    macro must be defined for the library
+    and for every translation unit which
+    includes its headers, for example on
+    the command line of the whole build.
+    Defining it in only some of them
+    violates the one definition rule.
+
+    @par Example
+    @code
+    reset_thread_rule_profile();
+    for( auto const& s : corpus )
+        parse_uri( s );
+    write_rule_profile( std::cout, thread_rule_profile() );
+    @endcode
+
+    @see
+        @ref reset_thread_rule_profile,
+        @ref thread_rule_profile,
+        @ref write_rule_profile.
+*/
+struct rule_stats
+{
+    /** The demangled type of the rule
+
+        The root of a tree has an empty
+        name, and its children are the
+        rules passed to @ref parse.
+    */
+    std::string name;
+
+    /** Calls to the rule
+    */
+    std::size_t calls = 0;
+
+    /** Chars consumed by the calls which succeeded
+    */
+    std::size_t bytes = 0;
+
+    /** Calls which returned an error
+    */
+    std::size_t failures = 0;
+
+    /** Failures after which the input was rewound
+
+        These are counted when the rule was
+        an alternative of @ref variant_rule,
+        the rule of @ref optional_rule, or an
+        element of @ref range_rule, so that
+        the chars it examined were examined
+        again by another rule.
+    */
+    std::size_t backtracks = 0;
+
+    /** Time spent in the calls, including children
+    */
+    std::uint64_t nanoseconds = 0;
+
+    /** The rules invoked by this rule
+    */
+    std::vector<rule_stats> children;
+};
+
+/** Return the profile of the calling thread
+
+    @see
+        @ref rule_stats.
+*/
+BOOST_URL_DECL
+rule_stats
+thread_rule_profile();
+
+/** Discard the profile of the calling thread
+
+    @see
+        @ref rule_stats.
+*/
+BOOST_URL_DECL
+void
+reset_thread_rule_profile() noexcept;
+
+/** Write a profile as an indented tree
+
+    Each line shows the counters of a rule
+    followed by its name, shortened by
+    removing the namespaces of the library
+    and the arguments of templates, with
+    the children of each rule indented
+    below it, in descending order of time.
+
+    @see
+        @ref rule_stats.
+*/
+BOOST_URL_DECL
+void
+write_rule_profile(
+    std::ostream& os,
+    rule_stats const& profile);
+
+} // grammar
+} // urls
+} // boost
+
+#endif
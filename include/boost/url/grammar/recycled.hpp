@@ -11,6 +11,7 @@
 #define BOOST_URL_GRAMMAR_RECYCLED_HPP
 
 #include <boost/url/detail/config.hpp>
+#include <boost/url/detail/alloc_stats.hpp>
 #include <boost/url/grammar/detail/recycled.hpp>
 #include <cstddef>
 #include <type_traits>
@@ -45,12 +46,44 @@ using aligned_storage =
 
 //------------------------------------------------
 
+/** Counters of a recycle bin
+
+    @see
+        @ref recycled::stats.
+*/
+struct recycled_stats
+{
+    /** Instances which were reused
+    */
+    std::size_t hits = 0;
+
+    /** Instances which were newly allocated
+    */
+    std::size_t misses = 0;
+
+    /** Instances released by a thread other than the one which acquired them
+    */
+    std::size_t cross_thread_frees = 0;
+};
+
+//------------------------------------------------
+
 /** A thread-safe collection of instances of T
 
     Instances of this type may be used to control
     where recycled instances of T come from when
     used with @ref recycled_ptr.
 
+    Free instances are held in a lock-free
+    stack. The bin returned by @ref default_bin
+    also keeps a small cache of free instances
+    for each thread, so that most acquisitions
+    and releases touch no shared memory. When
+    a cache grows past its bound, a batch of
+    instances is handed to the stack with one
+    atomic operation, and an empty cache takes
+    one batch back.
+
     @par Example
     @code
     static recycled< std::string > bin;
@@ -79,25 +112,58 @@ public:
 
     /** Constructor
     */
-    constexpr recycled() = default;
+    constexpr
+    recycled() noexcept
+        : s_(&destroy)
+    {
+    }
+
+    /** Return the bin used by default
+
+        This bin is used by default constructed
+        @ref recycled_ptr, and is the only bin
+        which has a cache for each thread.
+    */
+    static
+    recycled&
+    default_bin() noexcept;
+
+    /** Return the counters of this bin
+
+        Counters are updated as instances are
+        acquired and released. For the default
+        bin, the counters of each thread are
+        added when that thread hands a batch
+        to or from the shared stack, or exits.
+    */
+    recycled_stats
+    stats() const noexcept;
 
 private:
     template<class>
     friend class recycled_ptr;
 
-    struct U
+    struct U : detail::recycled_node
     {
         T t;
-        U* next = nullptr;
     };
 
-    struct report;
+    static
+    void
+    destroy(
+        detail::recycled_node* p) noexcept
+    {
+        delete static_cast<U*>(p);
+    }
+
+    static
+    detail::recycled_cache*
+    cache() noexcept;
 
-    U* try_acquire();
+    U* acquire();
     void release(U* u) noexcept;
 
-    U* head_ = nullptr;
-    std::mutex m_;
+    detail::recycled_stack s_;
 };
 
 //------------------------------------------------
@@ -0,0 +1,176 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_HOST_ROUTER_HPP
+#define BOOST_URL_HOST_ROUTER_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/authority_view.hpp>
+#include <boost/url/string_view.hpp>
+#include <boost/url/url_view_base.hpp>
+#include <boost/url/detail/host_router.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+/** A router which maps URL hosts to values
+
+    Routes are added with host patterns,
+    each of which is one of:
+
+    @li A registered name in encoded form,
+    such as "www.example.com", which matches
+    a host equal to it once both are decoded
+    and lowercase.
+
+    @li A suffix such as "*.example.com",
+    which matches any registered name ending
+    in a dot followed by the suffix, such as
+    "api.example.com" or "a.b.example.com".
+    When several suffixes match, the longest
+    is used.
+
+    @li An IPv4 address, or an IPv6 address
+    or IPvFuture in brackets, which matches
+    a host with the same address.
+
+    @li The string "*", which matches any
+    host not matched by another route.
+
+    Lookups use the host of a URL or an
+    authority as it was parsed. Names are
+    hashed and compared without making a
+    lowercase or decoded copy, and addresses
+    are compared in binary form, so that
+    "[::1]" matches "[0:0::1]". The value of
+    each route can be another router, to
+    dispatch on the path once the host is
+    known.
+
+    @par Example
+    @code
+    host_router< router< int > > hr;
+    router< int > api;
+    api.insert( "/users/{id}", 1 );
+    hr.insert( "api.example.com", api );
+    hr.insert( "*.example.com", router< int >() );
+
+    url_view u( "https://API.example.com/users/42" );
+    route_match m;
+    router< int > const* r = hr.find( u );
+    int const* v = r->find( u.encoded_segments(), m );
+
+    assert( v && *v == 1 );
+    @endcode
+
+    @tparam T The type of value held for
+    each route.
+
+    @see
+        @ref router.
+*/
+template<class T>
+class host_router
+{
+    detail::host_router_base impl_;
+    std::vector<T> v_;
+
+public:
+    /** The type of value held for each route
+    */
+    using value_type = T;
+
+    /** Constructor
+
+        Default constructed routers have
+        no routes.
+    */
+    host_router() = default;
+
+    /** Return the number of routes
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return v_.size();
+    }
+
+    /** Add a route
+
+        @par Exception Safety
+        Strong guarantee.
+        Calls to allocate may throw.
+
+        @throw std::invalid_argument The
+        pattern is not a valid host or suffix,
+        or is already in the router.
+
+        @param host The host pattern.
+
+        @param value The value of the route.
+    */
+    void
+    insert(
+        string_view host,
+        T value);
+
+    /** Return the value of the route matching a host
+
+        This function returns a pointer to the
+        value of the route which matches the
+        host of `u`, or null. URLs without
+        an authority or with an empty host
+        have no match.
+
+        @par Complexity
+        Linear in the size of the host.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param u The URL whose host is matched.
+    */
+    T const*
+    find(url_view_base const& u) const noexcept;
+
+    /// @copydoc find(url_view_base const&) const
+    T*
+    find(url_view_base const& u) noexcept;
+
+    /** Return the value of the route matching a host
+
+        This function returns a pointer to the
+        value of the route which matches the
+        host of `a`, or null.
+
+        @par Complexity
+        Linear in the size of the host.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param a The authority whose host
+        is matched.
+    */
+    T const*
+    find(authority_view const& a) const noexcept;
+
+    /// @copydoc find(authority_view const&) const
+    T*
+    find(authority_view const& a) noexcept;
+};
+
+} // urls
+} // boost
+
+#include <boost/url/impl/host_router.hpp>
+
+#endif
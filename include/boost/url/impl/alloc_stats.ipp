@@ -0,0 +1,50 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_IMPL_ALLOC_STATS_IPP
+#define BOOST_URL_IMPL_ALLOC_STATS_IPP
+
+#include <boost/url/alloc_stats.hpp>
+#include <boost/url/detail/alloc_stats.hpp>
+
+namespace boost {
+namespace urls {
+
+namespace detail {
+
+alloc_stats&
+thread_alloc_stats_ref() noexcept
+{
+#ifndef BOOST_NO_CXX11_THREAD_LOCAL
+    static thread_local alloc_stats st;
+#else
+    static alloc_stats st;
+#endif
+    return st;
+}
+
+} // detail
+
+alloc_stats
+thread_alloc_stats() noexcept
+{
+    return detail::thread_alloc_stats_ref();
+}
+
+void
+reset_thread_alloc_stats() noexcept
+{
+    detail::thread_alloc_stats_ref() =
+        alloc_stats();
+}
+
+} // urls
+} // boost
+
+#endif
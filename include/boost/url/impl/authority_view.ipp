@@ -11,12 +11,25 @@
 #define BOOST_URL_IMPL_AUTHORITY_VIEW_IPP
 
 #include <boost/url/authority_view.hpp>
+#include <boost/url/detail/ipv4.hpp>
+#include <boost/url/detail/parse_stats.hpp>
+#include <boost/url/detail/pct_encoded_view.hpp>
+#include <boost/url/grammar/hexdig_chars.hpp>
 #include <boost/url/grammar/parse.hpp>
 #include <boost/url/rfc/authority_rule.hpp>
 #include <boost/url/rfc/pct_encoded_rule.hpp>
+#include <boost/url/rfc/unreserved_chars.hpp>
+#include <boost/url/rfc/detail/host_rule.hpp>
+#include <boost/url/rfc/detail/port_rule.hpp>
+#include <boost/core/bit.hpp>
 #include <array>
+#include <cstdint>
 #include <ostream>
 
+#ifdef BOOST_URL_USE_SSE2
+# include <emmintrin.h>
+#endif
+
 namespace boost {
 namespace urls {
 
@@ -256,7 +269,174 @@ parse_authority(
     if(s.size() > authority_view::max_size())
         detail::throw_length_error(
             "too large");
-    return grammar::parse(s, authority_rule);
+    auto rv = grammar::parse(s, authority_rule);
+    detail::count_parse(s, rv);
+    return rv;
+}
+
+namespace {
+
+// Return the end of the reg-name at it,
+// made of unreserved chars and escapes,
+// adding the number of escapes to np, or
+// null if an escape is malformed
+char const*
+host_port_reg_name(
+    char const* it,
+    char const* const end,
+    std::size_t& np) noexcept
+{
+    for(;;)
+    {
+#ifdef BOOST_URL_USE_SSE2
+        while(end - it >= 16)
+        {
+            __m128i const x = _mm_loadu_si128(
+                reinterpret_cast<__m128i const*>(it));
+            __m128i const l = _mm_or_si128(
+                x, _mm_set1_epi8(0x20));
+            __m128i const ok = _mm_or_si128(
+                _mm_or_si128(
+                    _mm_and_si128(
+                        _mm_cmpgt_epi8(x, _mm_set1_epi8('0' - 1)),
+                        _mm_cmplt_epi8(x, _mm_set1_epi8('9' + 1))),
+                    _mm_and_si128(
+                        _mm_cmpgt_epi8(l, _mm_set1_epi8('a' - 1)),
+                        _mm_cmplt_epi8(l, _mm_set1_epi8('z' + 1)))),
+                _mm_or_si128(
+                    _mm_or_si128(
+                        _mm_cmpeq_epi8(x, _mm_set1_epi8('-')),
+                        _mm_cmpeq_epi8(x, _mm_set1_epi8('.'))),
+                    _mm_or_si128(
+                        _mm_cmpeq_epi8(x, _mm_set1_epi8('_')),
+                        _mm_cmpeq_epi8(x, _mm_set1_epi8('~')))));
+            unsigned const m = ~static_cast<unsigned>(
+                _mm_movemask_epi8(ok)) & 0xffff;
+            if(m)
+            {
+                it += boost::core::countr_zero(m);
+                break;
+            }
+            it += 16;
+        }
+#endif
+        while( it != end &&
+            unreserved_chars(*it))
+            ++it;
+        if( it == end ||
+            *it != '%')
+            return it;
+        if( end - it < 3 ||
+            grammar::hexdig_value(it[1]) < 0 ||
+            grammar::hexdig_value(it[2]) < 0)
+        {
+            // expected HEXDIG
+            return nullptr;
+        }
+        it += 3;
+        ++np;
+    }
+}
+
+} // (anon)
+
+result<authority_view>
+parse_host_port(
+    string_view s) noexcept
+{
+    if(s.size() > authority_view::max_size())
+        detail::throw_length_error(
+            "too large");
+    detail::url_impl u(true);
+    u.cs_ = s.data();
+    char const* it = s.data();
+    char const* const end =
+        it + s.size();
+
+    // host
+    if( it != end &&
+        *it == '[')
+    {
+        // IP-literal
+        auto rv = grammar::parse(
+            it, end, detail::host_rule);
+        if(! rv)
+            return rv.error();
+        u.apply_host(
+            rv->host_type, rv->match,
+                rv->addr, rv->name);
+    }
+    else
+    {
+        unsigned char addr[16] = {};
+        char const* p = it;
+        std::uint32_t v;
+        grammar::error ev;
+        if( it != end &&
+            *it >= '0' && *it <= '9' &&
+            detail::parse_ipv4(p, end, v, ev))
+        {
+            // IPv4address
+            addr[0] = static_cast<
+                unsigned char>(v >> 24);
+            addr[1] = static_cast<
+                unsigned char>(v >> 16);
+            addr[2] = static_cast<
+                unsigned char>(v >> 8);
+            addr[3] = static_cast<
+                unsigned char>(v);
+            u.apply_host(
+                host_type::ipv4,
+                string_view(it, p - it),
+                addr, {});
+        }
+        else
+        {
+            // reg-name
+            std::size_t np = 0;
+            p = host_port_reg_name(
+                it, end, np);
+            if(! p)
+            {
+                BOOST_URL_RETURN_EC(
+                    grammar::error::invalid);
+            }
+            string_view const name(
+                it, p - it);
+            u.apply_host(
+                host_type::name, name, addr,
+                detail::access::construct(
+                    name, name.size() - 2 * np));
+        }
+        it = p;
+    }
+
+    // [ ":" port ]
+    if(it != end)
+    {
+        if(*it != ':')
+        {
+            // userinfo, or
+            // invalid char
+            BOOST_URL_RETURN_EC(
+                grammar::error::leftover);
+        }
+        auto rv = grammar::parse(
+            it, end, detail::port_part_rule);
+        if(! rv)
+            return rv.error();
+        if(it != end)
+        {
+            // not DIGIT
+            BOOST_URL_RETURN_EC(
+                grammar::error::leftover);
+        }
+        u.apply_port(
+            rv->port,
+            rv->port_number);
+    }
+
+    return u.construct_authority();
 }
 
 } // urls
@@ -0,0 +1,238 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_IMPL_BASE_RESOLVER_IPP
+#define BOOST_URL_IMPL_BASE_RESOLVER_IPP
+
+#include <boost/url/base_resolver.hpp>
+#include <boost/url/pct_encoding.hpp>
+#include <boost/url/detail/except.hpp>
+#include <boost/url/detail/path.hpp>
+#include <boost/url/detail/remove_dot_segments.hpp>
+#include <algorithm>
+#include <cstring>
+
+namespace boost {
+namespace urls {
+
+base_resolver::
+base_resolver(
+    url_view_base const& base)
+    : u_(base.u_)
+{
+    if(! base.has_scheme())
+        detail::throw_invalid_argument(
+            "not a base");
+
+    // 5.2.3. Merge Paths
+    string_view const p = u_.get(id_path);
+    auto const pos = p.find_last_of('/');
+    if(pos == string_view::npos)
+    {
+        dir_ = u_.offset(id_path);
+        dir_slashes_ = 0;
+        // merged as "/" when there
+        // is an authority
+        dir_decoded_ =
+            u_.len(id_user) > 0 ? 1 : 0;
+        return;
+    }
+    string_view const d = p.substr(0, pos + 1);
+    dir_ = u_.offset(id_path) + d.size();
+    dir_slashes_ = std::count(
+        d.begin() + 1, d.end(), '/');
+    dir_decoded_ =
+        pct_decode_bytes_unchecked(d);
+}
+
+std::size_t
+base_resolver::
+resolved_size(
+    url_view_base const& ref) const noexcept
+{
+    auto const& r = ref.u_;
+    if(r.len(id_scheme) > 0)
+        return r.offset(id_end);
+    if(r.len(id_user) > 0)
+        return u_.len(id_scheme) +
+            r.offset(id_end);
+    if(r.len(id_path) == 0)
+        return u_.offset(id_query) + (
+            r.len(id_query) > 0
+                ? r.len(id_query)
+                : u_.len(id_query)) +
+            r.len(id_frag);
+    if(r.cs_[r.offset(id_path)] == '/')
+        return u_.offset(id_path) +
+            r.offset(id_end);
+    if( u_.len(id_user) > 0 &&
+        u_.len(id_path) == 0)
+        return u_.offset(id_path) + 1 +
+            r.offset(id_end);
+    return dir_ + r.offset(id_end);
+}
+
+void
+base_resolver::
+resolve(
+    url_view_base const& ref,
+    url_base& dest) const
+{
+    BOOST_ASSERT(&dest != &ref);
+    dest.reserve(resolved_size(ref));
+    auto const n = write(
+        ref, dest.s_, dest.u_);
+    dest.s_[n] = '\0';
+}
+
+url_view
+base_resolver::
+resolve(
+    url_view_base const& ref,
+    char* dest,
+    std::size_t size) const
+{
+    if(size < resolved_size(ref))
+        detail::throw_length_error(
+            "buffer too small");
+    detail::url_impl u(false);
+    write(ref, dest, u);
+    return u.construct();
+}
+
+//------------------------------------------------
+
+/*  Write the result of resolving ref into
+    dest, which holds resolved_size(ref)
+    characters, and describe it in u.
+*/
+std::size_t
+base_resolver::
+write(
+    url_view_base const& ref,
+    char* dest,
+    detail::url_impl& u) const noexcept
+{
+    auto const& r = ref.u_;
+
+    // copy [first, last) of ref to
+    // dest + pos, as the same parts
+    auto const append_ref =
+        [&r, &u, dest](
+            std::size_t pos,
+            int first)
+    {
+        std::memcpy(dest + pos,
+            r.cs_ + r.offset(first),
+            r.len(first, id_end));
+        for(int id = first;
+                id <= id_end; ++id)
+            u.offset_[id] = pos +
+                r.offset(id) - r.offset(first);
+        for(int id = first;
+                id < id_end; ++id)
+            u.decoded_[id] = r.decoded_[id];
+    };
+
+    if(r.len(id_scheme) > 0)
+    {
+        // reference is absolute
+        u = r;
+        std::memcpy(dest,
+            r.cs_, r.offset(id_end));
+    }
+    else if(r.len(id_user) > 0)
+    {
+        // scheme of base, rest of ref
+        u = r;
+        u.scheme_ = u_.scheme_;
+        std::memcpy(dest, u_.cs_,
+            u_.len(id_scheme));
+        append_ref(
+            u_.len(id_scheme), id_user);
+    }
+    else if(r.len(id_path) == 0)
+    {
+        // base up to the query
+        u = u_;
+        std::memcpy(dest, u_.cs_,
+            u_.offset(id_query));
+        if(r.len(id_query) > 0)
+        {
+            append_ref(
+                u_.offset(id_query), id_query);
+            u.nparam_ = r.nparam_;
+        }
+        else
+        {
+            std::memcpy(
+                dest + u_.offset(id_query),
+                u_.cs_ + u_.offset(id_query),
+                u_.len(id_query));
+            u.offset_[id_frag] =
+                u_.offset(id_frag);
+            u.offset_[id_end] =
+                u_.offset(id_frag);
+            u.decoded_[id_frag] = 0;
+            if(r.len(id_frag) > 0)
+                append_ref(
+                    u_.offset(id_frag), id_frag);
+        }
+    }
+    else
+    {
+        // origin of base, merged path
+        // followed by rest of ref
+        u = u_;
+        u.nparam_ = r.nparam_;
+        std::memcpy(dest, u_.cs_,
+            u_.offset(id_path));
+        std::size_t pos = u_.offset(id_path);
+        if(r.cs_[r.offset(id_path)] == '/')
+        {
+            append_ref(pos, id_path);
+            u.nseg_ = r.nseg_;
+        }
+        else
+        {
+            string_view const d =
+                encoded_directory();
+            std::memcpy(dest + pos,
+                d.data(), d.size());
+            pos += d.size();
+            append_ref(pos, id_path);
+            u.offset_[id_path] =
+                u_.offset(id_path);
+            u.decoded_[id_path] +=
+                dir_decoded_;
+
+            // count the merged segments,
+            // including any prefix of ref
+            string_view const rp =
+                r.get(id_path);
+            std::size_t const raw =
+                dir_slashes_ +
+                r.nseg_ + (
+                    detail::path_prefix(
+                        rp) == 2);
+            u.nseg_ = detail::path_segments(
+                string_view(
+                    dest + u.offset(id_path),
+                    u.len(id_path)), raw);
+        }
+    }
+    u.cs_ = dest;
+    return detail::remove_dot_segments(
+        dest, u, false);
+}
+
+} // urls
+} // boost
+
+#endif
@@ -0,0 +1,189 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_IMPL_CIDR_MAP_HPP
+#define BOOST_URL_IMPL_CIDR_MAP_HPP
+
+#include <boost/url/detail/except.hpp>
+
+namespace boost {
+namespace urls {
+
+namespace detail {
+
+inline
+void
+cidr_bytes(
+    ipv4_address const& a,
+    unsigned char* addr) noexcept
+{
+    auto const u = a.to_uint();
+    addr[0] = static_cast<
+        unsigned char>(u >> 24);
+    addr[1] = static_cast<
+        unsigned char>(u >> 16);
+    addr[2] = static_cast<
+        unsigned char>(u >> 8);
+    addr[3] = static_cast<
+        unsigned char>(u);
+}
+
+} // detail
+
+template<class T>
+void
+cidr_map<T>::
+insert(
+    string_view prefix,
+    T value)
+{
+    bool v6;
+    unsigned char addr[16];
+    unsigned len;
+    if(! detail::cidr_trie::parse(
+            prefix, v6, addr, len))
+        detail::throw_invalid_argument(
+            "bad prefix");
+    v_.push_back(item{std::move(value)});
+    try
+    {
+        impl_.insert(v6, addr, len,
+            v_.size() - 1);
+    }
+    catch(...)
+    {
+        v_.pop_back();
+        throw;
+    }
+}
+
+template<class T>
+void
+cidr_map<T>::
+insert(
+    ipv4_address const& addr,
+    unsigned len,
+    T value)
+{
+    unsigned char b[4];
+    detail::cidr_bytes(addr, b);
+    v_.push_back(item{std::move(value)});
+    try
+    {
+        impl_.insert(false, b, len,
+            v_.size() - 1);
+    }
+    catch(...)
+    {
+        v_.pop_back();
+        throw;
+    }
+}
+
+template<class T>
+void
+cidr_map<T>::
+insert(
+    ipv6_address const& addr,
+    unsigned len,
+    T value)
+{
+    auto const b = addr.to_bytes();
+    v_.push_back(item{std::move(value)});
+    try
+    {
+        impl_.insert(true, b.data(), len,
+            v_.size() - 1);
+    }
+    catch(...)
+    {
+        v_.pop_back();
+        throw;
+    }
+}
+
+template<class T>
+std::size_t
+cidr_map<T>::
+insert_list(
+    string_view list,
+    T value)
+{
+    v_.push_back(item{std::move(value)});
+    std::size_t n;
+    try
+    {
+        n = impl_.insert_list(list,
+            v_.size() - 1);
+    }
+    catch(...)
+    {
+        v_.pop_back();
+        throw;
+    }
+    if(n == 0)
+        v_.pop_back();
+    return n;
+}
+
+template<class T>
+auto
+cidr_map<T>::
+find(ipv4_address const& addr) const noexcept ->
+    T const*
+{
+    unsigned char b[4];
+    detail::cidr_bytes(addr, b);
+    auto const i = impl_.find_v4(b);
+    if(i == string_view::npos)
+        return nullptr;
+    return &v_[i].value;
+}
+
+template<class T>
+auto
+cidr_map<T>::
+find(ipv6_address const& addr) const noexcept ->
+    T const*
+{
+    auto const b = addr.to_bytes();
+    auto const i = impl_.find_v6(b.data());
+    if(i == string_view::npos)
+        return nullptr;
+    return &v_[i].value;
+}
+
+template<class T>
+auto
+cidr_map<T>::
+find(url_view_base const& u) const noexcept ->
+    T const*
+{
+    auto const i = impl_.find(u.u_);
+    if(i == string_view::npos)
+        return nullptr;
+    return &v_[i].value;
+}
+
+template<class T>
+auto
+cidr_map<T>::
+find(authority_view const& a) const noexcept ->
+    T const*
+{
+    auto const i = impl_.find(a.u_);
+    if(i == string_view::npos)
+        return nullptr;
+    return &v_[i].value;
+}
+
+} // urls
+} // boost
+
+#endif
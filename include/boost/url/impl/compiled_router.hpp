@@ -0,0 +1,56 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_IMPL_COMPILED_ROUTER_HPP
+#define BOOST_URL_IMPL_COMPILED_ROUTER_HPP
+
+namespace boost {
+namespace urls {
+
+template<class T>
+compiled_router<T>::
+compiled_router(
+    router<T> const& r)
+    : impl_(r.impl_)
+    , v_(r.v_)
+{
+}
+
+template<class T>
+auto
+compiled_router<T>::
+find(
+    string_view path,
+    route_match& m) const noexcept ->
+        T const*
+{
+    auto const i = impl_.find(path, m);
+    if(i == string_view::npos)
+        return nullptr;
+    return &v_[i];
+}
+
+template<class T>
+auto
+compiled_router<T>::
+find(
+    string_view path,
+    route_match& m) noexcept ->
+        T*
+{
+    auto const i = impl_.find(path, m);
+    if(i == string_view::npos)
+        return nullptr;
+    return &v_[i];
+}
+
+} // urls
+} // boost
+
+#endif
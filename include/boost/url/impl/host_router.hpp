@@ -0,0 +1,86 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_IMPL_HOST_ROUTER_HPP
+#define BOOST_URL_IMPL_HOST_ROUTER_HPP
+
+namespace boost {
+namespace urls {
+
+template<class T>
+void
+host_router<T>::
+insert(
+    string_view host,
+    T value)
+{
+    v_.push_back(std::move(value));
+    try
+    {
+        impl_.insert(host, v_.size() - 1);
+    }
+    catch(...)
+    {
+        v_.pop_back();
+        throw;
+    }
+}
+
+template<class T>
+auto
+host_router<T>::
+find(url_view_base const& u) const noexcept ->
+    T const*
+{
+    auto const i = impl_.find(u.u_);
+    if(i == string_view::npos)
+        return nullptr;
+    return &v_[i];
+}
+
+template<class T>
+auto
+host_router<T>::
+find(url_view_base const& u) noexcept ->
+    T*
+{
+    auto const i = impl_.find(u.u_);
+    if(i == string_view::npos)
+        return nullptr;
+    return &v_[i];
+}
+
+template<class T>
+auto
+host_router<T>::
+find(authority_view const& a) const noexcept ->
+    T const*
+{
+    auto const i = impl_.find(a.u_);
+    if(i == string_view::npos)
+        return nullptr;
+    return &v_[i];
+}
+
+template<class T>
+auto
+host_router<T>::
+find(authority_view const& a) noexcept ->
+    T*
+{
+    auto const i = impl_.find(a.u_);
+    if(i == string_view::npos)
+        return nullptr;
+    return &v_[i];
+}
+
+} // urls
+} // boost
+
+#endif
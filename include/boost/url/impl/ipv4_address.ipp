@@ -12,12 +12,87 @@
 
 #include <boost/url/ipv4_address.hpp>
 #include <boost/url/detail/except.hpp>
+#include <boost/url/detail/ipv4.hpp>
 #include <boost/url/rfc/ipv4_address_rule.hpp>
 #include <cstring>
 
 namespace boost {
 namespace urls {
 
+namespace detail {
+namespace {
+
+// The digits of each octet,
+// followed by their count
+constexpr char dec_octet_chars[256][4] = {
+    { '0', 0, 0, 1 }, { '1', 0, 0, 1 }, { '2', 0, 0, 1 }, { '3', 0, 0, 1 },
+    { '4', 0, 0, 1 }, { '5', 0, 0, 1 }, { '6', 0, 0, 1 }, { '7', 0, 0, 1 },
+    { '8', 0, 0, 1 }, { '9', 0, 0, 1 }, { '1', '0', 0, 2 }, { '1', '1', 0, 2 },
+    { '1', '2', 0, 2 }, { '1', '3', 0, 2 }, { '1', '4', 0, 2 }, { '1', '5', 0, 2 },
+    { '1', '6', 0, 2 }, { '1', '7', 0, 2 }, { '1', '8', 0, 2 }, { '1', '9', 0, 2 },
+    { '2', '0', 0, 2 }, { '2', '1', 0, 2 }, { '2', '2', 0, 2 }, { '2', '3', 0, 2 },
+    { '2', '4', 0, 2 }, { '2', '5', 0, 2 }, { '2', '6', 0, 2 }, { '2', '7', 0, 2 },
+    { '2', '8', 0, 2 }, { '2', '9', 0, 2 }, { '3', '0', 0, 2 }, { '3', '1', 0, 2 },
+    { '3', '2', 0, 2 }, { '3', '3', 0, 2 }, { '3', '4', 0, 2 }, { '3', '5', 0, 2 },
+    { '3', '6', 0, 2 }, { '3', '7', 0, 2 }, { '3', '8', 0, 2 }, { '3', '9', 0, 2 },
+    { '4', '0', 0, 2 }, { '4', '1', 0, 2 }, { '4', '2', 0, 2 }, { '4', '3', 0, 2 },
+    { '4', '4', 0, 2 }, { '4', '5', 0, 2 }, { '4', '6', 0, 2 }, { '4', '7', 0, 2 },
+    { '4', '8', 0, 2 }, { '4', '9', 0, 2 }, { '5', '0', 0, 2 }, { '5', '1', 0, 2 },
+    { '5', '2', 0, 2 }, { '5', '3', 0, 2 }, { '5', '4', 0, 2 }, { '5', '5', 0, 2 },
+    { '5', '6', 0, 2 }, { '5', '7', 0, 2 }, { '5', '8', 0, 2 }, { '5', '9', 0, 2 },
+    { '6', '0', 0, 2 }, { '6', '1', 0, 2 }, { '6', '2', 0, 2 }, { '6', '3', 0, 2 },
+    { '6', '4', 0, 2 }, { '6', '5', 0, 2 }, { '6', '6', 0, 2 }, { '6', '7', 0, 2 },
+    { '6', '8', 0, 2 }, { '6', '9', 0, 2 }, { '7', '0', 0, 2 }, { '7', '1', 0, 2 },
+    { '7', '2', 0, 2 }, { '7', '3', 0, 2 }, { '7', '4', 0, 2 }, { '7', '5', 0, 2 },
+    { '7', '6', 0, 2 }, { '7', '7', 0, 2 }, { '7', '8', 0, 2 }, { '7', '9', 0, 2 },
+    { '8', '0', 0, 2 }, { '8', '1', 0, 2 }, { '8', '2', 0, 2 }, { '8', '3', 0, 2 },
+    { '8', '4', 0, 2 }, { '8', '5', 0, 2 }, { '8', '6', 0, 2 }, { '8', '7', 0, 2 },
+    { '8', '8', 0, 2 }, { '8', '9', 0, 2 }, { '9', '0', 0, 2 }, { '9', '1', 0, 2 },
+    { '9', '2', 0, 2 }, { '9', '3', 0, 2 }, { '9', '4', 0, 2 }, { '9', '5', 0, 2 },
+    { '9', '6', 0, 2 }, { '9', '7', 0, 2 }, { '9', '8', 0, 2 }, { '9', '9', 0, 2 },
+    { '1', '0', '0', 3 }, { '1', '0', '1', 3 }, { '1', '0', '2', 3 }, { '1', '0', '3', 3 },
+    { '1', '0', '4', 3 }, { '1', '0', '5', 3 }, { '1', '0', '6', 3 }, { '1', '0', '7', 3 },
+    { '1', '0', '8', 3 }, { '1', '0', '9', 3 }, { '1', '1', '0', 3 }, { '1', '1', '1', 3 },
+    { '1', '1', '2', 3 }, { '1', '1', '3', 3 }, { '1', '1', '4', 3 }, { '1', '1', '5', 3 },
+    { '1', '1', '6', 3 }, { '1', '1', '7', 3 }, { '1', '1', '8', 3 }, { '1', '1', '9', 3 },
+    { '1', '2', '0', 3 }, { '1', '2', '1', 3 }, { '1', '2', '2', 3 }, { '1', '2', '3', 3 },
+    { '1', '2', '4', 3 }, { '1', '2', '5', 3 }, { '1', '2', '6', 3 }, { '1', '2', '7', 3 },
+    { '1', '2', '8', 3 }, { '1', '2', '9', 3 }, { '1', '3', '0', 3 }, { '1', '3', '1', 3 },
+    { '1', '3', '2', 3 }, { '1', '3', '3', 3 }, { '1', '3', '4', 3 }, { '1', '3', '5', 3 },
+    { '1', '3', '6', 3 }, { '1', '3', '7', 3 }, { '1', '3', '8', 3 }, { '1', '3', '9', 3 },
+    { '1', '4', '0', 3 }, { '1', '4', '1', 3 }, { '1', '4', '2', 3 }, { '1', '4', '3', 3 },
+    { '1', '4', '4', 3 }, { '1', '4', '5', 3 }, { '1', '4', '6', 3 }, { '1', '4', '7', 3 },
+    { '1', '4', '8', 3 }, { '1', '4', '9', 3 }, { '1', '5', '0', 3 }, { '1', '5', '1', 3 },
+    { '1', '5', '2', 3 }, { '1', '5', '3', 3 }, { '1', '5', '4', 3 }, { '1', '5', '5', 3 },
+    { '1', '5', '6', 3 }, { '1', '5', '7', 3 }, { '1', '5', '8', 3 }, { '1', '5', '9', 3 },
+    { '1', '6', '0', 3 }, { '1', '6', '1', 3 }, { '1', '6', '2', 3 }, { '1', '6', '3', 3 },
+    { '1', '6', '4', 3 }, { '1', '6', '5', 3 }, { '1', '6', '6', 3 }, { '1', '6', '7', 3 },
+    { '1', '6', '8', 3 }, { '1', '6', '9', 3 }, { '1', '7', '0', 3 }, { '1', '7', '1', 3 },
+    { '1', '7', '2', 3 }, { '1', '7', '3', 3 }, { '1', '7', '4', 3 }, { '1', '7', '5', 3 },
+    { '1', '7', '6', 3 }, { '1', '7', '7', 3 }, { '1', '7', '8', 3 }, { '1', '7', '9', 3 },
+    { '1', '8', '0', 3 }, { '1', '8', '1', 3 }, { '1', '8', '2', 3 }, { '1', '8', '3', 3 },
+    { '1', '8', '4', 3 }, { '1', '8', '5', 3 }, { '1', '8', '6', 3 }, { '1', '8', '7', 3 },
+    { '1', '8', '8', 3 }, { '1', '8', '9', 3 }, { '1', '9', '0', 3 }, { '1', '9', '1', 3 },
+    { '1', '9', '2', 3 }, { '1', '9', '3', 3 }, { '1', '9', '4', 3 }, { '1', '9', '5', 3 },
+    { '1', '9', '6', 3 }, { '1', '9', '7', 3 }, { '1', '9', '8', 3 }, { '1', '9', '9', 3 },
+    { '2', '0', '0', 3 }, { '2', '0', '1', 3 }, { '2', '0', '2', 3 }, { '2', '0', '3', 3 },
+    { '2', '0', '4', 3 }, { '2', '0', '5', 3 }, { '2', '0', '6', 3 }, { '2', '0', '7', 3 },
+    { '2', '0', '8', 3 }, { '2', '0', '9', 3 }, { '2', '1', '0', 3 }, { '2', '1', '1', 3 },
+    { '2', '1', '2', 3 }, { '2', '1', '3', 3 }, { '2', '1', '4', 3 }, { '2', '1', '5', 3 },
+    { '2', '1', '6', 3 }, { '2', '1', '7', 3 }, { '2', '1', '8', 3 }, { '2', '1', '9', 3 },
+    { '2', '2', '0', 3 }, { '2', '2', '1', 3 }, { '2', '2', '2', 3 }, { '2', '2', '3', 3 },
+    { '2', '2', '4', 3 }, { '2', '2', '5', 3 }, { '2', '2', '6', 3 }, { '2', '2', '7', 3 },
+    { '2', '2', '8', 3 }, { '2', '2', '9', 3 }, { '2', '3', '0', 3 }, { '2', '3', '1', 3 },
+    { '2', '3', '2', 3 }, { '2', '3', '3', 3 }, { '2', '3', '4', 3 }, { '2', '3', '5', 3 },
+    { '2', '3', '6', 3 }, { '2', '3', '7', 3 }, { '2', '3', '8', 3 }, { '2', '3', '9', 3 },
+    { '2', '4', '0', 3 }, { '2', '4', '1', 3 }, { '2', '4', '2', 3 }, { '2', '4', '3', 3 },
+    { '2', '4', '4', 3 }, { '2', '4', '5', 3 }, { '2', '4', '6', 3 }, { '2', '4', '7', 3 },
+    { '2', '4', '8', 3 }, { '2', '4', '9', 3 }, { '2', '5', '0', 3 }, { '2', '5', '1', 3 },
+    { '2', '5', '2', 3 }, { '2', '5', '3', 3 }, { '2', '5', '4', 3 }, { '2', '5', '5', 3 } };
+
+} // (anon)
+} // detail
+
 ipv4_address::
 ipv4_address(
     uint_type addr) noexcept
@@ -108,24 +183,17 @@ ipv4_address::
 print_impl(
     char* dest) const noexcept
 {
+    // each copy writes three chars,
+    // which fit in max_str_len
     auto const start = dest;
     auto const write =
         []( char*& dest,
-            unsigned char v)
+            unsigned v)
         {
-            if(v >= 100)
-            {
-                *dest++ = '0' +
-                    v / 100;
-                v %= 100;
-            }
-            if(v >= 10)
-            {
-                *dest++ = '0' +
-                    v / 10;
-                v %= 10;
-            }
-            *dest++ = '0' + v;
+            char const* const s =
+                detail::dec_octet_chars[v];
+            std::memcpy(dest, s, 3);
+            dest += s[3];
         };
     auto const v = to_uint();
     write(dest, (v >> 24) & 0xff);
@@ -149,6 +217,34 @@ parse_ipv4_address(
         s, ipv4_address_rule);
 }
 
+std::size_t
+parse_ipv4_batch(
+    string_view const* src,
+    std::size_t n,
+    ipv4_address* dest,
+    bool* valid) noexcept
+{
+    std::size_t count = 0;
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        char const* it = src[i].data();
+        char const* const end =
+            it + src[i].size();
+        std::uint32_t v = 0;
+        grammar::error ev;
+        bool const ok =
+            detail::parse_ipv4(
+                it, end, v, ev) &&
+            it == end;
+        dest[i] = ipv4_address(
+            ok ? v : 0);
+        if(valid)
+            valid[i] = ok;
+        count += ok;
+    }
+    return count;
+}
+
 } // urls
 } // boost
 
@@ -14,8 +14,14 @@
 #include <boost/url/rfc/ipv6_address_rule.hpp>
 #include <boost/url/detail/except.hpp>
 #include <boost/url/grammar/parse.hpp>
+#include <boost/core/bit.hpp>
+#include <cstdint>
 #include <cstring>
 
+#ifdef BOOST_URL_USE_SSE2
+# include <emmintrin.h>
+#endif
+
 namespace boost {
 namespace urls {
 
@@ -103,122 +109,112 @@ ipv6_address::
 print_impl(
     char* dest) const noexcept
 {
-    auto const count_zeroes =
-    []( unsigned char const* first,
-        unsigned char const* const last)
+    // the two hex digits of each byte,
+    // and padding for the last word
+    char hex[36] = {};
+#ifdef BOOST_URL_USE_SSE2
     {
-        std::size_t n = 0;
-        while(first != last)
+        __m128i const x = _mm_loadu_si128(
+            reinterpret_cast<__m128i const*>(
+                addr_.data()));
+        __m128i const m = _mm_set1_epi8(0x0f);
+        __m128i const hi = _mm_and_si128(
+            _mm_srli_epi16(x, 4), m);
+        __m128i const lo = _mm_and_si128(x, m);
+        auto const to_ascii = [](__m128i v)
         {
-            if( first[0] != 0 ||
-                first[1] != 0)
-                break;
-            n += 2;
-            first += 2;
-        }
-        return n;
-    };
-    auto const print_hex =
-    []( char* dest,
-        unsigned short v)
+            // '0' + v, then 'a' - '0' - 10
+            // more for the nibbles over 9
+            return _mm_add_epi8(
+                _mm_add_epi8(v, _mm_set1_epi8('0')),
+                _mm_and_si128(
+                    _mm_cmpgt_epi8(v, _mm_set1_epi8(9)),
+                    _mm_set1_epi8('a' - '0' - 10)));
+        };
+        _mm_storeu_si128(
+            reinterpret_cast<__m128i*>(hex),
+            to_ascii(_mm_unpacklo_epi8(hi, lo)));
+        _mm_storeu_si128(
+            reinterpret_cast<__m128i*>(hex + 16),
+            to_ascii(_mm_unpackhi_epi8(hi, lo)));
+    }
+#else
+    for(std::size_t i = 0; i < 16; ++i)
     {
         char const* const dig =
             "0123456789abcdef";
-        if(v >= 0x1000)
-        {
-            *dest++ = dig[v>>12];
-            v &= 0x0fff;
-            *dest++ = dig[v>>8];
-            v &= 0x0ff;
-            *dest++ = dig[v>>4];
-            v &= 0x0f;
-            *dest++ = dig[v];
-        }
-        else if(v >= 0x100)
-        {
-            *dest++ = dig[v>>8];
-            v &= 0x0ff;
-            *dest++ = dig[v>>4];
-            v &= 0x0f;
-            *dest++ = dig[v];
-        }
-        else if(v >= 0x10)
-        {
-            *dest++ = dig[v>>4];
-            v &= 0x0f;
-            *dest++ = dig[v];
-        }
-        else
-        {
-            *dest++ = dig[v];
-        }
-        return dest;
-    };
+        hex[2 * i    ] = dig[addr_[i] >> 4];
+        hex[2 * i + 1] = dig[addr_[i] & 0xf];
+    }
+#endif
     auto const dest0 = dest;
-    // find longest run of zeroes
-    std::size_t best_len = 0;
-    int best_pos = -1;
-    auto it = addr_.data();
     auto const v4 =
         is_v4_mapped();
-    auto const end = v4 ?
-        (it + addr_.size() - 4)
-        : it + addr_.size();
-    while(it != end)
+    int const nw = v4 ? 6 : 8;
+
+    // find longest run of zeroes,
+    // the first one on a tie
+    unsigned zeroes = 0;
+    for(int i = 0; i < nw; ++i)
+        zeroes |= static_cast<unsigned>(
+            (addr_[2 * i] | addr_[2 * i + 1]) == 0) << i;
+    int best_len = 0;
+    unsigned runs = 0;
+    while(zeroes)
     {
-        auto n = count_zeroes(
-            it, end);
-        if(n == 0)
-        {
-            it += 2;
-            continue;
-        }
-        if(n > best_len)
-        {
-            best_pos = static_cast<
-                int>(it - addr_.data());
-            best_len = n;
-        }
-        it += n;
+        // bit i is set while the words
+        // from i to i + best_len are zero
+        runs = zeroes;
+        zeroes &= zeroes >> 1;
+        ++best_len;
     }
-    it = addr_.data();
-    if(best_pos != 0)
+    int const best_pos = best_len ?
+        boost::core::countr_zero(runs) : nw;
+
+    // Write the four digits of word i and
+    // keep the significant ones. dest has
+    // room for the extra chars.
+    auto const put = [&hex, this](
+        char* dest, int i)
     {
-        unsigned short v =
-            (it[0] * 256U) + it[1];
-        dest = print_hex(dest, v);
-        it += 2;
-    }
-    else
+        unsigned const v =
+            (addr_[2 * i] * 256U) + addr_[2 * i + 1];
+        int const len = (16 -
+            boost::core::countl_zero(
+                static_cast<std::uint16_t>(v | 1)) + 3) / 4;
+        std::memcpy(dest,
+            hex + 4 * i + 4 - len, 4);
+        return dest + len;
+    };
+    for(int i = 0; i < best_pos; ++i)
     {
+        dest = put(dest, i);
         *dest++ = ':';
-        it += best_len;
-        if(it == end)
-            *dest++ = ':';
     }
-    while(it != end)
+    if(best_len)
     {
-        *dest++ = ':';
-        if(it - addr_.data() ==
-            best_pos)
+        if(best_pos == 0)
+            *dest++ = ':';
+        if(best_pos + best_len == nw)
+            *dest++ = ':';
+        for(int i = best_pos + best_len; i < nw; ++i)
         {
-            it += best_len;
-            if(it == end)
-                *dest++ = ':';
-            continue;
+            *dest++ = ':';
+            dest = put(dest, i);
         }
-        unsigned short v =
-            (it[0] * 256U) + it[1];
-        dest = print_hex(dest, v);
-        it += 2;
+    }
+    else
+    {
+        // no run, drop the last ':'
+        --dest;
     }
     if(v4)
     {
         ipv4_address::bytes_type bytes;
-        bytes[0] = it[0];
-        bytes[1] = it[1];
-        bytes[2] = it[2];
-        bytes[3] = it[3];
+        bytes[0] = addr_[12];
+        bytes[1] = addr_[13];
+        bytes[2] = addr_[14];
+        bytes[3] = addr_[15];
         ipv4_address a(bytes);
         *dest++ = ':';
         dest += a.print_impl(dest);
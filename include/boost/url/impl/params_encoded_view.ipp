@@ -15,6 +15,8 @@
 #include <boost/url/url.hpp>
 #include <boost/url/rfc/query_rule.hpp>
 #include <boost/url/detail/normalize.hpp>
+#include <boost/url/detail/parse_stats.hpp>
+#include <boost/url/detail/query_split.hpp>
 #include <boost/assert.hpp>
 
 namespace boost {
@@ -102,11 +104,17 @@ find(
     BOOST_ASSERT(from.impl_.end_ ==
         s_.data() + s_.size());
 
+    bool const plain =
+        detail::find_key_escape(
+            key.data(),
+            key.data() + key.size(),
+            false) == key.data() + key.size();
     auto const end_ = end();
     while(from != end_)
     {
-        if( detail::compare_encoded(
-                key, from.encoded_key()) == 0)
+        if(detail::encoded_key_equal(
+                from.encoded_key(),
+                key, plain))
             break;
         ++from;
     }
@@ -123,8 +131,10 @@ result<params_encoded_view>
 parse_query_params(
     string_view s) noexcept
 {
-    return grammar::parse(
+    auto rv = grammar::parse(
         s, query_rule);
+    detail::count_parse(s, rv);
+    return rv;
 }
 
 } // urls
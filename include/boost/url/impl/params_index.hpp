@@ -0,0 +1,239 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_IMPL_PARAMS_INDEX_HPP
+#define BOOST_URL_IMPL_PARAMS_INDEX_HPP
+
+#include <boost/assert.hpp>
+
+namespace boost {
+namespace urls {
+
+//------------------------------------------------
+
+class params_index::iterator
+{
+    params_index const* idx_ = nullptr;
+    string_view key_;
+    std::size_t h_ = 0;
+    std::size_t j_ = string_view::npos;
+
+    friend class params_index;
+
+    iterator(
+        params_index const* idx,
+        string_view key,
+        std::size_t h,
+        std::size_t j) noexcept
+        : idx_(idx)
+        , key_(key)
+        , h_(h)
+        , j_(j)
+    {
+    }
+
+public:
+    using value_type = query_param;
+    using reference = query_param_view;
+    using pointer = void const*;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category =
+        std::forward_iterator_tag;
+
+    iterator() = default;
+
+    iterator&
+    operator++() noexcept
+    {
+        BOOST_ASSERT(j_ != string_view::npos);
+        j_ = idx_->match(key_, h_, j_ + 1);
+        return *this;
+    }
+
+    iterator
+    operator++(int) noexcept
+    {
+        auto tmp = *this;
+        ++*this;
+        return tmp;
+    }
+
+    reference
+    operator*() const
+    {
+        BOOST_ASSERT(j_ != string_view::npos);
+        return *idx_->element(j_);
+    }
+
+    /** Return an iterator of the indexed range to this element
+    */
+    params_view::iterator
+    base() const noexcept
+    {
+        if(j_ == string_view::npos)
+            return idx_->params().end();
+        return idx_->element(j_);
+    }
+
+    friend
+    bool
+    operator==(
+        iterator const& a,
+        iterator const& b) noexcept
+    {
+        return a.j_ == b.j_;
+    }
+
+    friend
+    bool
+    operator!=(
+        iterator const& a,
+        iterator const& b) noexcept
+    {
+        return a.j_ != b.j_;
+    }
+};
+
+//------------------------------------------------
+
+class params_encoded_index::iterator
+{
+    params_encoded_index const* idx_ = nullptr;
+    string_view key_;
+    bool plain_ = false;
+    std::size_t h_ = 0;
+    std::size_t j_ = string_view::npos;
+
+    friend class params_encoded_index;
+
+    iterator(
+        params_encoded_index const* idx,
+        string_view key,
+        bool plain,
+        std::size_t h,
+        std::size_t j) noexcept
+        : idx_(idx)
+        , key_(key)
+        , plain_(plain)
+        , h_(h)
+        , j_(j)
+    {
+    }
+
+public:
+    using value_type = query_param;
+    using reference = query_param_encoded_view;
+    using pointer = void const*;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category =
+        std::forward_iterator_tag;
+
+    iterator() = default;
+
+    iterator&
+    operator++() noexcept
+    {
+        BOOST_ASSERT(j_ != string_view::npos);
+        j_ = idx_->match(
+            key_, plain_, h_, j_ + 1);
+        return *this;
+    }
+
+    iterator
+    operator++(int) noexcept
+    {
+        auto tmp = *this;
+        ++*this;
+        return tmp;
+    }
+
+    reference
+    operator*() const
+    {
+        BOOST_ASSERT(j_ != string_view::npos);
+        return *idx_->element(j_);
+    }
+
+    /** Return an iterator of the indexed range to this element
+    */
+    params_encoded_view::iterator
+    base() const noexcept
+    {
+        if(j_ == string_view::npos)
+            return idx_->params().end();
+        return idx_->element(j_);
+    }
+
+    friend
+    bool
+    operator==(
+        iterator const& a,
+        iterator const& b) noexcept
+    {
+        return a.j_ == b.j_;
+    }
+
+    friend
+    bool
+    operator!=(
+        iterator const& a,
+        iterator const& b) noexcept
+    {
+        return a.j_ != b.j_;
+    }
+};
+
+//------------------------------------------------
+
+inline
+auto
+params_index::
+find(
+    string_view key,
+    std::size_t h) const noexcept ->
+        params_view::iterator
+{
+    return equal_range(key, h).first.base();
+}
+
+inline
+auto
+params_index::
+equal_range(string_view key) const noexcept ->
+    std::pair<iterator, iterator>
+{
+    return equal_range(key, hash(key));
+}
+
+//------------------------------------------------
+
+inline
+auto
+params_encoded_index::
+find(
+    string_view key,
+    std::size_t h) const noexcept ->
+        params_encoded_view::iterator
+{
+    return equal_range(key, h).first.base();
+}
+
+inline
+auto
+params_encoded_index::
+equal_range(string_view key) const noexcept ->
+    std::pair<iterator, iterator>
+{
+    return equal_range(key, hash(key));
+}
+
+} // urls
+} // boost
+
+#endif
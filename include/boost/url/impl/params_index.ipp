@@ -0,0 +1,189 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_IMPL_PARAMS_INDEX_IPP
+#define BOOST_URL_IMPL_PARAMS_INDEX_IPP
+
+#include <boost/url/params_index.hpp>
+#include <boost/url/detail/except.hpp>
+#include <boost/url/detail/normalize.hpp>
+#include <boost/url/detail/query_split.hpp>
+
+namespace boost {
+namespace urls {
+
+params_index::
+params_index(
+    params_view const& ps,
+    void* storage,
+    std::size_t size)
+    : impl_(
+        ps.s_, ps.n_, true,
+        storage, size)
+{
+}
+
+std::size_t
+params_index::
+match(
+    string_view key,
+    std::size_t h,
+    std::size_t j) const noexcept
+{
+    for(;;)
+    {
+        j = impl_.probe(h, j);
+        if(j == string_view::npos)
+            return j;
+        // hashes can collide
+        if(detail::key_equal(
+                element(j).impl_.encoded_key(),
+                key, true))
+            return j;
+        ++j;
+    }
+}
+
+auto
+params_index::
+at(
+    string_view key,
+    std::size_t h) const ->
+    pct_encoded_view
+{
+    auto const r = equal_range(key, h);
+    for(auto it = r.first;
+        it != r.second; ++it)
+    {
+        auto const p = *it;
+        if(p.has_value)
+            return p.value;
+    }
+    detail::throw_out_of_range();
+}
+
+std::size_t
+params_index::
+count(
+    string_view key,
+    std::size_t h) const noexcept
+{
+    std::size_t n = 0;
+    auto const r = equal_range(key, h);
+    for(auto it = r.first;
+        it != r.second; ++it)
+        ++n;
+    return n;
+}
+
+auto
+params_index::
+equal_range(
+    string_view key,
+    std::size_t h) const noexcept ->
+    std::pair<iterator, iterator>
+{
+    return {
+        iterator(this, key, h,
+            match(key, h, h)),
+        iterator(this, key, h,
+            string_view::npos) };
+}
+
+//------------------------------------------------
+
+params_encoded_index::
+params_encoded_index(
+    params_encoded_view const& ps,
+    void* storage,
+    std::size_t size)
+    : impl_(
+        ps.s_, ps.n_, false,
+        storage, size)
+{
+}
+
+std::size_t
+params_encoded_index::
+match(
+    string_view key,
+    bool plain,
+    std::size_t h,
+    std::size_t j) const noexcept
+{
+    for(;;)
+    {
+        j = impl_.probe(h, j);
+        if(j == string_view::npos)
+            return j;
+        // hashes can collide
+        if(detail::encoded_key_equal(
+                element(j).encoded_key(),
+                key, plain))
+            return j;
+        ++j;
+    }
+}
+
+auto
+params_encoded_index::
+at(
+    string_view key,
+    std::size_t h) const ->
+    string_view
+{
+    auto const r = equal_range(key, h);
+    for(auto it = r.first;
+        it != r.second; ++it)
+    {
+        auto const p = *it;
+        if(p.has_value)
+            return p.value;
+    }
+    detail::throw_out_of_range();
+}
+
+std::size_t
+params_encoded_index::
+count(
+    string_view key,
+    std::size_t h) const noexcept
+{
+    std::size_t n = 0;
+    auto const r = equal_range(key, h);
+    for(auto it = r.first;
+        it != r.second; ++it)
+        ++n;
+    return n;
+}
+
+auto
+params_encoded_index::
+equal_range(
+    string_view key,
+    std::size_t h) const noexcept ->
+    std::pair<iterator, iterator>
+{
+    // the key is the same for each probe
+    bool const plain =
+        detail::find_key_escape(
+            key.data(),
+            key.data() + key.size(),
+            false) == key.data() + key.size();
+    return {
+        iterator(this, key, plain, h,
+            match(key, plain, h, h)),
+        iterator(this, key, plain, h,
+            string_view::npos) };
+}
+
+} // urls
+} // boost
+
+#endif
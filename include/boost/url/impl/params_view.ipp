@@ -13,6 +13,7 @@
 
 #include <boost/url/params_view.hpp>
 #include <boost/url/url.hpp>
+#include <boost/url/detail/query_split.hpp>
 #include <boost/assert.hpp>
 
 namespace boost {
@@ -101,7 +102,9 @@ find(
     auto const end_ = end();
     while(from != end_)
     {
-        if( (*from).key == key )
+        if(detail::key_equal(
+                from.impl_.encoded_key(),
+                key, true))
             break;
         ++from;
     }
@@ -0,0 +1,216 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_IMPL_PARSE_STATS_IPP
+#define BOOST_URL_IMPL_PARSE_STATS_IPP
+
+#include <boost/url/parse_stats.hpp>
+#include <boost/url/authority_view.hpp>
+#include <boost/url/params_encoded_view.hpp>
+#include <boost/url/segments_encoded_view.hpp>
+#include <boost/url/url_view.hpp>
+#include <boost/url/detail/parse_stats.hpp>
+
+namespace boost {
+namespace urls {
+
+constexpr std::size_t log2_histogram::size;
+
+parse_stats&
+parse_stats::
+operator+=(
+    parse_stats const& other) noexcept
+{
+    parses += other.parses;
+    failures += other.failures;
+    for(std::size_t i = 0; i <
+        sizeof(url_errors) /
+        sizeof(url_errors[0]); ++i)
+        url_errors[i] += other.url_errors[i];
+    for(std::size_t i = 0; i <
+        sizeof(grammar_errors) /
+        sizeof(grammar_errors[0]); ++i)
+        grammar_errors[i] +=
+            other.grammar_errors[i];
+    other_errors += other.other_errors;
+    input += other.input;
+    scheme += other.scheme;
+    user += other.user;
+    password += other.password;
+    host += other.host;
+    port += other.port;
+    path += other.path;
+    query += other.query;
+    fragment += other.fragment;
+    segments += other.segments;
+    params += other.params;
+    return *this;
+}
+
+parse_stats
+thread_parse_stats() noexcept
+{
+    return detail::thread_parse_stats_ref();
+}
+
+void
+reset_thread_parse_stats() noexcept
+{
+    detail::thread_parse_stats_ref() =
+        parse_stats();
+}
+
+namespace detail {
+
+parse_stats&
+thread_parse_stats_ref() noexcept
+{
+#ifndef BOOST_NO_CXX11_THREAD_LOCAL
+    static thread_local parse_stats st;
+#else
+    static parse_stats st;
+#endif
+    return st;
+}
+
+#ifdef BOOST_URL_PARSE_STATS
+
+namespace {
+
+template<std::size_t N>
+void
+count_code(
+    std::size_t (&v)[N],
+    std::size_t& other,
+    int ev) noexcept
+{
+    if( ev >= 0 &&
+        static_cast<std::size_t>(ev) < N)
+        ++v[ev];
+    else
+        ++other;
+}
+
+// Count the call, and return the
+// counters if the parse succeeded
+template<class T>
+parse_stats*
+count_call(
+    string_view s,
+    result<T> const& rv) noexcept
+{
+    auto& st = thread_parse_stats_ref();
+    ++st.parses;
+    st.input.add(s.size());
+    if(! rv.has_error())
+        return &st;
+    ++st.failures;
+    auto const& ec = rv.error();
+    if(ec.category() == make_error_code(
+            error::success).category())
+        count_code(st.url_errors,
+            st.other_errors, ec.value());
+    else if(ec.category() ==
+        grammar::make_error_code(
+            grammar::error::syntax).category())
+        count_code(st.grammar_errors,
+            st.other_errors, ec.value());
+    else
+        ++st.other_errors;
+    return nullptr;
+}
+
+template<class View>
+void
+count_authority(
+    parse_stats& st,
+    View const& v) noexcept
+{
+    if(v.has_userinfo())
+        st.user.add(v.encoded_user().size());
+    if(v.has_password())
+        st.password.add(
+            v.encoded_password().size());
+    st.host.add(v.encoded_host().size());
+    if(v.has_port())
+        st.port.add(v.port().size());
+}
+
+} // (anon)
+
+void
+record_parse(
+    string_view s,
+    result<url_view> const& rv) noexcept
+{
+    auto const st = count_call(s, rv);
+    if(! st)
+        return;
+    auto const& u = *rv;
+    if(u.has_scheme())
+        st->scheme.add(u.scheme().size());
+    if(u.has_authority())
+        count_authority(*st, u);
+    st->path.add(u.encoded_path().size());
+    st->segments.add(
+        u.encoded_segments().size());
+    if(u.has_query())
+    {
+        st->query.add(
+            u.encoded_query().size());
+        st->params.add(
+            u.encoded_params().size());
+    }
+    if(u.has_fragment())
+        st->fragment.add(
+            u.encoded_fragment().size());
+}
+
+void
+record_parse(
+    string_view s,
+    result<authority_view> const& rv) noexcept
+{
+    auto const st = count_call(s, rv);
+    if(st)
+        count_authority(*st, *rv);
+}
+
+void
+record_parse(
+    string_view s,
+    result<params_encoded_view> const& rv) noexcept
+{
+    auto const st = count_call(s, rv);
+    if(! st)
+        return;
+    st->query.add(s.size());
+    st->params.add(rv->size());
+}
+
+void
+record_parse(
+    string_view s,
+    result<segments_encoded_view> const& rv) noexcept
+{
+    auto const st = count_call(s, rv);
+    if(! st)
+        return;
+    st->path.add(s.size());
+    st->segments.add(rv->size());
+}
+
+#endif
+
+} // detail
+
+} // urls
+} // boost
+
+#endif
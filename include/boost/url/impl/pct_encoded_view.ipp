@@ -11,7 +11,6 @@
 #define BOOST_URL_IMPL_PCT_ENCODED_VIEW_IPP
 
 #include <boost/url/pct_encoded_view.hpp>
-#include <boost/url/grammar/detail/copied_strings.hpp>
 #include <ostream>
 
 namespace boost {
@@ -67,20 +66,6 @@ pct_encoded_view(
         detail::throw_invalid_argument();
 }
 
-pct_encoded_view
-pct_encoded_view::
-maybe_copy(
-    grammar::detail::copied_strings_base& sp) const
-{
-    pct_decode_opts opt;
-    opt.plus_to_space =
-        plus_to_space_;
-    return pct_encoded_view(
-        sp.maybe_copy(encoded()),
-        dn_,
-        opt);
-}
-
 //------------------------------------------------
 
 auto
@@ -11,7 +11,7 @@
 #define BOOST_URL_IMPL_PCT_ENCODING_HPP
 
 #include <boost/url/detail/except.hpp>
-#include <boost/url/detail/except.hpp>
+#include <boost/url/detail/usdt.hpp>
 #include <boost/url/pct_encoded_view.hpp>
 #include <boost/url/grammar/hexdig_chars.hpp>
 #include <boost/url/grammar/type_traits.hpp>
@@ -130,19 +130,24 @@ pct_decode(
     BOOST_STATIC_ASSERT(
         grammar::is_charset<CharSet>::value);
 
+    BOOST_URL_PROBE1(pct_decode_entry,
+        s.size());
     auto const n =
         validate_pct_encoding(
             s, ec, allowed, opt);
     if(ec.failed())
+    {
+        BOOST_URL_PROBE2(pct_decode_return,
+            0, ec.value());
         return 0;
+    }
     auto const n1 =
         pct_decode_unchecked(
             dest, end, s, opt);
     if(n1 < n)
-    {
         ec = error::no_space;
-        return n1;
-    }
+    BOOST_URL_PROBE2(pct_decode_return,
+        n1, ec.value());
     return n1;
 }
 
@@ -11,6 +11,7 @@
 #define BOOST_URL_IMPL_PCT_ENCODING_IPP
 
 #include <boost/url/pct_encoding.hpp>
+#include <boost/url/detail/usdt.hpp>
 #include <boost/url/grammar/charset.hpp>
 #include <memory>
 
@@ -251,18 +252,23 @@ pct_decode(
     error_code& ec,
     pct_decode_opts const& opt) noexcept
 {
+    BOOST_URL_PROBE1(pct_decode_entry,
+        s.size());
     auto const n =
         validate_pct_encoding(s, ec, opt);
     if(ec.failed())
+    {
+        BOOST_URL_PROBE2(pct_decode_return,
+            0, ec.value());
         return 0;
+    }
     auto const n1 =
         pct_decode_unchecked(
             dest, end, s, opt);
     if(n1 < n)
-    {
         ec = error::no_space;
-        return n1;
-    }
+    BOOST_URL_PROBE2(pct_decode_return,
+        n1, ec.value());
     return n1;
 }
 
@@ -0,0 +1,107 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_IMPL_QUERY_SCHEMA_HPP
+#define BOOST_URL_IMPL_QUERY_SCHEMA_HPP
+
+namespace boost {
+namespace urls {
+
+namespace detail {
+
+template<std::size_t N>
+struct schema_keys
+{
+    string_view v[N];
+};
+
+template<std::size_t I, class T, class Tuple>
+error_code
+schema_assign(
+    Tuple const& fs,
+    T& t,
+    string_view s,
+    bool has_value)
+{
+    return std::get<I>(fs).assign(
+        t, s, has_value);
+}
+
+template<class T, class Tuple, std::size_t... Is>
+error_code
+schema_dispatch(
+    mp11::index_sequence<Is...>,
+    std::size_t i,
+    Tuple const& fs,
+    T& t,
+    string_view s,
+    bool has_value)
+{
+    using fn_t = error_code(*)(
+        Tuple const&, T&, string_view, bool);
+    static constexpr fn_t fns[] = {
+        &schema_assign<Is, T, Tuple>... };
+    return fns[i](fs, t, s, has_value);
+}
+
+} // detail
+
+template<class... Fields>
+query_schema<Fields...>::
+query_schema(
+    Fields const&... fs) noexcept
+    : fields_(fs...)
+    , table_(detail::schema_keys<
+        sizeof...(Fields)>{{ fs.key... }}.v)
+{
+}
+
+template<class... Fields>
+auto
+query_schema<Fields...>::
+parse(
+    string_view s,
+    value_type& v) const ->
+        result<void>
+{
+    error_code ec;
+    std::size_t i = 0;
+    detail::split_query(s,
+        [&](std::size_t pos,
+            std::size_t n,
+            std::size_t nk)
+        {
+            if(ec)
+                return;
+            // every param but the
+            // first begins with '&'
+            std::size_t const prefix =
+                i++ != 0;
+            std::size_t const j = table_.find(
+                s.substr(pos + prefix, nk - prefix));
+            if(j == table_.npos)
+                return;
+            bool const has_value = nk < n;
+            ec = detail::schema_dispatch(
+                mp11::index_sequence_for<Fields...>{},
+                j, fields_, v,
+                has_value ? s.substr(
+                    pos + nk + 1, n - nk - 1) :
+                    string_view(),
+                has_value);
+        });
+    if(ec)
+        return ec;
+    return {};
+}
+
+} // urls
+} // boost
+
+#endif
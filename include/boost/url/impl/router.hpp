@@ -0,0 +1,66 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_IMPL_ROUTER_HPP
+#define BOOST_URL_IMPL_ROUTER_HPP
+
+namespace boost {
+namespace urls {
+
+template<class T>
+void
+router<T>::
+insert(
+    string_view pattern,
+    T value)
+{
+    v_.push_back(std::move(value));
+    try
+    {
+        impl_.insert(pattern, v_.size() - 1);
+    }
+    catch(...)
+    {
+        v_.pop_back();
+        throw;
+    }
+}
+
+template<class T>
+auto
+router<T>::
+find(
+    segments_encoded_view const& path,
+    route_match& m) const noexcept ->
+        T const*
+{
+    auto const i = impl_.find(path, m);
+    if(i == string_view::npos)
+        return nullptr;
+    return &v_[i];
+}
+
+template<class T>
+auto
+router<T>::
+find(
+    segments_encoded_view const& path,
+    route_match& m) noexcept ->
+        T*
+{
+    auto const i = impl_.find(path, m);
+    if(i == string_view::npos)
+        return nullptr;
+    return &v_[i];
+}
+
+} // urls
+} // boost
+
+#endif
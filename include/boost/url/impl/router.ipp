@@ -0,0 +1,44 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_IMPL_ROUTER_IPP
+#define BOOST_URL_IMPL_ROUTER_IPP
+
+#include <boost/url/router.hpp>
+#include <boost/url/detail/except.hpp>
+
+namespace boost {
+namespace urls {
+
+constexpr std::size_t route_match::max_size;
+
+bool
+route_match::
+contains(string_view name) const noexcept
+{
+    for(std::size_t i = 0; i < n_; ++i)
+        if(names_[i] == name)
+            return true;
+    return false;
+}
+
+string_view
+route_match::
+at(string_view name) const
+{
+    for(std::size_t i = 0; i < n_; ++i)
+        if(names_[i] == name)
+            return values_[i];
+    detail::throw_out_of_range();
+}
+
+} // urls
+} // boost
+
+#endif
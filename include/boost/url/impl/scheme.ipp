@@ -11,100 +11,135 @@
 #define BOOST_URL_IMPL_SCHEME_IPP
 
 #include <boost/url/scheme.hpp>
-#include <boost/url/grammar/ci_string.hpp>
+#include <cstdint>
 
 namespace boost {
 namespace urls {
 
+namespace detail {
+
+// The lowercase chars of a scheme, one per
+// byte. Setting bit 5 lowers ALPHA and
+// leaves DIGIT, "+", "-" and "." unchanged.
+constexpr
+std::uint64_t
+scheme_key(
+    char const* s,
+    std::size_t n,
+    std::uint64_t k = 0) noexcept
+{
+    return n == 0 ? k : scheme_key(
+        s + 1, n - 1, (k << 8) |
+            (static_cast<unsigned char>(*s) | 0x20));
+}
+
+// Perfect hash of the keys of the known
+// schemes into eight slots
+constexpr
+std::size_t
+scheme_slot(std::uint64_t k) noexcept
+{
+    return static_cast<std::size_t>(
+        (k * 0x91b7584a2265b1f5) >> 61);
+}
+
+// The longest known scheme
+constexpr std::size_t scheme_max_size = 5;
+
+struct scheme_entry
+{
+    std::uint64_t key;
+    scheme id;
+};
+
+// Known schemes by slot, with
+// a key of zero when empty
+constexpr scheme_entry scheme_table[8] = {
+    { scheme_key("ftp", 3),   scheme::ftp },
+    { scheme_key("https", 5), scheme::https },
+    { 0,                      scheme::unknown },
+    { 0,                      scheme::unknown },
+    { scheme_key("file", 4),  scheme::file },
+    { scheme_key("ws", 2),    scheme::ws },
+    { scheme_key("wss", 3),   scheme::wss },
+    { scheme_key("http", 4),  scheme::http },
+};
+
+// Adding a scheme means adding it to the
+// enum, to scheme_infos, and to the table
+// at its slot, finding a new multiplier
+// if two schemes share a slot.
+static_assert(scheme_slot(scheme_key("ftp", 3)) == 0, "");
+static_assert(scheme_slot(scheme_key("https", 5)) == 1, "");
+static_assert(scheme_slot(scheme_key("file", 4)) == 4, "");
+static_assert(scheme_slot(scheme_key("ws", 2)) == 5, "");
+static_assert(scheme_slot(scheme_key("wss", 3)) == 6, "");
+static_assert(scheme_slot(scheme_key("http", 4)) == 7, "");
+
+// Known schemes by value
+constexpr scheme_info scheme_infos[] = {
+    { scheme::ftp,   { "ftp", 3 },   21,  true,  true },
+    { scheme::file,  { "file", 4 },  0,   false, true },
+    { scheme::http,  { "http", 4 },  80,  true,  true },
+    { scheme::https, { "https", 5 }, 443, true,  true },
+    { scheme::ws,    { "ws", 2 },    80,  true,  true },
+    { scheme::wss,   { "wss", 3 },   443, true,  true },
+};
+
+} // detail
+
 scheme
 string_to_scheme(
     string_view s) noexcept
 {
-    using grammar::to_lower;
-    switch(s.size())
-    {
-    case 0: // none
+    if(s.empty())
         return scheme::none;
+    if(s.size() > detail::scheme_max_size)
+        return scheme::unknown;
+    std::uint64_t k = 0;
+    for(char c : s)
+        k = (k << 8) | (static_cast<
+            unsigned char>(c) | 0x20);
+    detail::scheme_entry const& e =
+        detail::scheme_table[
+            detail::scheme_slot(k)];
+    if(e.key != k)
+        return scheme::unknown;
+    return e.id;
+}
 
-    case 2: // ws
-        if( to_lower(s[0]) == 'w' &&
-            to_lower(s[1]) == 's')
-            return scheme::ws;
-        break;
-
-    case 3:
-        switch(to_lower(s[0]))
-        {
-        case 'w': // wss
-            if( to_lower(s[1]) == 's' &&
-                to_lower(s[2]) == 's')
-                return scheme::wss;
-            break;
-
-        case 'f': // ftp
-            if( to_lower(s[1]) == 't' &&
-                to_lower(s[2]) == 'p')
-                return scheme::ftp;
-            break;
-
-        default:
-            break;
-        }
-        break;
-
-    case 4:
-        switch(to_lower(s[0]))
-        {
-        case 'f': // file
-            if( to_lower(s[1]) == 'i' &&
-                to_lower(s[2]) == 'l' &&
-                to_lower(s[3]) == 'e')
-                return scheme::file;
-            break;
-
-        case 'h': // http
-            if( to_lower(s[1]) == 't' &&
-                to_lower(s[2]) == 't' &&
-                to_lower(s[3]) == 'p')
-                return scheme::http;
-            break;
-
-        default:
-            break;
-        }
-        break;
-
-    case 5: // https
-        if( to_lower(s[0]) == 'h' &&
-            to_lower(s[1]) == 't' &&
-            to_lower(s[2]) == 't' &&
-            to_lower(s[3]) == 'p' &&
-            to_lower(s[4]) == 's')
-            return scheme::https;
-        break;
-
-    default:
-        break;
-    }
-    return scheme::unknown;
+scheme_info const*
+get_scheme_info(scheme s) noexcept
+{
+    std::size_t const i =
+        static_cast<std::size_t>(s) -
+        static_cast<std::size_t>(scheme::ftp);
+    if(i >= sizeof(detail::scheme_infos) /
+            sizeof(detail::scheme_infos[0]))
+        return nullptr;
+    return &detail::scheme_infos[i];
+}
+
+std::uint16_t
+default_port(scheme s) noexcept
+{
+    scheme_info const* info =
+        get_scheme_info(s);
+    if(! info)
+        return 0;
+    return info->default_port;
 }
 
 string_view
 to_string(scheme s) noexcept
 {
-    switch(s)
-    {
-    case scheme::ftp:   return "ftp";
-    case scheme::file:  return "file";
-    case scheme::http:  return "http";
-    case scheme::https: return "https";
-    case scheme::ws:    return "ws";
-    case scheme::wss:   return "wss";
-    case scheme::none:  return {};
-    default:
-        break;
-    }
-    return "<unknown>";
+    if(s == scheme::none)
+        return {};
+    scheme_info const* info =
+        get_scheme_info(s);
+    if(! info)
+        return "<unknown>";
+    return info->name;
 }
 
 } // urls
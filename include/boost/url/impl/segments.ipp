@@ -39,17 +39,17 @@ insert(
         before.impl_.pos_ <=
         u_->string().data() +
         u_->string().size());
-    grammar::detail::copied_strings<
-        BOOST_URL_STACK_BYTES> cs(
-            u_->string());
-    s = cs.maybe_copy(s);
-    u_->edit_segments(
-        before.impl_.i_,
-        before.impl_.i_,
-        detail::make_plain_segs_iter(
-            &s, &s + 1),
-        detail::make_plain_segs_iter(
-            &s, &s + 1));
+    {
+        url_base::op_t op(*u_, &s);
+        u_->edit_segments(
+            before.impl_.i_,
+            before.impl_.i_,
+            detail::make_plain_segs_iter(
+                &s, &s + 1),
+            detail::make_plain_segs_iter(
+                &s, &s + 1),
+            op);
+    }
     return std::next(begin(), before.impl_.i_);
 }
 
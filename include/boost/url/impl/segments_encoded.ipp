@@ -14,7 +14,6 @@
 #include <boost/url/segments_encoded.hpp>
 #include <boost/url/url.hpp>
 #include <boost/url/detail/path.hpp>
-#include <boost/url/grammar/detail/copied_strings.hpp>
 
 namespace boost {
 namespace urls {
@@ -64,16 +63,18 @@ insert(
     BOOST_ASSERT(before.impl_.pos_ >= u_->string().data());
     BOOST_ASSERT(before.impl_.pos_ <= u_->string().data() +
         u_->string().size());
-    grammar::detail::copied_strings<
-        BOOST_URL_STACK_BYTES> cs(u_->string());
-    auto s = cs.maybe_copy(s0);
-    u_->edit_segments(
-        before.impl_.i_,
-        before.impl_.i_,
-        detail::make_enc_segs_iter(
-            &s, &s + 1),
-        detail::make_enc_segs_iter(
-            &s, &s + 1));
+    auto s = s0;
+    {
+        url_base::op_t op(*u_, &s);
+        u_->edit_segments(
+            before.impl_.i_,
+            before.impl_.i_,
+            detail::make_enc_segs_iter(
+                &s, &s + 1),
+            detail::make_enc_segs_iter(
+                &s, &s + 1),
+            op);
+    }
     return std::next(begin(), before.impl_.i_);
 }
 
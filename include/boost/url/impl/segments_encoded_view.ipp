@@ -14,6 +14,7 @@
 #include <boost/url/segments_view.hpp>
 #include <boost/url/error.hpp>
 #include <boost/url/detail/except.hpp>
+#include <boost/url/detail/parse_stats.hpp>
 #include <boost/url/detail/path.hpp>
 #include <boost/url/grammar/parse.hpp>
 #include <boost/url/rfc/query_rule.hpp>
@@ -65,31 +66,37 @@ end() const noexcept ->
 result<segments_encoded_view>
 parse_path(string_view s) noexcept
 {
-    if(s.empty())
-        return segments_encoded_view();
-    if(s[0] == '/')
+    result<segments_encoded_view> rv =
+        segments_encoded_view();
+    if( ! s.empty() &&
+        s[0] == '/')
     {
-        auto rv = grammar::parse(
+        auto r = grammar::parse(
             s, detail::path_abempty_rule);
-        if(! rv)
-            return rv.error();
-        return segments_encoded_view(
-            rv->string(),
-            detail::path_segments(
-                rv->string(),
-                rv->size()));
+        if(! r)
+            rv = r.error();
+        else
+            rv = segments_encoded_view(
+                r->string(),
+                detail::path_segments(
+                    r->string(),
+                    r->size()));
     }
+    else if(! s.empty())
     {
-        auto rv = grammar::parse(
+        auto r = grammar::parse(
             s, detail::path_rootless_rule);
-        if(! rv)
-            return rv.error();
-        return segments_encoded_view(
-            rv->string(),
-            detail::path_segments(
-                rv->string(),
-                rv->size()));
+        if(! r)
+            rv = r.error();
+        else
+            rv = segments_encoded_view(
+                r->string(),
+                detail::path_segments(
+                    r->string(),
+                    r->size()));
     }
+    detail::count_parse(s, rv);
+    return rv;
 }
 
 } // urls
@@ -0,0 +1,425 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_IMPL_SEGMENTS_INDEX_HPP
+#define BOOST_URL_IMPL_SEGMENTS_INDEX_HPP
+
+#include <boost/assert.hpp>
+#include <string>
+
+namespace boost {
+namespace urls {
+
+//------------------------------------------------
+
+class segments_index::iterator
+{
+    segments_index const* idx_ = nullptr;
+    std::size_t i_ = 0;
+
+    friend class segments_index;
+
+    iterator(
+        segments_index const* idx,
+        std::size_t i) noexcept
+        : idx_(idx)
+        , i_(i)
+    {
+    }
+
+public:
+    using value_type = std::string;
+    using reference = pct_encoded_view;
+    using pointer = void const*;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category =
+        std::random_access_iterator_tag;
+
+    iterator() = default;
+
+    reference
+    operator*() const noexcept
+    {
+        return (*idx_)[i_];
+    }
+
+    reference
+    operator[](difference_type n) const noexcept
+    {
+        return (*idx_)[i_ + n];
+    }
+
+    iterator&
+    operator++() noexcept
+    {
+        ++i_;
+        return *this;
+    }
+
+    iterator
+    operator++(int) noexcept
+    {
+        auto tmp = *this;
+        ++i_;
+        return tmp;
+    }
+
+    iterator&
+    operator--() noexcept
+    {
+        --i_;
+        return *this;
+    }
+
+    iterator
+    operator--(int) noexcept
+    {
+        auto tmp = *this;
+        --i_;
+        return tmp;
+    }
+
+    iterator&
+    operator+=(difference_type n) noexcept
+    {
+        i_ += n;
+        return *this;
+    }
+
+    iterator&
+    operator-=(difference_type n) noexcept
+    {
+        i_ -= n;
+        return *this;
+    }
+
+    friend
+    iterator
+    operator+(
+        iterator it,
+        difference_type n) noexcept
+    {
+        return it += n;
+    }
+
+    friend
+    iterator
+    operator+(
+        difference_type n,
+        iterator it) noexcept
+    {
+        return it += n;
+    }
+
+    friend
+    iterator
+    operator-(
+        iterator it,
+        difference_type n) noexcept
+    {
+        return it -= n;
+    }
+
+    friend
+    difference_type
+    operator-(
+        iterator const& a,
+        iterator const& b) noexcept
+    {
+        BOOST_ASSERT(a.idx_ == b.idx_);
+        return static_cast<difference_type>(a.i_) -
+            static_cast<difference_type>(b.i_);
+    }
+
+    friend
+    bool
+    operator==(
+        iterator const& a,
+        iterator const& b) noexcept
+    {
+        BOOST_ASSERT(a.idx_ == b.idx_);
+        return a.i_ == b.i_;
+    }
+
+    friend
+    bool
+    operator!=(
+        iterator const& a,
+        iterator const& b) noexcept
+    {
+        return !(a == b);
+    }
+
+    friend
+    bool
+    operator<(
+        iterator const& a,
+        iterator const& b) noexcept
+    {
+        return a.i_ < b.i_;
+    }
+
+    friend
+    bool
+    operator>(
+        iterator const& a,
+        iterator const& b) noexcept
+    {
+        return b < a;
+    }
+
+    friend
+    bool
+    operator<=(
+        iterator const& a,
+        iterator const& b) noexcept
+    {
+        return !(b < a);
+    }
+
+    friend
+    bool
+    operator>=(
+        iterator const& a,
+        iterator const& b) noexcept
+    {
+        return !(a < b);
+    }
+};
+
+//------------------------------------------------
+
+class segments_encoded_index::iterator
+{
+    segments_encoded_index const* idx_ = nullptr;
+    std::size_t i_ = 0;
+
+    friend class segments_encoded_index;
+
+    iterator(
+        segments_encoded_index const* idx,
+        std::size_t i) noexcept
+        : idx_(idx)
+        , i_(i)
+    {
+    }
+
+public:
+    using value_type = std::string;
+    using reference = string_view;
+    using pointer = void const*;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category =
+        std::random_access_iterator_tag;
+
+    iterator() = default;
+
+    reference
+    operator*() const noexcept
+    {
+        return (*idx_)[i_];
+    }
+
+    reference
+    operator[](difference_type n) const noexcept
+    {
+        return (*idx_)[i_ + n];
+    }
+
+    iterator&
+    operator++() noexcept
+    {
+        ++i_;
+        return *this;
+    }
+
+    iterator
+    operator++(int) noexcept
+    {
+        auto tmp = *this;
+        ++i_;
+        return tmp;
+    }
+
+    iterator&
+    operator--() noexcept
+    {
+        --i_;
+        return *this;
+    }
+
+    iterator
+    operator--(int) noexcept
+    {
+        auto tmp = *this;
+        --i_;
+        return tmp;
+    }
+
+    iterator&
+    operator+=(difference_type n) noexcept
+    {
+        i_ += n;
+        return *this;
+    }
+
+    iterator&
+    operator-=(difference_type n) noexcept
+    {
+        i_ -= n;
+        return *this;
+    }
+
+    friend
+    iterator
+    operator+(
+        iterator it,
+        difference_type n) noexcept
+    {
+        return it += n;
+    }
+
+    friend
+    iterator
+    operator+(
+        difference_type n,
+        iterator it) noexcept
+    {
+        return it += n;
+    }
+
+    friend
+    iterator
+    operator-(
+        iterator it,
+        difference_type n) noexcept
+    {
+        return it -= n;
+    }
+
+    friend
+    difference_type
+    operator-(
+        iterator const& a,
+        iterator const& b) noexcept
+    {
+        BOOST_ASSERT(a.idx_ == b.idx_);
+        return static_cast<difference_type>(a.i_) -
+            static_cast<difference_type>(b.i_);
+    }
+
+    friend
+    bool
+    operator==(
+        iterator const& a,
+        iterator const& b) noexcept
+    {
+        BOOST_ASSERT(a.idx_ == b.idx_);
+        return a.i_ == b.i_;
+    }
+
+    friend
+    bool
+    operator!=(
+        iterator const& a,
+        iterator const& b) noexcept
+    {
+        return !(a == b);
+    }
+
+    friend
+    bool
+    operator<(
+        iterator const& a,
+        iterator const& b) noexcept
+    {
+        return a.i_ < b.i_;
+    }
+
+    friend
+    bool
+    operator>(
+        iterator const& a,
+        iterator const& b) noexcept
+    {
+        return b < a;
+    }
+
+    friend
+    bool
+    operator<=(
+        iterator const& a,
+        iterator const& b) noexcept
+    {
+        return !(b < a);
+    }
+
+    friend
+    bool
+    operator>=(
+        iterator const& a,
+        iterator const& b) noexcept
+    {
+        return !(a < b);
+    }
+};
+
+//------------------------------------------------
+
+inline
+pct_encoded_view
+segments_index::
+operator[](std::size_t i) const noexcept
+{
+    pct_decode_opts opt;
+    opt.plus_to_space = false;
+    return pct_encoded_view(
+        impl_.get(i), opt);
+}
+
+inline
+auto
+segments_index::
+begin() const noexcept ->
+    iterator
+{
+    return { this, 0 };
+}
+
+inline
+auto
+segments_index::
+end() const noexcept ->
+    iterator
+{
+    return { this, impl_.n_ };
+}
+
+inline
+auto
+segments_encoded_index::
+begin() const noexcept ->
+    iterator
+{
+    return { this, 0 };
+}
+
+inline
+auto
+segments_encoded_index::
+end() const noexcept ->
+    iterator
+{
+    return { this, impl_.n_ };
+}
+
+} // urls
+} // boost
+
+#endif
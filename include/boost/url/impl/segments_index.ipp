@@ -0,0 +1,40 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_IMPL_SEGMENTS_INDEX_IPP
+#define BOOST_URL_IMPL_SEGMENTS_INDEX_IPP
+
+#include <boost/url/segments_index.hpp>
+#include <boost/url/detail/except.hpp>
+
+namespace boost {
+namespace urls {
+
+pct_encoded_view
+segments_index::
+at(std::size_t i) const
+{
+    if(i >= impl_.n_)
+        detail::throw_out_of_range();
+    return (*this)[i];
+}
+
+string_view
+segments_encoded_index::
+at(std::size_t i) const
+{
+    if(i >= impl_.n_)
+        detail::throw_out_of_range();
+    return (*this)[i];
+}
+
+} // urls
+} // boost
+
+#endif
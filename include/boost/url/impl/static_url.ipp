@@ -12,6 +12,7 @@
 
 #include <boost/url/static_url.hpp>
 #include <boost/url/url_view.hpp>
+#include <boost/url/detail/alloc_stats.hpp>
 #include <boost/url/detail/except.hpp>
 #include <boost/assert.hpp>
 
@@ -51,13 +52,22 @@ clear_impl() noexcept
 void
 static_url_base::
 reserve_impl(
-    std::size_t n)
+    std::size_t n,
+    op_t&)
 {
     if(n <= cap_)
         return;
+    detail::count_growth();
     detail::throw_bad_alloc();
 }
 
+void
+static_url_base::
+cleanup(op_t&)
+{
+    // the buffer is never replaced
+}
+
 } // urls
 } // boost
 
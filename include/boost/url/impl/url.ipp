@@ -12,6 +12,7 @@
 #define BOOST_URL_IMPL_URL_IPP
 
 #include <boost/url/url.hpp>
+#include <boost/url/detail/alloc_stats.hpp>
 #include <boost/assert.hpp>
 
 namespace boost {
@@ -73,6 +74,7 @@ url::
 allocate(std::size_t n)
 {
     auto s = new char[n + 1];
+    detail::count_allocate(n + 1);
     cap_ = n;
     return s;
 }
@@ -82,6 +84,7 @@ url::
 deallocate(char* s)
 {
     delete[] s;
+    detail::count_deallocate();
 }
 
 void
@@ -105,13 +108,15 @@ clear_impl() noexcept
 void
 url::
 reserve_impl(
-    std::size_t n)
+    std::size_t n,
+    op_t& op)
 {
     if(n > max_size())
         detail::throw_length_error(
             "too large");
     if(n <= cap_)
         return;
+    detail::count_growth();
     char* s;
     if(s_ != nullptr)
     {
@@ -125,8 +130,13 @@ reserve_impl(
         if( new_cap < n)
             new_cap = n;
         s = allocate(new_cap);
-        std::memcpy(s, s_, size());
-        deallocate(s_);
+        std::memcpy(s, s_, size() + 1);
+        // strings passed to the operation
+        // may point into the old buffer
+        if(op.old)
+            deallocate(s_);
+        else
+            op.old = s_;
         s_ = s;
     }
     else
@@ -137,6 +147,15 @@ reserve_impl(
     u_.cs_ = s_;
 }
 
+void
+url::
+cleanup(op_t& op)
+{
+    if(op.old)
+        deallocate(op.old);
+    op.old = nullptr;
+}
+
 } // urls
 } // boost
 
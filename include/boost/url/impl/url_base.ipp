@@ -12,12 +12,17 @@
 #define BOOST_URL_IMPL_URL_BASE_IPP
 
 #include <boost/url/url_base.hpp>
+#include <boost/url/base_resolver.hpp>
 #include <boost/url/error.hpp>
 #include <boost/url/host_type.hpp>
 #include <boost/url/scheme.hpp>
 #include <boost/url/url_view.hpp>
+#include <boost/url/detail/alloc_stats.hpp>
 #include <boost/url/detail/except.hpp>
+#include <boost/url/detail/path.hpp>
 #include <boost/url/detail/print.hpp>
+#include <boost/url/detail/remove_dot_segments.hpp>
+#include <boost/url/detail/usdt.hpp>
 #include <boost/url/rfc/authority_rule.hpp>
 #include <boost/url/rfc/query_rule.hpp>
 #include <boost/url/rfc/detail/charsets.hpp>
@@ -27,9 +32,10 @@
 #include <boost/url/rfc/detail/port_rule.hpp>
 #include <boost/url/rfc/detail/scheme_rule.hpp>
 #include <boost/url/rfc/detail/userinfo_rule.hpp>
-#include <boost/url/grammar/detail/copied_strings.hpp>
 #include <boost/url/grammar/parse.hpp>
+#include <algorithm>
 #include <cstring>
+#include <functional>
 #include <iostream>
 #include <stdexcept>
 #include <utility>
@@ -57,7 +63,9 @@ copy(url_view_base const& u)
         clear();
         return;
     }
-    reserve(u.size());
+    // u may be a view of this url
+    op_t op(*this);
+    reserve_impl(u.size(), op);
     u_ = u.u_;
     u_.cs_ = s_;
     std::memcpy(s_,
@@ -75,9 +83,9 @@ void
 url_base::
 set_scheme_impl(
     string_view s,
-    urls::scheme id)
+    urls::scheme id,
+    op_t& op)
 {
-    check_invariants();
     grammar::parse(s,
         detail::scheme_rule()).value();
     auto const n = s.size();
@@ -105,9 +113,22 @@ set_scheme_impl(
     {
         // do this first, for
         // strong exception safety
-        reserve(
-            size() + n + 1 - 2);
-        std::memmove(
+        reserve_impl(
+            size() + n + 1 - 2, op);
+        // the scheme may be the
+        // segment after the dot
+        auto const le =
+            std::less_equal<char const*>();
+        if( op.s &&
+            ! op.old &&
+            le(s_ + p + 2, s.data()) &&
+            le(s.data(), s_ + size()))
+        {
+            s = string_view(
+                s.data() - 2, n);
+            *op.s = s;
+        }
+        detail::move_chars(
             s_ + p,
             s_ + p + 2,
             size() + 1 -
@@ -119,11 +140,13 @@ set_scheme_impl(
     }
 
     auto dest = resize_impl(
-        id_scheme, n + 1);
+        id_scheme, n + 1, op);
+    // the scheme may have moved
+    if(op.s)
+        s = *op.s;
     s.copy(dest, n);
     dest[n] = ':';
     u_.scheme_ = id;
-    check_invariants();
 }
 
 url_base&
@@ -170,12 +193,12 @@ remove_scheme() noexcept
     // to the beginning of the path
     BOOST_ASSERT(n >= 2);
     // move [id_scheme, id_path) left
-    std::memmove(
+    detail::move_chars(
         s_,
         s_ + n,
         p - n);
     // move [id_path, id_end) left
-    std::memmove(
+    detail::move_chars(
         s_ + p - (n - 2),
         s_ + p,
         u_.offset(id_end) - p);
@@ -197,12 +220,9 @@ url_base&
 url_base::
 set_scheme(string_view s)
 {
-    grammar::detail::copied_strings<
-        BOOST_URL_STACK_BYTES>cs(
-            this->string());
-    s = cs.maybe_copy(s);
+    op_t op(*this, &s);
     set_scheme_impl(
-        s, string_to_scheme(s));
+        s, string_to_scheme(s), op);
     return *this;
 }
 
@@ -214,8 +234,9 @@ set_scheme(urls::scheme id)
         detail::throw_invalid_argument();
     if(id == urls::scheme::none)
         return remove_scheme();
+    op_t op(*this);
     set_scheme_impl(
-        to_string(id), id);
+        to_string(id), id, op);
     return *this;
 }
 
@@ -227,25 +248,24 @@ set_scheme(urls::scheme id)
 
 char*
 url_base::
-set_user_impl(std::size_t n)
+set_user_impl(
+    std::size_t n,
+    op_t& op)
 {
-    check_invariants();
     if(u_.len(id_pass) != 0)
     {
         // keep "//"
         auto dest = resize_impl(
-            id_user, 2 + n);
-        check_invariants();
+            id_user, 2 + n, op);
         return dest + 2;
     }
     // add authority
     auto dest = resize_impl(
-        id_user, 2 + n + 1);
+        id_user, 2 + n + 1, op);
     u_.split(id_user, 2 + n);
     dest[0] = '/';
     dest[1] = '/';
     dest[2 + n] = '@';
-    check_invariants();
     return dest + 2;
 }
 
@@ -253,18 +273,13 @@ url_base&
 url_base::
 set_user(string_view s)
 {
-    grammar::detail::copied_strings<
-        BOOST_URL_STACK_BYTES> buf(
-            this->string());
-    s = buf.maybe_copy(s);
-    check_invariants();
+    op_t op(*this, &s);
     auto const n = pct_encode_bytes(
         s, detail::user_chars);
-    auto dest = set_user_impl(n);
-    pct_encode(dest, u_.get(id_pass).data(),
+    auto dest = set_user_impl(n, op);
+    pct_encode(dest, dest + n,
         s, detail::user_chars);
     u_.decoded_[id_user] = s.size();
-    check_invariants();
     return *this;
 }
 
@@ -272,25 +287,21 @@ url_base&
 url_base::
 set_user(pct_encoded_view s)
 {
-    grammar::detail::copied_strings<
-        BOOST_URL_STACK_BYTES> buf(
-            this->string());
-    s = s.maybe_copy(buf);
-    check_invariants();
+    auto e = s.encoded();
+    op_t op(*this, &e, &s);
     auto const n =
         detail::pct_encode_bytes_impl(
             s.begin(),
             s.end(),
             detail::user_chars);
-    auto dest = set_user_impl(n);
+    auto dest = set_user_impl(n, op);
     detail::pct_encode_impl(
         dest,
-        u_.get(id_pass).data(),
+        dest + n,
         s.begin(),
         s.end(),
         detail::user_chars);
     u_.decoded_[id_user] = s.size();
-    check_invariants();
     return *this;
 }
 
@@ -299,11 +310,7 @@ url_base::
 set_encoded_user(
     string_view s)
 {
-    grammar::detail::copied_strings<
-        BOOST_URL_STACK_BYTES> buf(
-            this->string());
-    s = buf.maybe_copy(s);
-    check_invariants();
+    op_t op(*this, &s);
     error_code ec;
     auto const n =
         validate_pct_encoding(
@@ -313,7 +320,7 @@ set_encoded_user(
             {});
     if(ec.failed())
         detail::throw_invalid_argument();
-    auto dest = set_user_impl(s.size());
+    auto dest = set_user_impl(s.size(), op);
     u_.decoded_[id_user] = n;
     if(! s.empty())
     {
@@ -321,7 +328,6 @@ set_encoded_user(
         std::memcpy(dest,
             s.data(), s.size());
     }
-    check_invariants();
     return *this;
 }
 
@@ -330,30 +336,28 @@ set_encoded_user(
 char*
 url_base::
 set_password_impl(
-    std::size_t n)
+    std::size_t n,
+    op_t& op)
 {
-    check_invariants();
     if(u_.len(id_user) != 0)
     {
         // already have authority
         auto const dest = resize_impl(
-            id_pass, 1 + n + 1);
+            id_pass, 1 + n + 1, op);
         dest[0] = ':';
         dest[n + 1] = '@';
-        check_invariants();
         return dest + 1;
     }
     // add authority
     auto const dest =
         resize_impl(
         id_user, id_host,
-        2 + 1 + n + 1);
+        2 + 1 + n + 1, op);
     u_.split(id_user, 2);
     dest[0] = '/';
     dest[1] = '/';
     dest[2] = ':';
     dest[2 + n + 1] = '@';
-    check_invariants();
     return dest + 3;
 }
 
@@ -378,21 +382,16 @@ url_base&
 url_base::
 set_password(string_view s)
 {
-    grammar::detail::copied_strings<
-        BOOST_URL_STACK_BYTES> buf(
-            this->string());
-    s = buf.maybe_copy(s);
-    check_invariants();
+    op_t op(*this, &s);
     auto const n = pct_encode_bytes(
         s, detail::password_chars);
-    auto dest = set_password_impl(n);
+    auto dest = set_password_impl(n, op);
     pct_encode(
         dest,
-        u_.get(id_host).data() - 1,
+        dest + n,
         s,
         detail::password_chars);
     u_.decoded_[id_pass] = s.size();
-    check_invariants();
     return *this;
 }
 
@@ -400,25 +399,21 @@ url_base&
 url_base::
 set_password(pct_encoded_view s)
 {
-    grammar::detail::copied_strings<
-        BOOST_URL_STACK_BYTES> buf(
-            this->string());
-    s = s.maybe_copy(buf);
-    check_invariants();
+    auto e = s.encoded();
+    op_t op(*this, &e, &s);
     auto const n =
         detail::pct_encode_bytes_impl(
             s.begin(),
             s.end(),
             detail::password_chars);
-    auto dest = set_password_impl(n);
+    auto dest = set_password_impl(n, op);
     detail::pct_encode_impl(
         dest,
-        u_.get(id_host).data() - 1,
+        dest + n,
         s.begin(),
         s.end(),
         detail::password_chars);
     u_.decoded_[id_pass] = s.size();
-    check_invariants();
     return *this;
 }
 
@@ -427,18 +422,14 @@ url_base::
 set_encoded_password(
     string_view s)
 {
-    grammar::detail::copied_strings<
-        BOOST_URL_STACK_BYTES> buf(
-            this->string());
-    s = buf.maybe_copy(s);
-    check_invariants();
+    op_t op(*this, &s);
     error_code ec;
     auto const n = validate_pct_encoding(
         s, ec, detail::password_chars, {});
     if(ec.failed())
         detail::throw_invalid_argument();
     auto dest =
-        set_password_impl(s.size());
+        set_password_impl(s.size(), op);
     u_.decoded_[id_pass] = n;
     if(! s.empty())
     {
@@ -446,7 +437,6 @@ set_encoded_password(
         std::memcpy(dest,
             s.data(), s.size());
     }
-    check_invariants();
     return *this;
 }
 
@@ -455,17 +445,16 @@ set_encoded_password(
 char*
 url_base::
 set_userinfo_impl(
-    std::size_t n)
+    std::size_t n,
+    op_t& op)
 {
     // "//" {dest} "@"
-    check_invariants();
     auto dest = resize_impl(
-        id_user, id_host, n + 3);
+        id_user, id_host, n + 3, op);
     u_.split(id_user, n + 2);
     dest[0] = '/';
     dest[1] = '/';
     dest[n + 2] = '@';
-    check_invariants();
     return dest + 2;
 }
 
@@ -493,24 +482,20 @@ url_base::
 set_userinfo(
     string_view s)
 {
-    grammar::detail::copied_strings<
-        BOOST_URL_STACK_BYTES> buf(
-            this->string());
-    s = buf.maybe_copy(s);
-    check_invariants();
+    op_t op(*this, &s);
     auto const n = pct_encode_bytes(
         s, detail::userinfo_chars);
-    auto dest = set_userinfo_impl(n);
+    auto dest = set_userinfo_impl(n, op);
     pct_encode(
         dest,
-        u_.get(id_host).data() - 1,
+        dest + n,
         s,
         detail::userinfo_chars);
-    auto pct_s = u_.get(id_user, id_host);
+    auto pct_s = string_view(dest, n);
     auto pct_sep = pct_s.find_first_of(':');
     if (pct_sep != string_view::npos)
     {
-        u_.split(id_user, pct_sep);
+        u_.split(id_user, 2 + pct_sep);
         auto sep = s.find_first_of(':');
         u_.decoded_[id_user] = sep - 1;
         u_.decoded_[id_pass] = s.size() - sep;
@@ -520,7 +505,6 @@ set_userinfo(
         u_.decoded_[id_user] = s.size();
         u_.decoded_[id_pass] = 0;
     }
-    check_invariants();
     return *this;
 }
 
@@ -529,28 +513,25 @@ url_base::
 set_userinfo(
     pct_encoded_view s)
 {
-    grammar::detail::copied_strings<
-        BOOST_URL_STACK_BYTES> buf(
-            this->string());
-    s = s.maybe_copy(buf);
-    check_invariants();
+    auto e = s.encoded();
+    op_t op(*this, &e, &s);
     auto const n =
         detail::pct_encode_bytes_impl(
             s.begin(),
             s.end(),
             detail::userinfo_chars);
-    auto dest = set_userinfo_impl(n);
+    auto dest = set_userinfo_impl(n, op);
     detail::pct_encode_impl(
         dest,
-        u_.get(id_host).data() - 1,
+        dest + n,
         s.begin(),
         s.end(),
         detail::userinfo_chars);
-    auto pct_s = u_.get(id_user, id_host);
+    auto pct_s = string_view(dest, n);
     auto pct_sep = pct_s.find_first_of(':');
     if (pct_sep != string_view::npos)
     {
-        u_.split(id_user, pct_sep);
+        u_.split(id_user, 2 + pct_sep);
         std::size_t sep = 0;
         for (char c: s)
         {
@@ -566,7 +547,6 @@ set_userinfo(
         u_.decoded_[id_user] = s.size();
         u_.decoded_[id_pass] = 0;
     }
-    check_invariants();
     return *this;
 }
 
@@ -575,14 +555,10 @@ url_base::
 set_encoded_userinfo(
     string_view s)
 {
-    grammar::detail::copied_strings<
-        BOOST_URL_STACK_BYTES> buf(
-            this->string());
-    s = buf.maybe_copy(s);
-    check_invariants();
+    op_t op(*this, &s);
     auto t = grammar::parse(
         s, detail::userinfo_rule).value();
-    auto dest = set_userinfo_impl(s.size());
+    auto dest = set_userinfo_impl(s.size(), op);
     u_.split(id_user, 2 + t.user.encoded().size());
     if(! s.empty())
         std::memcpy(dest, s.data(), s.size());
@@ -593,7 +569,6 @@ set_encoded_userinfo(
             t.password.size();
     else
         u_.decoded_[id_pass] = 0;
-    check_invariants();
     return *this;
 }
 
@@ -601,26 +576,23 @@ set_encoded_userinfo(
 
 char*
 url_base::
-set_host_impl(std::size_t n)
+set_host_impl(
+    std::size_t n,
+    op_t& op)
 {
-    check_invariants();
     if(u_.len(id_user) == 0)
     {
         // add authority
         auto dest = resize_impl(
-            id_user, n + 2);
+            id_user, n + 2, op);
         u_.split(id_user, 2);
         u_.split(id_pass, 0);
         dest[0] = '/';
         dest[1] = '/';
-        check_invariants();
         return dest + 2;
     }
     // already have authority
-    auto const dest =
-        resize_impl(id_host, n);
-    check_invariants();
-    return dest;
+    return resize_impl(id_host, n, op);
 }
 
 url_base&
@@ -628,13 +600,13 @@ url_base::
 set_host(
     urls::ipv4_address const& addr)
 {
-    check_invariants();
+    op_t op(*this);
     char buf[urls::
         ipv4_address::max_str_len];
     auto s = addr.to_buffer(
         buf, sizeof(buf));
     auto dest =
-        set_host_impl(s.size());
+        set_host_impl(s.size(), op);
     std::memcpy(
         dest, s.data(), s.size());
     u_.decoded_[id_host] = u_.len(id_host);
@@ -643,7 +615,6 @@ set_host(
     auto bytes = addr.to_bytes();
     std::memcpy(u_.ip_addr_,
         bytes.data(), bytes.size());
-    check_invariants();
     return *this;
 }
 
@@ -652,7 +623,7 @@ url_base::
 set_host(
     urls::ipv6_address const& addr)
 {
-    check_invariants();
+    op_t op(*this);
     char buf[2 + urls::
         ipv6_address::max_str_len];
     auto s = addr.to_buffer(
@@ -660,7 +631,7 @@ set_host(
     buf[0] = '[';
     buf[s.size() + 1] = ']';
     auto dest =
-        set_host_impl(s.size() + 2);
+        set_host_impl(s.size() + 2, op);
     std::memcpy(
         dest, buf, s.size() + 2);
     u_.decoded_[id_host] = u_.len(id_host);
@@ -669,7 +640,6 @@ set_host(
     auto bytes = addr.to_bytes();
     std::memcpy(u_.ip_addr_,
         bytes.data(), bytes.size());
-    check_invariants();
     return *this;
 }
 
@@ -678,29 +648,24 @@ url_base::
 set_host(
     string_view s)
 {
-    grammar::detail::copied_strings<
-        BOOST_URL_STACK_BYTES> buf(
-            this->string());
-    s = buf.maybe_copy(s);
     // try ipv4
     {
         auto r = parse_ipv4_address(s);
         if(! r.has_error())
             return set_host(r.value());
     }
-    check_invariants();
+    op_t op(*this, &s);
     auto const n = pct_encode_bytes(
         s, detail::host_chars);
-    auto dest = set_host_impl(n);
+    auto dest = set_host_impl(n, op);
     pct_encode(
         dest,
-        u_.get(id_path).data(),
+        dest + n,
         s,
         detail::host_chars);
     u_.decoded_[id_host] = s.size();
     u_.host_type_ =
         urls::host_type::name;
-    check_invariants();
     return *this;
 }
 
@@ -709,30 +674,26 @@ url_base::
 set_host(
     pct_encoded_view s)
 {
-    grammar::detail::copied_strings<
-        BOOST_URL_STACK_BYTES> buf(
-            this->string());
-    s = s.maybe_copy(buf);
     // try ipv4
     {
         auto r = parse_ipv4_address(s.encoded());
         if(! r.has_error())
             return set_host(r.value());
     }
-    check_invariants();
+    auto e = s.encoded();
+    op_t op(*this, &e, &s);
     auto const n = detail::pct_encode_bytes_impl(
         s.begin(), s.end(), detail::host_chars);
-    auto dest = set_host_impl(n);
+    auto dest = set_host_impl(n, op);
     detail::pct_encode_impl(
         dest,
-        u_.get(id_path).data(),
+        dest + n,
         s.begin(),
         s.end(),
         detail::host_chars);
     u_.decoded_[id_host] = s.size();
     u_.host_type_ =
         urls::host_type::name;
-    check_invariants();
     return *this;
 }
 
@@ -740,20 +701,18 @@ url_base&
 url_base::
 set_encoded_host(string_view s)
 {
-    grammar::detail::copied_strings<
-        BOOST_URL_STACK_BYTES> buf(
-            this->string());
-    s = buf.maybe_copy(s);
+    op_t op(*this, &s);
     // first try parsing it
     auto t = grammar::parse(
         s, detail::host_rule).value();
     BOOST_ASSERT(t.host_type !=
         urls::host_type::none);
-    check_invariants();
+    auto dest = set_host_impl(
+        t.match.size(), op);
     std::memcpy(
-        set_host_impl(t.match.size()),
-        t.match.data(),
-        t.match.size());
+        dest,
+        s.data(),
+        s.size());
     std::memcpy(
         u_.ip_addr_,
         t.addr,
@@ -766,7 +725,6 @@ set_encoded_host(string_view s)
         u_.decoded_[id_host] =
             t.match.size();
     u_.host_type_ = t.host_type;
-    check_invariants();
     return *this;
 }
 
@@ -774,27 +732,26 @@ set_encoded_host(string_view s)
 
 char*
 url_base::
-set_port_impl(std::size_t n)
+set_port_impl(
+    std::size_t n,
+    op_t& op)
 {
-    check_invariants();
     if(u_.len(id_user) != 0)
     {
         // authority exists
         auto dest = resize_impl(
-            id_port, n + 1);
+            id_port, n + 1, op);
         dest[0] = ':';
-        check_invariants();
         return dest + 1;
     }
     auto dest = resize_impl(
-        id_user, 3 + n);
+        id_user, 3 + n, op);
     u_.split(id_user, 2);
     u_.split(id_pass, 0);
     u_.split(id_host, 0);
     dest[0] = '/';
     dest[1] = '/';
     dest[2] = ':';
-    check_invariants();
     return dest + 3;
 }
 
@@ -813,16 +770,15 @@ url_base&
 url_base::
 set_port(std::uint16_t n)
 {
-    check_invariants();
+    op_t op(*this);
     auto s =
         detail::make_printed(n);
     auto dest = set_port_impl(
-        s.string().size());
+        s.string().size(), op);
     std::memcpy(
         dest, s.string().data(),
             s.string().size());
     u_.port_number_ = n;
-    check_invariants();
     return *this;
 }
 
@@ -830,22 +786,17 @@ url_base&
 url_base::
 set_port(string_view s)
 {
-    grammar::detail::copied_strings<
-        BOOST_URL_STACK_BYTES> buf(
-            this->string());
-    s = buf.maybe_copy(s);
-    check_invariants();
+    op_t op(*this, &s);
     auto t = grammar::parse(
         s, detail::port_rule{}).value();
     auto dest =
-        set_port_impl(t.str.size());
+        set_port_impl(t.str.size(), op);
     std::memcpy(dest,
-        t.str.data(), t.str.size());
+        s.data(), s.size());
     if(t.has_number)
         u_.port_number_ = t.number;
     else
         u_.port_number_ = 0;
-    check_invariants();
     return *this;
 }
 
@@ -890,10 +841,7 @@ url_base::
 set_encoded_authority(
     string_view s)
 {
-    grammar::detail::copied_strings<
-        BOOST_URL_STACK_BYTES> buf(
-            this->string());
-    s = buf.maybe_copy(s);
+    op_t op(*this, &s);
     auto t = grammar::parse(
         s, authority_rule).value();
     auto n = s.size() + 2;
@@ -903,7 +851,7 @@ set_encoded_authority(
     if(need_slash)
         ++n;
     auto dest = resize_impl(
-        id_user, id_path, n);
+        id_user, id_path, n, op);
     dest[0] = '/';
     dest[1] = '/';
     std::memcpy(dest + 2,
@@ -915,7 +863,6 @@ set_encoded_authority(
     if(need_slash)
         u_.adjust(
             id_query, id_end, 1);
-    check_invariants();
     return *this;
 }
 
@@ -1047,7 +994,8 @@ edit_segments(
     std::size_t i0,
     std::size_t i1,
     std::size_t n,
-    std::size_t nseg)
+    std::size_t nseg,
+    op_t& op)
 {
     BOOST_ASSERT(i1 >= i0);
     BOOST_ASSERT(i1 - i0 <= u_.nseg_);
@@ -1079,23 +1027,16 @@ edit_segments(
     // old size of [p0, p1)
     auto const n0 = p1 - p0;
 
-    // adjust capacity
-    reserve(size() + n - n0);
-
     // start of output
-    auto dest = s_ + p0;
+    auto dest = splice_impl(
+        p0, n0, n, op);
 
-    // move and size
-    std::memmove(
-        dest + n,
-        s_ + p1,
-        size() - p1);
+    // size
     u_.set_size(
         id_path,
         u_.len(id_path) -
             (n0 - n));
     u_.nseg_ = nseg1;
-    s_[size()] = '\0';
     return dest;
 }
 
@@ -1109,6 +1050,23 @@ edit_segments(
     detail::any_path_iter&& it0,
     detail::any_path_iter&& it1,
     int abs_hint)
+{
+    op_t op(*this);
+    edit_segments(i0, i1,
+        std::move(it0),
+        std::move(it1),
+        op, abs_hint);
+}
+
+void
+url_base::
+edit_segments(
+    std::size_t i0,
+    std::size_t i1,
+    detail::any_path_iter&& it0,
+    detail::any_path_iter&& it1,
+    op_t& op,
+    int abs_hint)
 {
     bool abs;
     if( has_authority() ||
@@ -1269,8 +1227,14 @@ edit_segments(
 
     // copy
     n += prefix + suffix;
+    auto const p0 = op.s ?
+        op.s->data() : nullptr;
     auto dest = edit_segments(
-        i0, i1, n, nseg);
+        i0, i1, n, nseg, op);
+    // the string may have moved
+    if( op.s &&
+        op.s->data() != p0)
+        it1.rebase(op.s->data() - p0);
     auto const last = dest + n;
 
 /*  Write all characters in the destination:
@@ -1362,10 +1326,7 @@ url_base::
 set_encoded_path(
     string_view s)
 {
-    grammar::detail::copied_strings<
-        BOOST_URL_STACK_BYTES> buf(
-            this->string());
-    s = buf.maybe_copy(s);
+    op_t op(*this, &s);
     int abs_hint;
     if(s.starts_with('/'))
         abs_hint = 1;
@@ -1376,6 +1337,7 @@ set_encoded_path(
         u_.nseg_,
         detail::enc_path_iter(s),
         detail::enc_path_iter(s),
+        op,
         abs_hint);
     return *this;
 }
@@ -1385,10 +1347,7 @@ url_base::
 set_path(
     string_view s)
 {
-    grammar::detail::copied_strings<
-        BOOST_URL_STACK_BYTES> buf(
-            this->string());
-    s = buf.maybe_copy(s);
+    op_t op(*this, &s);
     int abs_hint;
     if(s.starts_with('/'))
         abs_hint = 1;
@@ -1398,6 +1357,7 @@ set_path(
         0, u_.nseg_,
         detail::plain_path_iter(s),
         detail::plain_path_iter(s),
+        op,
         abs_hint);
     return *this;
 }
@@ -1407,10 +1367,8 @@ url_base::
 set_path(
     pct_encoded_view s)
 {
-    grammar::detail::copied_strings<
-        BOOST_URL_STACK_BYTES> buf(
-            this->string());
-    s = s.maybe_copy(buf);
+    auto e = s.encoded();
+    op_t op(*this, &e, &s);
     int abs_hint;
     if(!s.empty() && s.front() == '/')
         abs_hint = 1;
@@ -1420,6 +1378,7 @@ set_path(
         0, u_.nseg_,
         detail::view_path_iter(s),
         detail::view_path_iter(s),
+        op,
         abs_hint);
     return *this;
 }
@@ -1494,7 +1453,8 @@ edit_params(
     std::size_t i0,
     std::size_t i1,
     std::size_t n,
-    std::size_t nparam)
+    std::size_t nparam,
+    op_t& op)
 {
     BOOST_ASSERT(i1 >= i0);
     BOOST_ASSERT(i1 - i0 <= u_.nparam_);
@@ -1510,23 +1470,16 @@ edit_params(
     // old size of [r0, r1)
     auto const n0 = r1.pos - r0.pos;
 
-    // adjust capacity
-    reserve(size() + n - n0);
-
     // start of output
-    auto dest = s_ + r0.pos;
+    auto dest = splice_impl(
+        r0.pos, n0, n, op);
 
-    // move and size
-    std::memmove(
-        dest + n,
-        s_ + r1.pos,
-        size() - r1.pos);
+    // size
     u_.set_size(
         id_query,
         u_.len(id_query) + (
             n - n0));
     u_.nparam_ = nparam1;
-    s_[size()] = '\0';
     return dest;
 }
 
@@ -1539,7 +1492,23 @@ edit_params(
     detail::any_query_iter&& it1,
     bool set_hint)
 {
-    check_invariants();
+    op_t op(*this);
+    edit_params(i0, i1,
+        std::move(it0),
+        std::move(it1),
+        op, set_hint);
+}
+
+void
+url_base::
+edit_params(
+    std::size_t i0,
+    std::size_t i1,
+    detail::any_query_iter&& it0,
+    detail::any_query_iter&& it1,
+    op_t& op,
+    bool set_hint)
+{
     if(! set_hint)
         set_hint = has_query();
 
@@ -1579,8 +1548,14 @@ edit_params(
     }
 
     // copy
+    auto const p0 = op.s ?
+        op.s->data() : nullptr;
     auto dest = edit_params(
-        i0, i1, n, nparam);
+        i0, i1, n, nparam, op);
+    // the string may have moved
+    if( op.s &&
+        op.s->data() != p0)
+        it1.rebase(op.s->data() - p0);
     if(prefix)
         *dest++ = '?';
     if(nparam > 0)
@@ -1596,8 +1571,6 @@ edit_params(
             *dest++ = '&';
         }
     }
-
-    check_invariants();
 }
 
 //------------------------------------------------
@@ -1623,21 +1596,19 @@ set_encoded_query(
 {
     if (s.empty())
         remove_query();
-    grammar::detail::copied_strings<
-        BOOST_URL_STACK_BYTES> buf(
-            this->string());
-    s = buf.maybe_copy(s);
-    check_invariants();
-    edit_params(
-        0,
-        u_.nparam_,
-        detail::enc_query_iter(s),
-        detail::enc_query_iter(s),
-        true);
+    {
+        op_t op(*this, &s);
+        edit_params(
+            0,
+            u_.nparam_,
+            detail::enc_query_iter(s),
+            detail::enc_query_iter(s),
+            op,
+            true);
+    }
     u_.decoded_[id_query] =
         pct_decode_bytes_unchecked(
             encoded_query());
-    check_invariants();
     return *this;
 }
 
@@ -1648,16 +1619,16 @@ set_query(
 {
     if (s.empty())
         remove_query();
-    grammar::detail::copied_strings<
-        BOOST_URL_STACK_BYTES> buf(
-            this->string());
-    s = buf.maybe_copy(s);
-    edit_params(
-        0,
-        u_.nparam_,
-        detail::plain_query_iter(s),
-        detail::plain_query_iter(s),
-        true);
+    {
+        op_t op(*this, &s);
+        edit_params(
+            0,
+            u_.nparam_,
+            detail::plain_query_iter(s),
+            detail::plain_query_iter(s),
+            op,
+            true);
+    }
     u_.decoded_[id_query] =
         pct_decode_bytes_unchecked(
             encoded_query());
@@ -1671,16 +1642,17 @@ set_query(
 {
     if (s.empty())
         remove_query();
-    grammar::detail::copied_strings<
-        BOOST_URL_STACK_BYTES> buf(
-            this->string());
-    s = s.maybe_copy(buf);
-    edit_params(
-        0,
-        u_.nparam_,
-        detail::view_query_iter(s),
-        detail::view_query_iter(s),
-        true);
+    {
+        auto e = s.encoded();
+        op_t op(*this, &e, &s);
+        edit_params(
+            0,
+            u_.nparam_,
+            detail::view_query_iter(s),
+            detail::view_query_iter(s),
+            op,
+            true);
+    }
     u_.decoded_[id_query] =
         pct_decode_bytes_unchecked(
             encoded_query());
@@ -1696,10 +1668,11 @@ set_query(
 char*
 url_base::
 set_fragment_impl(
-    std::size_t n)
+    std::size_t n,
+    op_t& op)
 {
     auto dest = resize_impl(
-        id_frag, n + 1);
+        id_frag, n + 1, op);
     dest[0] = '#';
     return dest + 1;
 }
@@ -1717,20 +1690,15 @@ url_base&
 url_base::
 set_encoded_fragment(string_view s)
 {
-    grammar::detail::copied_strings<
-        BOOST_URL_STACK_BYTES> buf(
-            this->string());
-    s = buf.maybe_copy(s);
-    check_invariants();
+    op_t op(*this, &s);
     auto t = grammar::parse(
         s, detail::fragment_rule).value(
             BOOST_CURRENT_LOCATION);
-    auto dest = set_fragment_impl(s.size());
+    auto dest = set_fragment_impl(s.size(), op);
     u_.decoded_[id_frag] = t.size();
     if(! s.empty())
         std::memcpy(
             dest, s.data(), s.size());
-    check_invariants();
     return *this;
 }
 
@@ -1738,21 +1706,16 @@ url_base&
 url_base::
 set_fragment(string_view s)
 {
-    grammar::detail::copied_strings<
-        BOOST_URL_STACK_BYTES> buf(
-            this->string());
-    s = buf.maybe_copy(s);
-    check_invariants();
+    op_t op(*this, &s);
     auto const n = pct_encode_bytes(
         s, detail::fragment_chars);
-    auto dest = set_fragment_impl(n);
+    auto dest = set_fragment_impl(n, op);
     pct_encode(
         dest,
-        u_.get(id_end).data(),
+        dest + n,
         s,
         detail::fragment_chars);
     u_.decoded_[id_frag] = s.size();
-    check_invariants();
     return *this;
 }
 
@@ -1761,25 +1724,21 @@ url_base::
 set_fragment(
     pct_encoded_view s)
 {
-    grammar::detail::copied_strings<
-        BOOST_URL_STACK_BYTES> buf(
-            this->string());
-    s = s.maybe_copy(buf);
-    check_invariants();
+    auto e = s.encoded();
+    op_t op(*this, &e, &s);
     auto const n =
         detail::pct_encode_bytes_impl(
             s.begin(),
             s.end(),
             detail::fragment_chars);
-    auto dest = set_fragment_impl(n);
+    auto dest = set_fragment_impl(n, op);
     detail::pct_encode_impl(
         dest,
-        u_.get(id_end).data(),
+        dest + n,
         s.begin(),
         s.end(),
         detail::fragment_chars);
     u_.decoded_[id_frag] = s.size();
-    check_invariants();
     return *this;
 }
 
@@ -1796,196 +1755,21 @@ resolve_impl(
     url_view_base const& ref,
     error_code& ec)
 {
-    auto const remove_dot_segments =
-        [this]
-    {
-        auto segs = encoded_segments();
-        if(segs.empty())
-            return;
-        auto it = segs.begin();
-        int n = 0;
-        for(;;)
-        {
-            if(*it == ".")
-            {
-                if(it != std::prev(segs.end()))
-                    it = segs.erase(it);
-                else
-                    it = segs.replace(it, "");
-            }
-            else if(it == segs.begin())
-            {
-            #if 0
-                if(*it == "..")
-                    it = segs.erase(it);
-                else
-                    ++it;
-            #else
-            /*  Errata 4547
-                https://www.rfc-editor.org/errata/eid4547
-            */
-                if(*it != "..")
-                    ++n;
-                ++it;
-            #endif
-            }
-            else if(*it == "..")
-            {
-                if(n > 0)
-                {
-                    it = segs.erase(std::prev(it));
-                    if( it == segs.begin() ||
-                        it != std::prev(segs.end()))
-                        it = segs.erase(it);
-                    else
-                        it = segs.replace(it, "");
-                    --n;
-                }
-                else
-                {
-                    ++it;
-                }
-            }
-            else
-            {
-                ++n;
-                ++it;
-            }
-            if(it == segs.end())
-                break;
-        }
-    };
-
+    BOOST_URL_PROBE2(resolve_entry,
+        base.size(), ref.size());
     if(! base.has_scheme())
     {
         ec = error::not_a_base;
+        BOOST_URL_PROBE2(resolve_return,
+            0, ec.value());
         return false;
     }
 
     ec = {};
-
-    //
-    // 5.2.2. Transform References
-    // https://datatracker.ietf.org/doc/html/rfc3986#section-5.2.2
-    //
-
-    if(ref.has_scheme())
-    {
-        reserve(ref.size());
-        copy(ref);
-        remove_dot_segments();
-        return true;
-    }
-    if(ref.has_authority())
-    {
-        reserve(
-            base.u_.offset(id_user) +
-                ref.size());
-        clear();
-        set_scheme(base.scheme());
-        set_encoded_authority(
-            ref.encoded_authority());
-        set_encoded_path(
-            ref.encoded_path());
-        remove_dot_segments();
-        if(ref.has_query())
-            set_encoded_query(
-                ref.encoded_query());
-        if(ref.has_fragment())
-            set_encoded_fragment(
-                ref.encoded_fragment());
-        return true;
-    }
-    if(ref.encoded_path().empty())
-    {
-        if(ref.has_query())
-        {
-            reserve(
-                base.u_.offset(id_query) +
-                    ref.size());
-            clear();
-            set_scheme(base.scheme());
-            if(base.has_authority())
-                set_encoded_authority(
-                    base.encoded_authority());
-            set_encoded_path(
-                base.encoded_path());
-            remove_dot_segments();
-            set_encoded_query(
-                ref.encoded_query());
-        }
-        else
-        {
-            reserve(
-                base.u_.offset(id_query) +
-                    ref.size());
-            clear();
-            set_scheme(base.scheme());
-            if(base.has_authority())
-                set_encoded_authority(
-                    base.encoded_authority());
-            set_encoded_path(
-                base.encoded_path());
-            remove_dot_segments();
-            if(base.has_query())
-                set_encoded_query(
-                    base.encoded_query());
-        }
-        if(ref.has_fragment())
-            set_encoded_fragment(
-                ref.encoded_fragment());
-        return true;
-    }
-    if(ref.encoded_path().starts_with('/'))
-    {
-        reserve(
-            base.u_.offset(id_path) +
-                ref.size());
-        clear();
-        set_scheme(base.scheme());
-        if(base.has_authority())
-            set_encoded_authority(
-                base.encoded_authority());
-        set_encoded_path(
-            ref.encoded_path());
-        remove_dot_segments();
-        if(ref.has_query())
-            set_encoded_query(
-                ref.encoded_query());
-        if(ref.has_fragment())
-            set_encoded_fragment(
-                ref.encoded_fragment());
-        return true;
-    }
-    reserve(
-        base.u_.offset(id_query) +
-            ref.size());
-    clear();
-    set_scheme(base.scheme());
-    if(base.has_authority())
-        set_encoded_authority(
-            base.encoded_authority());
-    {
-        // 5.2.3. Merge Paths
-        auto es = encoded_segments();
-        if(base.u_.nseg_ > 0)
-        {
-            set_encoded_path(
-                base.encoded_path());
-            if(u_.nseg_ > 0)
-                es.pop_back();
-        }
-        es.insert(es.end(),
-            ref.encoded_segments().begin(),
-            ref.encoded_segments().end());
-    }
-    remove_dot_segments();
-    if(ref.has_query())
-        set_encoded_query(
-            ref.encoded_query());
-    if(ref.has_fragment())
-        set_encoded_fragment(
-            ref.encoded_fragment());
+    base_resolver(base).resolve(
+        ref, *this);
+    BOOST_URL_PROBE2(resolve_return,
+        size(), 0);
     return true;
 }
 
@@ -2106,6 +1890,15 @@ normalize_authority()
 
     // normalize user
     normalize_octets_impl(id_user, detail::user_chars);
+
+    // remove an empty or default port
+    std::uint16_t const dp =
+        default_port(u_.scheme_);
+    if( dp != 0 &&
+        has_port() &&
+        (port_number() == dp ||
+            port().empty()))
+        remove_port();
     return *this;
 }
 
@@ -2114,24 +1907,13 @@ url_base::
 normalize_path()
 {
     normalize_octets_impl(id_path, detail::path_chars);
-    string_view p = encoded_path();
-    char* p_dest = s_ + u_.offset(id_path);
-    char* p_end = s_ + u_.offset(id_path + 1);
-    std::size_t pn = p.size();
-    bool abs = is_path_absolute();
-    std::size_t n = detail::remove_dot_segments(
-        p_dest, p_end, p, abs);
-    if (n != pn)
-    {
-        BOOST_ASSERT(n < pn);
-        shrink_impl(id_path, n);
-        p = encoded_path();
-        if (!p.empty())
-            u_.nseg_ = std::count(
-                p.begin() + 1, p.end(), '/') + 1;
-        else
-            u_.nseg_ = 0;
-    }
+    if(u_.len(id_path) == 0)
+        return *this;
+    // unmatched ".." are removed from
+    // absolute paths
+    detail::remove_dot_segments(
+        s_, u_, is_path_absolute());
+    s_[size()] = '\0';
     return *this;
 }
 
@@ -2206,6 +1988,157 @@ check_invariants() const noexcept
     BOOST_ASSERT(c_str()[size()] == '\0');
 }
 
+//------------------------------------------------
+
+url_base::
+op_t::
+op_t(
+    url_base& u_,
+    string_view* s_,
+    pct_encoded_view* v_) noexcept
+    : u(u_)
+    , s(s_)
+    , v(v_)
+{
+    BOOST_URL_PROBE2(edit_entry,
+        u.size(), u.capacity());
+    u.check_invariants();
+}
+
+url_base::
+op_t::
+~op_t()
+{
+    if(tmp)
+    {
+        // move the tail, then the
+        // chars written past the end
+        auto const dest = u.s_ + pos;
+        detail::move_chars(
+            dest + n,
+            dest + n0,
+            end - pos - n0);
+        std::memcpy(dest, tmp, n);
+        u.s_[u.size()] = '\0';
+    }
+    if(old)
+        u.cleanup(*this);
+    u.check_invariants();
+    BOOST_URL_PROBE2(edit_return,
+        u.size(), u.capacity());
+}
+
+/*  Replace the n0 chars at pos with space
+    for n chars, keeping the leading chars,
+    and return the space to write to.
+
+    If the string of the operation is in the
+    buffer, and the buffer is not replaced,
+    the space is past the end and op_t moves
+    the chars into place when it is done.
+    When only the result fits, the string is
+    moved along with the tail, or copied past
+    the new end, and read from there.
+*/
+char*
+url_base::
+splice_impl(
+    std::size_t pos,
+    std::size_t n0,
+    std::size_t n,
+    op_t& op)
+{
+    BOOST_ASSERT(! op.tmp);
+    auto const end = size();
+    auto const le =
+        std::less_equal<char const*>();
+    bool const alias =
+        op.s &&
+        ! op.old &&
+        ! op.s->empty() &&
+        le(s_, op.s->data()) &&
+        le(op.s->data(), s_ + end);
+    if(alias)
+        detail::count_aliased();
+    // A string which ends before pos is
+    // not moved or overwritten, and one
+    // which is exactly the new chars is
+    // copied onto itself
+    if( alias &&
+        end + n - n0 <= cap_ &&
+        ! le(op.s->data() + op.s->size(),
+            s_ + pos) &&
+        ! ( op.s->data() == s_ + pos &&
+            op.s->size() == n))
+    {
+        // room for the tail to move
+        // right, then the new chars
+        std::size_t const grow =
+            n > n0 ? n - n0 : 0;
+        if(end + grow + n <= cap_)
+        {
+            op.tmp = s_ + end + grow + 1;
+            op.pos = pos;
+            op.n0 = n0;
+            op.n = n;
+            op.end = end;
+            std::memcpy(op.tmp, s_ + pos,
+                n < n0 ? n : n0);
+            return op.tmp;
+        }
+
+        // The result fits, but not the new
+        // chars past the end. A string in the
+        // tail moves with it, otherwise it is
+        // copied past the new end first.
+        auto const new_end = end + n - n0;
+        auto const p = static_cast<
+            std::size_t>(op.s->data() - s_);
+        std::size_t to;
+        if(p >= pos + n0)
+        {
+            to = p + n - n0;
+        }
+        else if(end + grow +
+            op.s->size() <= cap_)
+        {
+            to = end + grow + 1;
+            std::memcpy(s_ + to,
+                op.s->data(), op.s->size());
+        }
+        else
+        {
+            // no room to keep the string,
+            // so the buffer must be replaced
+            to = p;
+            reserve_impl(new_end +
+                op.s->size(), op);
+        }
+        if(! op.old)
+        {
+            detail::move_chars(
+                s_ + pos + n,
+                s_ + pos + n0,
+                end - pos - n0 + 1);
+            auto const d =
+                static_cast<std::ptrdiff_t>(to) -
+                static_cast<std::ptrdiff_t>(p);
+            *op.s = string_view(
+                s_ + to, op.s->size());
+            if(op.v)
+                *op.v = detail::access::rebase(
+                    *op.v, d);
+            return s_ + pos;
+        }
+    }
+    reserve_impl(end + n - n0, op);
+    detail::move_chars(
+        s_ + pos + n,
+        s_ + pos + n0,
+        end - pos - n0 + 1);
+    return s_ + pos;
+}
+
 char*
 url_base::
 resize_impl(
@@ -2237,7 +2170,7 @@ resize_impl(
     auto const pos =
         u_.offset(last);
     // adjust chars
-    std::memmove(
+    detail::move_chars(
         s_ + pos + n,
         s_ + pos,
         u_.offset(id_end) -
@@ -2251,6 +2184,40 @@ resize_impl(
     return s_ + u_.offset(first);
 }
 
+char*
+url_base::
+resize_impl(
+    int id,
+    std::size_t new_size,
+    op_t& op)
+{
+    return resize_impl(
+        id, id + 1, new_size, op);
+}
+
+char*
+url_base::
+resize_impl(
+    int first,
+    int last,
+    std::size_t new_len,
+    op_t& op)
+{
+    auto const n0 = u_.len(first, last);
+    auto const pos = u_.offset(first);
+    if(new_len == 0 && n0 == 0)
+        return s_ + pos;
+    auto const dest = splice_impl(
+        pos, n0, new_len, op);
+    // collapse (first, last)
+    u_.collapse(first, last,
+        pos + new_len);
+    // shift (last, end)
+    u_.adjust(last, id_end,
+        new_len - n0);
+    return dest;
+}
+
 char*
 url_base::
 shrink_impl(
@@ -2275,7 +2242,7 @@ shrink_impl(
     auto const pos =
         u_.offset(last);
     // adjust chars
-    std::memmove(
+    detail::move_chars(
         s_ + pos - n,
         s_ + pos,
         u_.offset(
@@ -13,6 +13,8 @@
 
 #include <boost/url/url_view.hpp>
 #include <boost/url/detail/except.hpp>
+#include <boost/url/detail/parse_stats.hpp>
+#include <boost/url/detail/usdt.hpp>
 #include <boost/url/rfc/absolute_uri_rule.hpp>
 #include <boost/url/rfc/relative_ref_rule.hpp>
 #include <boost/url/rfc/uri_rule.hpp>
@@ -80,8 +82,10 @@ parse_absolute_uri(
     if(s.size() > url_view::max_size())
         detail::throw_length_error(
             "too large");
-    return grammar::parse(
+    auto rv = grammar::parse(
         s, absolute_uri_rule);
+    detail::count_parse(s, rv);
+    return rv;
 }
 
 result<url_view>
@@ -91,8 +95,15 @@ parse_origin_form(
     if(s.size() > url_view::max_size())
         detail::throw_length_error(
             "too large");
-    return grammar::parse(
+    BOOST_URL_PROBE1(parse_origin_form_entry,
+        s.size());
+    auto rv = grammar::parse(
         s, origin_form_rule);
+    detail::count_parse(s, rv);
+    BOOST_URL_PROBE2(parse_origin_form_return,
+        s.size(), rv.has_error() ?
+            rv.error().value() : 0);
+    return rv;
 }
 
 result<url_view>
@@ -103,8 +114,10 @@ parse_relative_ref(
         detail::throw_length_error(
             "too large");
 
-    return grammar::parse(
+    auto rv = grammar::parse(
         s, relative_ref_rule);
+    detail::count_parse(s, rv);
+    return rv;
 }
 result<url_view>
 parse_uri(
@@ -113,7 +126,9 @@ parse_uri(
     if(s.size() > url_view::max_size())
         detail::throw_length_error(
             "too large");
-    return grammar::parse(s, uri_rule);
+    auto rv = grammar::parse(s, uri_rule);
+    detail::count_parse(s, rv);
+    return rv;
 }
 
 result<url_view>
@@ -124,8 +139,15 @@ parse_uri_reference(
         detail::throw_length_error(
             "too large");
 
-    return grammar::parse(
+    BOOST_URL_PROBE1(parse_uri_reference_entry,
+        s.size());
+    auto rv = grammar::parse(
         s, uri_reference_rule);
+    detail::count_parse(s, rv);
+    BOOST_URL_PROBE2(parse_uri_reference_return,
+        s.size(), rv.has_error() ?
+            rv.error().value() : 0);
+    return rv;
 }
 
 } // urls
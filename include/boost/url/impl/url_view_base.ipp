@@ -18,6 +18,25 @@
 namespace boost {
 namespace urls {
 
+namespace {
+
+// The port as it is compared and hashed,
+// which is empty for the default port of
+// the scheme, as normalize removes it
+string_view
+normalized_port(
+    url_view_base const& u) noexcept
+{
+    std::uint16_t const dp =
+        default_port(u.scheme_id());
+    if( dp != 0 &&
+        u.port_number() == dp)
+        return {};
+    return u.port();
+}
+
+} // (anon)
+
 // construct empty view
 url_view_base::
 url_view_base() noexcept
@@ -44,7 +63,7 @@ digest(std::size_t salt) const noexcept
     detail::digest_encoded(u_.get(id_user), h);
     detail::digest_encoded(u_.get(id_pass), h);
     detail::ci_digest_encoded(u_.get(id_host), h);
-    h.put(u_.get(id_port));
+    h.put(normalized_port(*this));
     detail::normalized_path_digest(
         u_.get(id_path), is_path_absolute(), h);
     detail::digest_encoded(u_.get(id_query), h);
@@ -573,8 +592,8 @@ compare(const url_view_base& other) const noexcept
         return comp;
 
     comp = detail::compare(
-        port(),
-        other.port());
+        normalized_port(*this),
+        normalized_port(other));
     if ( comp != 0 )
         return comp;
 
@@ -308,6 +308,56 @@ result<ipv4_address>
 parse_ipv4_address(
     string_view s) noexcept;
 
+/** Parse IPv4 addresses in dotted decimal form
+
+    This function parses each of the `n`
+    strings starting at `src`, which must
+    be entirely an IPv4 address, and stores
+    the address to the element of `dest`
+    with the same index. Strings which are
+    not valid addresses store the address
+    `0.0.0.0`, and the corresponding element
+    of `valid` is set to false when `valid`
+    is not null.
+
+    @par Example
+    @code
+    string_view const hosts[] = { "10.0.0.1", "10.0.0.256" };
+    ipv4_address addrs[2];
+    bool valid[2];
+    std::size_t n = parse_ipv4_batch( hosts, 2, addrs, valid );
+
+    assert( n == 1 && valid[0] && ! valid[1] );
+    @endcode
+
+    @par Complexity
+    Linear in the total size of the strings.
+
+    @par Exception Safety
+    Throws nothing.
+
+    @return The number of valid addresses.
+
+    @param src The strings to parse.
+
+    @param n The number of strings.
+
+    @param dest The addresses.
+
+    @param valid An optional array set to
+    true for each valid address.
+
+    @see
+        @ref parse_ipv4_address.
+*/
+BOOST_URL_DECL
+std::size_t
+parse_ipv4_batch(
+    string_view const* src,
+    std::size_t n,
+    ipv4_address* dest,
+    bool* valid = nullptr) noexcept;
+
 } // urls
 } // boost
 
@@ -78,6 +78,7 @@ class params_encoded_view
     : private detail::parts_base
 {
     friend class url_view_base;
+    friend class params_encoded_index;
     friend struct query_rule_t;
 
     string_view s_;
@@ -0,0 +1,630 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_PARAMS_INDEX_HPP
+#define BOOST_URL_PARAMS_INDEX_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/params_encoded_view.hpp>
+#include <boost/url/params_view.hpp>
+#include <boost/url/pct_encoded_view.hpp>
+#include <boost/url/string_view.hpp>
+#include <boost/url/detail/params_index.hpp>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+namespace boost {
+namespace urls {
+
+/** A hashed index of the keys in a range of query parameters
+
+    This object indexes the keys of a
+    @ref params_view in one pass over the
+    encoded query, so that lookups by key
+    run in constant time on average instead
+    of decoding and comparing every
+    parameter. Keys are compared as in
+    @ref params_view::find.
+
+    The table is placed in storage provided
+    by the caller, such as a stack buffer or
+    an arena, whose size is given by
+    @ref storage_size. The index never
+    allocates.
+
+    @par Example
+    @code
+    url_view u( "/api?limit=10&sort=name&tag=a&tag=b" );
+
+    alignas(std::size_t) char buf[ params_index::storage_size( 16 ) ];
+    params_index idx( u.params(), buf, sizeof(buf) );
+
+    assert( idx.at( "sort" ) == "name" );
+    assert( idx.count( "tag" ) == 2 );
+    @endcode
+
+    @par Lifetime
+    The index references the characters of
+    the query and the storage. Ownership is
+    not transferred; the caller is responsible
+    for ensuring that both outlive the index.
+
+    @see
+        @ref params_encoded_index.
+*/
+class params_index
+{
+    detail::params_index_impl impl_;
+
+    params_view::iterator
+    element(std::size_t j) const noexcept
+    {
+        auto const& e = impl_.t_[j];
+        return { impl_.s_, e.i, e.pos };
+    }
+
+    BOOST_URL_DECL
+    std::size_t
+    match(
+        string_view key,
+        std::size_t h,
+        std::size_t j) const noexcept;
+
+public:
+    /** A forward iterator to the elements matching a key
+    */
+#ifdef BOOST_URL_DOCS
+    using iterator = __see_below__;
+#else
+    class iterator;
+#endif
+
+    /// @copydoc iterator
+    using const_iterator = iterator;
+
+    /** Return the storage size needed to index a number of parameters
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param n The number of parameters.
+    */
+    static
+    constexpr
+    std::size_t
+    storage_size(std::size_t n) noexcept
+    {
+        return detail::params_index_impl::table_size(n) *
+            sizeof(detail::params_index_slot);
+    }
+
+    /** Return the hash of a key
+
+        The value may be passed to the lookup
+        functions which accept a hash, so that
+        a key used for many lookups is only
+        hashed once.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param key The decoded key.
+    */
+    static
+    std::size_t
+    hash(string_view key) noexcept
+    {
+        return detail::params_index_impl::hash(key);
+    }
+
+    /** Constructor
+
+        This function indexes the keys of `ps`.
+        The storage must be aligned for
+        `std::size_t`.
+
+        @par Complexity
+        Linear in `ps.encoded_string().size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+
+        @throw std::length_error `size` is less than
+        `storage_size( ps.size() )`.
+
+        @param ps The parameters to index.
+
+        @param storage A pointer to the storage.
+
+        @param size The size of the storage.
+    */
+    BOOST_URL_DECL
+    params_index(
+        params_view const& ps,
+        void* storage,
+        std::size_t size);
+
+    /** Return the indexed parameters
+    */
+    params_view
+    params() const noexcept
+    {
+        return { impl_.s_, impl_.n_ };
+    }
+
+    /** Return the first value matching a key
+
+        @par Complexity
+        Constant on average.
+
+        @par Exception Safety
+        Strong guarantee.
+
+        @throw std::out_of_range No element
+        with the key has a value.
+
+        @param key The decoded key.
+    */
+    pct_encoded_view
+    at(string_view key) const
+    {
+        return at(key, hash(key));
+    }
+
+    /** Return the first value matching a key with a precomputed hash
+
+        @par Exception Safety
+        Strong guarantee.
+
+        @throw std::out_of_range No element
+        with the key has a value.
+
+        @param key The decoded key.
+
+        @param h The value of `hash( key )`.
+    */
+    BOOST_URL_DECL
+    pct_encoded_view
+    at(
+        string_view key,
+        std::size_t h) const;
+
+    /** Return the number of elements matching a key
+
+        @par Complexity
+        Constant on average.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param key The decoded key.
+    */
+    std::size_t
+    count(string_view key) const noexcept
+    {
+        return count(key, hash(key));
+    }
+
+    /** Return the number of elements matching a key with a precomputed hash
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param key The decoded key.
+
+        @param h The value of `hash( key )`.
+    */
+    BOOST_URL_DECL
+    std::size_t
+    count(
+        string_view key,
+        std::size_t h) const noexcept;
+
+    /** Return the first element matching a key
+
+        This function returns an iterator of
+        the indexed @ref params_view to the
+        first element matching `key`, or its
+        end iterator.
+
+        @par Complexity
+        Constant on average.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param key The decoded key.
+    */
+    params_view::iterator
+    find(string_view key) const noexcept
+    {
+        return find(key, hash(key));
+    }
+
+    /** Return the first element matching a key with a precomputed hash
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param key The decoded key.
+
+        @param h The value of `hash( key )`.
+    */
+    params_view::iterator
+    find(
+        string_view key,
+        std::size_t h) const noexcept;
+
+    /** Return true if an element matches a key
+
+        @par Complexity
+        Constant on average.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param key The decoded key.
+    */
+    bool
+    contains(string_view key) const noexcept
+    {
+        return find(key) != params().end();
+    }
+
+    /** Return true if an element matches a key with a precomputed hash
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param key The decoded key.
+
+        @param h The value of `hash( key )`.
+    */
+    bool
+    contains(
+        string_view key,
+        std::size_t h) const noexcept
+    {
+        return find(key, h) != params().end();
+    }
+
+    /** Return the range of elements matching a key
+
+        The elements are visited in the
+        order they appear in the query.
+
+        @par Complexity
+        Constant on average.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param key The decoded key.
+    */
+    std::pair<iterator, iterator>
+    equal_range(string_view key) const noexcept;
+
+    /** Return the range of elements matching a key with a precomputed hash
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param key The decoded key.
+
+        @param h The value of `hash( key )`.
+    */
+    BOOST_URL_DECL
+    std::pair<iterator, iterator>
+    equal_range(
+        string_view key,
+        std::size_t h) const noexcept;
+};
+
+//------------------------------------------------
+
+/** A hashed index of the keys in a range of encoded query parameters
+
+    This object indexes the keys of a
+    @ref params_encoded_view in one pass,
+    so that lookups by key run in constant
+    time on average. Keys are compared as
+    in @ref params_encoded_view::find,
+    that is, as if both were decoded.
+
+    @par Example
+    @code
+    params_encoded_view pev = parse_query_params( "cust=John&id=42&last_invoice=1001" ).value();
+
+    alignas(std::size_t) char buf[ params_encoded_index::storage_size( 3 ) ];
+    params_encoded_index idx( pev, buf, sizeof(buf) );
+
+    assert( idx.at( "cust" ) == "John" );
+    @endcode
+
+    @see
+        @ref params_index.
+*/
+class params_encoded_index
+{
+    detail::params_index_impl impl_;
+
+    params_encoded_view::iterator
+    element(std::size_t j) const noexcept
+    {
+        auto const& e = impl_.t_[j];
+        return { impl_.s_, e.i, e.pos };
+    }
+
+    // plain is true when key has no escapes
+    BOOST_URL_DECL
+    std::size_t
+    match(
+        string_view key,
+        bool plain,
+        std::size_t h,
+        std::size_t j) const noexcept;
+
+public:
+    /** A forward iterator to the elements matching a key
+    */
+#ifdef BOOST_URL_DOCS
+    using iterator = __see_below__;
+#else
+    class iterator;
+#endif
+
+    /// @copydoc iterator
+    using const_iterator = iterator;
+
+    /** Return the storage size needed to index a number of parameters
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param n The number of parameters.
+    */
+    static
+    constexpr
+    std::size_t
+    storage_size(std::size_t n) noexcept
+    {
+        return detail::params_index_impl::table_size(n) *
+            sizeof(detail::params_index_slot);
+    }
+
+    /** Return the hash of a key
+
+        The value may be passed to the lookup
+        functions which accept a hash, so that
+        a key used for many lookups is only
+        hashed once.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param key The encoded key.
+    */
+    static
+    std::size_t
+    hash(string_view key) noexcept
+    {
+        return detail::params_index_impl::hash_encoded(
+            key, false);
+    }
+
+    /** Constructor
+
+        This function indexes the keys of `ps`.
+        The storage must be aligned for
+        `std::size_t`.
+
+        @par Complexity
+        Linear in `ps.encoded_string().size()`.
+
+        @par Exception Safety
+        Strong guarantee.
+
+        @throw std::length_error `size` is less than
+        `storage_size( ps.size() )`.
+
+        @param ps The parameters to index.
+
+        @param storage A pointer to the storage.
+
+        @param size The size of the storage.
+    */
+    BOOST_URL_DECL
+    params_encoded_index(
+        params_encoded_view const& ps,
+        void* storage,
+        std::size_t size);
+
+    /** Return the indexed parameters
+    */
+    params_encoded_view
+    params() const noexcept
+    {
+        return { impl_.s_, impl_.n_ };
+    }
+
+    /** Return the first value matching a key
+
+        @par Complexity
+        Constant on average.
+
+        @par Exception Safety
+        Strong guarantee.
+
+        @throw std::out_of_range No element
+        with the key has a value.
+
+        @param key The encoded key.
+    */
+    string_view
+    at(string_view key) const
+    {
+        return at(key, hash(key));
+    }
+
+    /** Return the first value matching a key with a precomputed hash
+
+        @par Exception Safety
+        Strong guarantee.
+
+        @throw std::out_of_range No element
+        with the key has a value.
+
+        @param key The encoded key.
+
+        @param h The value of `hash( key )`.
+    */
+    BOOST_URL_DECL
+    string_view
+    at(
+        string_view key,
+        std::size_t h) const;
+
+    /** Return the number of elements matching a key
+
+        @par Complexity
+        Constant on average.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param key The encoded key.
+    */
+    std::size_t
+    count(string_view key) const noexcept
+    {
+        return count(key, hash(key));
+    }
+
+    /** Return the number of elements matching a key with a precomputed hash
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param key The encoded key.
+
+        @param h The value of `hash( key )`.
+    */
+    BOOST_URL_DECL
+    std::size_t
+    count(
+        string_view key,
+        std::size_t h) const noexcept;
+
+    /** Return the first element matching a key
+
+        This function returns an iterator of
+        the indexed @ref params_encoded_view to
+        the first element matching `key`, or
+        its end iterator.
+
+        @par Complexity
+        Constant on average.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param key The encoded key.
+    */
+    params_encoded_view::iterator
+    find(string_view key) const noexcept
+    {
+        return find(key, hash(key));
+    }
+
+    /** Return the first element matching a key with a precomputed hash
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param key The encoded key.
+
+        @param h The value of `hash( key )`.
+    */
+    params_encoded_view::iterator
+    find(
+        string_view key,
+        std::size_t h) const noexcept;
+
+    /** Return true if an element matches a key
+
+        @par Complexity
+        Constant on average.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param key The encoded key.
+    */
+    bool
+    contains(string_view key) const noexcept
+    {
+        return find(key) != params().end();
+    }
+
+    /** Return true if an element matches a key with a precomputed hash
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param key The encoded key.
+
+        @param h The value of `hash( key )`.
+    */
+    bool
+    contains(
+        string_view key,
+        std::size_t h) const noexcept
+    {
+        return find(key, h) != params().end();
+    }
+
+    /** Return the range of elements matching a key
+
+        The elements are visited in the
+        order they appear in the query.
+
+        @par Complexity
+        Constant on average.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param key The encoded key.
+    */
+    std::pair<iterator, iterator>
+    equal_range(string_view key) const noexcept;
+
+    /** Return the range of elements matching a key with a precomputed hash
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param key The encoded key.
+
+        @param h The value of `hash( key )`.
+    */
+    BOOST_URL_DECL
+    std::pair<iterator, iterator>
+    equal_range(
+        string_view key,
+        std::size_t h) const noexcept;
+};
+
+} // urls
+} // boost
+
+#include <boost/url/impl/params_index.hpp>
+
+#endif
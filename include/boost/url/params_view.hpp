@@ -31,6 +31,7 @@ class params_view
 {
     friend class url_view_base;
     friend class params_encoded_view;
+    friend class params_index;
 
     string_view s_;
     std::size_t n_ = 0;
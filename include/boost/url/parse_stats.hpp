@@ -0,0 +1,196 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_PARSE_STATS_HPP
+#define BOOST_URL_PARSE_STATS_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/error.hpp>
+#include <boost/url/grammar/error.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace urls {
+
+/** A histogram of sizes in powers of two
+
+    Bin 0 counts zeros, and bin `k` counts
+    the values in `[2^(k-1), 2^k)`. The last
+    bin also counts every larger value.
+
+    @see
+        @ref parse_stats.
+*/
+struct log2_histogram
+{
+    /** The number of bins
+    */
+    static constexpr std::size_t size = 32;
+
+    /** The count of values in each bin
+    */
+    std::size_t bins[size] = {};
+
+    /** Return the bin of a value
+    */
+    static
+    std::size_t
+    bin(std::size_t v) noexcept
+    {
+        std::size_t k = 0;
+        while(v && k < size - 1)
+        {
+            v >>= 1;
+            ++k;
+        }
+        return k;
+    }
+
+    /** Count a value
+    */
+    void
+    add(std::size_t v) noexcept
+    {
+        ++bins[bin(v)];
+    }
+
+    /** Add the counts of another histogram
+    */
+    log2_histogram&
+    operator+=(
+        log2_histogram const& other) noexcept
+    {
+        for(std::size_t i = 0; i < size; ++i)
+            bins[i] += other.bins[i];
+        return *this;
+    }
+};
+
+/** Counters of the parse functions
+
+    These counters describe the strings given
+    to the parse functions, such as @ref
+    parse_uri, @ref parse_authority, @ref
+    parse_path and @ref parse_query_params:
+    the errors which made them fail, and the
+    sizes of the parts of those which did not.
+    Each thread has its own counters, which
+    only change when the macro
+    `BOOST_URL_PARSE_STATS` is defined, so
+    that no counting is done otherwise.
+
+    The counting is done by inline functions,
+    so the macro must be defined for the
+    library and for every translation unit
+    which includes its headers, for example
+    on the command line of the whole build.
+    Defining it in only some of them
+    violates the one definition rule.
+
+    A snapshot of the counters of a thread is
+    returned by @ref thread_parse_stats, and
+    the snapshots of many threads may be
+    added together for reporting.
+
+    @par Example
+    @code
+    parse_stats total;
+
+    // on each thread, from time to time
+    total += thread_parse_stats();
+    reset_thread_parse_stats();
+    @endcode
+
+    @see
+        @ref reset_thread_parse_stats,
+        @ref thread_parse_stats.
+*/
+struct parse_stats
+{
+    /** Calls to parse functions
+    */
+    std::size_t parses = 0;
+
+    /** Calls which returned an error
+    */
+    std::size_t failures = 0;
+
+    /** Failures for each @ref error, by value
+    */
+    std::size_t url_errors[static_cast<
+        int>(error::not_a_base) + 1] = {};
+
+    /** Failures for each @ref grammar::error, by value
+    */
+    std::size_t grammar_errors[static_cast<
+        int>(grammar::error::syntax) + 1] = {};
+
+    /** Failures with an error of any other category
+    */
+    std::size_t other_errors = 0;
+
+    /** The sizes of every string parsed
+    */
+    log2_histogram input;
+
+    /** The sizes of the parts which are present
+
+        These are counted when a parse
+        succeeds, with the sizes of the
+        encoded parts, as returned by
+        functions such as @ref
+        url_view_base::encoded_host.
+    */
+    log2_histogram scheme;
+    log2_histogram user;        ///< @copydoc scheme
+    log2_histogram password;    ///< @copydoc scheme
+    log2_histogram host;        ///< @copydoc scheme
+    log2_histogram port;        ///< @copydoc scheme
+    log2_histogram path;        ///< @copydoc scheme
+    log2_histogram query;       ///< @copydoc scheme
+    log2_histogram fragment;    ///< @copydoc scheme
+
+    /** The number of segments of each path
+    */
+    log2_histogram segments;
+
+    /** The number of params of each query
+    */
+    log2_histogram params;
+
+    /** Add the counters of another snapshot
+    */
+    BOOST_URL_DECL
+    parse_stats&
+    operator+=(
+        parse_stats const& other) noexcept;
+};
+
+/** Return the counters of the calling thread
+
+    @see
+        @ref parse_stats.
+*/
+BOOST_URL_DECL
+parse_stats
+thread_parse_stats() noexcept;
+
+/** Set the counters of the calling thread to zero
+
+    @see
+        @ref parse_stats.
+*/
+BOOST_URL_DECL
+void
+reset_thread_parse_stats() noexcept;
+
+} // urls
+} // boost
+
+#endif
@@ -21,14 +21,6 @@
 namespace boost {
 namespace urls {
 
-#ifndef BOOST_URL_DOCS
-namespace grammar {
-namespace detail {
-class copied_strings_base;
-} // detail
-} // grammar
-#endif
-
 //------------------------------------------------
 
 /** A reference to a valid, percent-encoded string
@@ -92,13 +84,6 @@ class pct_encoded_view
         std::size_t n,
         pct_decode_opts opt = {}) noexcept;
 
-    /** Return a view whose buffer does not overlap, copying if necessary
-    */
-    BOOST_URL_DECL
-    pct_encoded_view
-    maybe_copy(
-        grammar::detail::copied_strings_base& sp) const;
-
 public:
     /** Type of a decoded character
     */
@@ -0,0 +1,279 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_QUERY_SCHEMA_HPP
+#define BOOST_URL_QUERY_SCHEMA_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/result.hpp>
+#include <boost/url/string_view.hpp>
+#include <boost/url/detail/query_schema.hpp>
+#include <boost/mp11/integer_sequence.hpp>
+#include <boost/static_assert.hpp>
+#include <cstddef>
+#include <tuple>
+#include <utility>
+
+namespace boost {
+namespace urls {
+
+/** Return a field of a query schema
+
+    The field maps the parameters whose
+    decoded key is equal to `key` to the
+    data member `member` of the destination.
+    The value is converted according to the
+    type of the member:
+
+    @li `bool`: "1" and "true" are true,
+    "0" and "false" are false, and a key
+    without a value is true.
+
+    @li Integers: decimal digits, with a
+    leading '-' for signed types. Values
+    out of range are errors.
+
+    @li @ref string_view: the encoded value.
+
+    @li @ref pct_encoded_view: the decoded
+    value, without copying.
+
+    @li `std::vector` of any of the above:
+    every matching parameter is appended,
+    in order.
+
+    For other members, the last matching
+    parameter wins.
+
+    @par Example
+    @code
+    struct search
+    {
+        unsigned page = 1;
+        std::vector< unsigned > ids;
+    };
+
+    auto const schema = make_query_schema(
+        query_field( "page", &search::page ),
+        query_field( "id", &search::ids ) );
+    @endcode
+
+    @param key The decoded key.
+
+    @param member A pointer to the data member.
+
+    @see
+        @ref make_query_schema.
+*/
+template<class T, class M>
+#ifdef BOOST_URL_DOCS
+__see_below__
+#else
+detail::schema_field<T, M, detail::schema_value>
+#endif
+query_field(
+    string_view key,
+    M T::* member) noexcept
+{
+    return { key, member, {} };
+}
+
+/** Return a field of a query schema for an enumeration
+
+    The field maps the parameters whose
+    decoded key is equal to `key` to the
+    data member `member`, which holds an
+    enumeration or a `std::vector` of them.
+    The decoded value is looked up by name
+    in `names`; values which are not found
+    are errors.
+
+    @par Example
+    @code
+    enum class order { asc, desc };
+
+    std::pair< string_view, order > const orders[] = {
+        { "asc", order::asc },
+        { "desc", order::desc } };
+
+    auto f = query_field( "order", &search::ord, orders );
+    @endcode
+
+    @par Lifetime
+    The names are referenced by the field;
+    they must outlive the schema.
+
+    @param key The decoded key.
+
+    @param member A pointer to the data member.
+
+    @param names The names of the enumerators.
+*/
+template<class T, class M, class E, std::size_t N>
+#ifdef BOOST_URL_DOCS
+__see_below__
+#else
+detail::schema_field<T, M, detail::schema_enum<E>>
+#endif
+query_field(
+    string_view key,
+    M T::* member,
+    std::pair<string_view, E> const (&names)[N]) noexcept
+{
+    return { key, member, { names, N } };
+}
+
+//------------------------------------------------
+
+/** A schema which extracts typed values from a query
+
+    The fields of a schema, created with
+    @ref query_field, map parameter keys to
+    the data members of a destination type.
+    Parsing visits each parameter of the
+    encoded query once, finds its field with
+    a perfect hash of the keys of the schema,
+    and converts its value directly from the
+    encoded characters. No memory is
+    allocated, except by repeated fields.
+
+    The types of the fields are part of the
+    type of the schema. The hash table is
+    built by the constructor, so a schema
+    is best constructed once and reused.
+
+    Parameters whose keys are not in the
+    schema are ignored, and members which
+    do not appear in the query are left
+    unchanged.
+
+    @par Example
+    @code
+    struct search
+    {
+        unsigned page = 1;
+        unsigned limit = 20;
+        string_view sort;
+        bool debug = false;
+        std::vector< unsigned > ids;
+    };
+
+    static auto const schema = make_query_schema(
+        query_field( "page", &search::page ),
+        query_field( "limit", &search::limit ),
+        query_field( "sort", &search::sort ),
+        query_field( "debug", &search::debug ),
+        query_field( "id", &search::ids ) );
+
+    url_view u( "/search?page=3&sort=name&id=1&id=2&debug" );
+
+    search s;
+    result< void > rv = schema.parse( u.encoded_query(), s );
+
+    assert( rv.has_value() );
+    assert( s.page == 3 && s.sort == "name" && s.ids.size() == 2 );
+    @endcode
+
+    @tparam Fields The types of the fields.
+
+    @see
+        @ref make_query_schema,
+        @ref query_field.
+*/
+template<class... Fields>
+class query_schema
+{
+    BOOST_STATIC_ASSERT(
+        sizeof...(Fields) > 0 &&
+        sizeof...(Fields) < 256);
+
+    using tuple_type = std::tuple<Fields...>;
+
+    tuple_type fields_;
+    detail::schema_table<
+        sizeof...(Fields)> table_;
+
+public:
+    /** The type of the destination
+    */
+    using value_type = typename std::tuple_element<
+        0, tuple_type>::type::object_type;
+
+    /** Constructor
+
+        @par Complexity
+        Linear in the number of fields.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param fs The fields.
+    */
+    explicit
+    query_schema(
+        Fields const&... fs) noexcept;
+
+    /** Extract the values of the parameters of a query
+
+        Each parameter of `s` whose key is in
+        the schema is converted and stored in
+        the corresponding member of `v`. On
+        error, the members for the parameters
+        before the failing one have been
+        assigned.
+
+        @par Complexity
+        Linear in `s.size()`.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @return An error if a value could not
+        be converted.
+
+        @param s The encoded query, which
+        must be valid.
+
+        @param v The destination.
+    */
+    result<void>
+    parse(
+        string_view s,
+        value_type& v) const;
+};
+
+/** Return a query schema
+
+    @par Example
+    @code
+    auto const schema = make_query_schema(
+        query_field( "page", &search::page ),
+        query_field( "sort", &search::sort ) );
+    @endcode
+
+    @param fs The fields, created with
+    @ref query_field.
+
+    @see
+        @ref query_schema.
+*/
+template<class... Fields>
+query_schema<Fields...>
+make_query_schema(
+    Fields const&... fs) noexcept
+{
+    return query_schema<Fields...>(fs...);
+}
+
+} // urls
+} // boost
+
+#include <boost/url/impl/query_schema.hpp>
+
+#endif
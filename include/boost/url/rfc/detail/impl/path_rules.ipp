@@ -30,7 +30,7 @@ parse(
         return value_type{};
     if(*it == '/')
     {
-        BOOST_URL_RETURN_EC(
+        BOOST_URL_RETURN_TRIAL_EC(
             grammar::error::mismatch);
     }
     auto rv = grammar::parse(
@@ -30,13 +30,13 @@ parse(
     if(it == end)
     {
         // end
-        BOOST_URL_RETURN_EC(
+        BOOST_URL_RETURN_TRIAL_EC(
             grammar::error::mismatch);
     }
     if(! grammar::alpha_chars(*it))
     {
         // expected alpha
-        BOOST_URL_RETURN_EC(
+        BOOST_URL_RETURN_TRIAL_EC(
             grammar::error::mismatch);
     }
 
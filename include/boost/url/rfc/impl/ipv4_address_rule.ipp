@@ -11,10 +11,7 @@
 #define BOOST_URL_RFC_IMPL_IPV4_ADDRESS_RULE_IPP
 
 #include <boost/url/rfc/ipv4_address_rule.hpp>
-#include <boost/url/grammar/delim_rule.hpp>
-#include <boost/url/grammar/dec_octet_rule.hpp>
-#include <boost/url/grammar/parse.hpp>
-#include <boost/url/grammar/tuple_rule.hpp>
+#include <boost/url/detail/ipv4.hpp>
 
 namespace boost {
 namespace urls {
@@ -27,20 +24,15 @@ parse(
         ) const noexcept ->
     result<value_type>
 {
-    using namespace grammar;
-    auto rv = grammar::parse(
-        it, end, tuple_rule(
-            dec_octet_rule, squelch(delim_rule('.')),
-            dec_octet_rule, squelch(delim_rule('.')),
-            dec_octet_rule, squelch(delim_rule('.')),
-            dec_octet_rule));
-    if(! rv)
-        return rv.error();
-    std::array<unsigned char, 4> v;
-    v[0] = std::get<0>(*rv);
-    v[1] = std::get<1>(*rv);
-    v[2] = std::get<2>(*rv);
-    v[3] = std::get<3>(*rv);
+    std::uint32_t v;
+    grammar::error ev;
+    if(! detail::parse_ipv4(
+            it, end, v, ev))
+    {
+        // host_rule discards any error
+        // and tries a reg-name instead
+        BOOST_URL_RETURN_TRIAL_EC(ev);
+    }
     return ipv4_address(v);
 }
 
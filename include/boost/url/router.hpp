@@ -0,0 +1,272 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_ROUTER_HPP
+#define BOOST_URL_ROUTER_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/segments_encoded_view.hpp>
+#include <boost/url/string_view.hpp>
+#include <boost/url/detail/router.hpp>
+#include <boost/assert.hpp>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+/** The params captured by a route
+
+    This object holds the name and the
+    encoded value of each `{param}` and `*`
+    wildcard of the route which matched a
+    path, in the order of the pattern. The
+    wildcard is named "*" and its value is
+    the encoded remainder of the path.
+
+    @par Lifetime
+    The names reference the router and the
+    values reference the characters of the
+    path. Ownership is not transferred; the
+    caller is responsible for ensuring that
+    both outlive the object.
+
+    @see
+        @ref router.
+*/
+class route_match
+{
+    friend class detail::router_base;
+    friend class detail::route_dfa;
+
+    std::size_t n_ = 0;
+    string_view names_[16];
+    string_view values_[16];
+
+public:
+    /** The largest number of params of a route
+    */
+    static constexpr std::size_t max_size = 16;
+
+    /** Constructor
+
+        Default constructed objects hold
+        no params.
+    */
+    route_match() = default;
+
+    /** Return the number of params
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return n_;
+    }
+
+    /** Return true if there are no params
+    */
+    bool
+    empty() const noexcept
+    {
+        return n_ == 0;
+    }
+
+    /** Return the name of a param
+
+        @par Precondition
+        `i < size()`
+    */
+    string_view
+    name(std::size_t i) const noexcept
+    {
+        BOOST_ASSERT(i < n_);
+        return names_[i];
+    }
+
+    /** Return the encoded value of a param
+
+        @par Precondition
+        `i < size()`
+    */
+    string_view
+    value(std::size_t i) const noexcept
+    {
+        BOOST_ASSERT(i < n_);
+        return values_[i];
+    }
+
+    /** Return true if a param has a name
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param name The name of the param.
+    */
+    BOOST_URL_DECL
+    bool
+    contains(string_view name) const noexcept;
+
+    /** Return the encoded value of a param by name
+
+        @par Exception Safety
+        Strong guarantee.
+
+        @throw std::out_of_range No param
+        has the name.
+
+        @param name The name of the param.
+    */
+    BOOST_URL_DECL
+    string_view
+    at(string_view name) const;
+};
+
+//------------------------------------------------
+
+/** A router which maps URL paths to values
+
+    Routes are added with patterns made of
+    segments separated by slashes. Each
+    segment of a pattern is one of:
+
+    @li A literal, in encoded form, which
+    matches a segment of the path equal to
+    it once both are decoded.
+
+    @li A param such as `{id}`, which matches
+    any nonempty segment.
+
+    @li A wildcard `*`, which must be the last
+    segment and matches the remainder of the
+    path, including nothing.
+
+    The patterns are stored in a radix tree
+    over the encoded segments, where chains
+    of literal segments share one node. A
+    path is matched in one walk of the tree
+    without allocating: literal segments are
+    compared with the encoded characters of
+    the path, and params are captured as
+    views of them. When several routes match
+    a path, literals are preferred over
+    params and params over wildcards, one
+    segment at a time.
+
+    @par Example
+    @code
+    router< int > r;
+    r.insert( "/api/users", 1 );
+    r.insert( "/api/users/{id}", 2 );
+    r.insert( "/static/{file}", 3 );
+
+    url_view u( "/api/users/42" );
+    route_match m;
+    int const* v = r.find( u.encoded_segments(), m );
+
+    assert( v && *v == 2 );
+    assert( m.at( "id" ) == "42" );
+    @endcode
+
+    @tparam T The type of value held for
+    each route.
+
+    @see
+        @ref route_match.
+*/
+template<class T>
+class router
+{
+    template<class>
+    friend class compiled_router;
+
+    detail::router_base impl_;
+    std::vector<T> v_;
+
+public:
+    /** The type of value held for each route
+    */
+    using value_type = T;
+
+    /** Constructor
+
+        Default constructed routers have
+        no routes.
+    */
+    router() = default;
+
+    /** Return the number of routes
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return v_.size();
+    }
+
+    /** Add a route
+
+        @par Exception Safety
+        Basic guarantee. Calls to allocate
+        may throw. On error the routes are
+        unchanged, though the tree may keep
+        nodes without routes.
+
+        @throw std::invalid_argument The
+        pattern is malformed, names a param
+        differently from an existing route
+        at the same position, has more than
+        @ref route_match::max_size params,
+        or is already in the router.
+
+        @param pattern The pattern.
+
+        @param value The value of the route.
+    */
+    void
+    insert(
+        string_view pattern,
+        T value);
+
+    /** Return the value of the route matching a path
+
+        This function returns a pointer to the
+        value of the route which matches the
+        segments of `path`, or null. On a match,
+        `m` holds the captured params.
+
+        @par Complexity
+        Linear in the size of the path when
+        the routes have no params, otherwise
+        the search may backtrack.
+
+        @par Exception Safety
+        Throws nothing.
+
+        @param path The path to match.
+
+        @param m The captured params.
+    */
+    T const*
+    find(
+        segments_encoded_view const& path,
+        route_match& m) const noexcept;
+
+    /// @copydoc find
+    T*
+    find(
+        segments_encoded_view const& path,
+        route_match& m) noexcept;
+};
+
+} // urls
+} // boost
+
+#include <boost/url/impl/router.hpp>
+
+#endif
@@ -12,6 +12,7 @@
 
 #include <boost/url/detail/config.hpp>
 #include <boost/url/string_view.hpp>
+#include <cstdint>
 
 namespace boost {
 namespace urls {
@@ -140,6 +141,80 @@ BOOST_URL_DECL
 scheme
 string_to_scheme(string_view s) noexcept;
 
+/** Information about a known scheme
+
+    Objects of this type describe the rules
+    of a known scheme which apply to URLs
+    beyond the generic syntax, such as the
+    port used when none is given.
+
+    @see
+        @ref get_scheme_info.
+*/
+struct scheme_info
+{
+    /** The scheme
+    */
+    scheme id;
+
+    /** The normalized name of the scheme
+    */
+    string_view name;
+
+    /** The default port, or zero if there is none
+
+        A port equal to the default port is
+        removed by @ref url_base::normalize.
+    */
+    std::uint16_t default_port;
+
+    /** True if URLs of this scheme require an authority
+    */
+    bool requires_authority;
+
+    /** True if an empty path is equivalent to "/"
+
+        This holds for URLs with an authority,
+        such as "http://example.com", which
+        refers to the same resource as
+        "http://example.com/".
+    */
+    bool empty_path_is_root;
+};
+
+/** Return information about a known scheme
+
+    If `s` is @ref scheme::none or
+    @ref scheme::unknown, null is returned.
+
+    @par Exception Safety
+    Throws nothing.
+
+    @param s The known scheme constant
+*/
+BOOST_URL_DECL
+scheme_info const*
+get_scheme_info(scheme s) noexcept;
+
+/** Return the default port of a known scheme
+
+    If `s` has no default port, or is
+    not a known scheme, zero is returned.
+
+    @par Example
+    @code
+    assert( default_port( scheme::https ) == 443 );
+    @endcode
+
+    @par Exception Safety
+    Throws nothing.
+
+    @param s The known scheme constant
+*/
+BOOST_URL_DECL
+std::uint16_t
+default_port(scheme s) noexcept;
+
 /** Return the normalized string for a known scheme
 
     @return A string representing the known scheme
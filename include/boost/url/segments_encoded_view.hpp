@@ -24,6 +24,9 @@ namespace urls {
 #ifndef BOOST_URL_DOCS
 // VFALCO is this needed?
 class url_view;
+namespace detail {
+class router_base;
+}
 #endif
 
 /** A bidirectional range of read-only encoded path segment strings.
@@ -89,6 +92,8 @@ class segments_encoded_view
     std::size_t n_ = 0;
 
     friend class url_view_base;
+    friend class segments_encoded_index;
+    friend class detail::router_base;
 
     BOOST_URL_DECL
     segments_encoded_view(
@@ -0,0 +1,383 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+#ifndef BOOST_URL_SEGMENTS_INDEX_HPP
+#define BOOST_URL_SEGMENTS_INDEX_HPP
+
+#include <boost/url/detail/config.hpp>
+#include <boost/url/pct_encoded_view.hpp>
+#include <boost/url/segments_encoded_view.hpp>
+#include <boost/url/segments_view.hpp>
+#include <boost/url/string_view.hpp>
+#include <boost/url/detail/segments_index.hpp>
+#include <cstddef>
+#include <iterator>
+
+namespace boost {
+namespace urls {
+
+/** A random-access index of the segments in a path
+
+    This object records the offset of every
+    segment of a @ref segments_view in one
+    pass over the encoded path, so that
+    segments can be accessed by position in
+    constant time. The decoded segments are
+    the same as those of the view.
+
+    Offsets for typical paths are stored
+    inside the object. Deeper paths allocate
+    the table from the free store.
+
+    @par Example
+    @code
+    url_view u( "/api/v1/users/42/posts" );
+
+    segments_index idx( u.segments() );
+
+    assert( idx.size() == 5 );
+    assert( idx[3] == "42" );
+    assert( idx.back() == "posts" );
+    @endcode
+
+    @par Lifetime
+    The index references the characters of
+    the path. Ownership is not transferred;
+    the caller is responsible for ensuring
+    that they outlive the index.
+
+    @see
+        @ref segments_encoded_index.
+*/
+class segments_index
+{
+    string_view s_;
+    detail::segments_index_impl impl_;
+
+public:
+    /** A random-access iterator to a decoded segment
+    */
+#ifdef BOOST_URL_DOCS
+    using iterator = __see_below__;
+#else
+    class iterator;
+#endif
+
+    /// @copydoc iterator
+    using const_iterator = iterator;
+
+    /** A type which can represent a segment as a value
+    */
+    using value_type = std::string;
+
+    /** A type which can represent a segment as a const reference
+    */
+    using reference = pct_encoded_view;
+
+    /// @copydoc reference
+    using const_reference = pct_encoded_view;
+
+    /** The unsigned integer type used to represent size.
+    */
+    using size_type = std::size_t;
+
+    /** The signed integer type used to represent differences.
+    */
+    using difference_type = std::ptrdiff_t;
+
+    /** Constructor
+
+        This function records the offsets
+        of the segments of `sv`.
+
+        @par Complexity
+        Linear in the size of the path.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @param sv The segments to index.
+    */
+    explicit
+    segments_index(
+        segments_view const& sv)
+        : s_(sv.s_)
+        , impl_(sv.s_, sv.n_)
+    {
+    }
+
+    /** Return the indexed segments
+    */
+    segments_view
+    segments() const noexcept
+    {
+        return { s_, impl_.n_ };
+    }
+
+    /** Return the segment at a position
+
+        @par Precondition
+        `i < size()`
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    pct_encoded_view
+    operator[](std::size_t i) const noexcept;
+
+    /** Return the segment at a position
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Strong guarantee.
+
+        @throw std::out_of_range `i >= size()`
+    */
+    BOOST_URL_DECL
+    pct_encoded_view
+    at(std::size_t i) const;
+
+    /** Return the first segment
+
+        @par Precondition
+        `not empty()`
+
+        @par Complexity
+        Constant.
+    */
+    pct_encoded_view
+    front() const noexcept
+    {
+        return (*this)[0];
+    }
+
+    /** Return the last segment
+
+        @par Precondition
+        `not empty()`
+
+        @par Complexity
+        Constant.
+    */
+    pct_encoded_view
+    back() const noexcept
+    {
+        return (*this)[size() - 1];
+    }
+
+    /** Return an iterator to the first segment
+    */
+    iterator
+    begin() const noexcept;
+
+    /** Return an iterator to the end
+    */
+    iterator
+    end() const noexcept;
+
+    /** Return true if there are no segments
+    */
+    bool
+    empty() const noexcept
+    {
+        return impl_.n_ == 0;
+    }
+
+    /** Return the number of segments
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return impl_.n_;
+    }
+};
+
+//------------------------------------------------
+
+/** A random-access index of the segments in an encoded path
+
+    This object records the offset of every
+    segment of a @ref segments_encoded_view
+    in one pass, so that segments can be
+    accessed by position in constant time.
+
+    @par Example
+    @code
+    segments_encoded_view sev = parse_path( "/a/b%20c/d" ).value();
+
+    segments_encoded_index idx( sev );
+
+    assert( idx[1] == "b%20c" );
+    @endcode
+
+    @see
+        @ref segments_index.
+*/
+class segments_encoded_index
+{
+    string_view s_;
+    detail::segments_index_impl impl_;
+
+public:
+    /** A random-access iterator to an encoded segment
+    */
+#ifdef BOOST_URL_DOCS
+    using iterator = __see_below__;
+#else
+    class iterator;
+#endif
+
+    /// @copydoc iterator
+    using const_iterator = iterator;
+
+    /** A type which can represent a segment as a value
+    */
+    using value_type = std::string;
+
+    /** A type which can represent a segment as a const reference
+    */
+    using reference = string_view;
+
+    /// @copydoc reference
+    using const_reference = string_view;
+
+    /** The unsigned integer type used to represent size.
+    */
+    using size_type = std::size_t;
+
+    /** The signed integer type used to represent differences.
+    */
+    using difference_type = std::ptrdiff_t;
+
+    /** Constructor
+
+        This function records the offsets
+        of the segments of `sv`.
+
+        @par Complexity
+        Linear in the size of the path.
+
+        @par Exception Safety
+        Calls to allocate may throw.
+
+        @param sv The segments to index.
+    */
+    explicit
+    segments_encoded_index(
+        segments_encoded_view const& sv)
+        : s_(sv.s_)
+        , impl_(sv.s_, sv.n_)
+    {
+    }
+
+    /** Return the indexed segments
+    */
+    segments_encoded_view
+    segments() const noexcept
+    {
+        return { s_, impl_.n_ };
+    }
+
+    /** Return the segment at a position
+
+        @par Precondition
+        `i < size()`
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Throws nothing.
+    */
+    string_view
+    operator[](std::size_t i) const noexcept
+    {
+        return impl_.get(i);
+    }
+
+    /** Return the segment at a position
+
+        @par Complexity
+        Constant.
+
+        @par Exception Safety
+        Strong guarantee.
+
+        @throw std::out_of_range `i >= size()`
+    */
+    BOOST_URL_DECL
+    string_view
+    at(std::size_t i) const;
+
+    /** Return the first segment
+
+        @par Precondition
+        `not empty()`
+
+        @par Complexity
+        Constant.
+    */
+    string_view
+    front() const noexcept
+    {
+        return (*this)[0];
+    }
+
+    /** Return the last segment
+
+        @par Precondition
+        `not empty()`
+
+        @par Complexity
+        Constant.
+    */
+    string_view
+    back() const noexcept
+    {
+        return (*this)[size() - 1];
+    }
+
+    /** Return an iterator to the first segment
+    */
+    iterator
+    begin() const noexcept;
+
+    /** Return an iterator to the end
+    */
+    iterator
+    end() const noexcept;
+
+    /** Return true if there are no segments
+    */
+    bool
+    empty() const noexcept
+    {
+        return impl_.n_ == 0;
+    }
+
+    /** Return the number of segments
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return impl_.n_;
+    }
+};
+
+} // urls
+} // boost
+
+#include <boost/url/impl/segments_index.hpp>
+
+#endif
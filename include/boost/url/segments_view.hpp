@@ -37,6 +37,7 @@ class segments_view
 
     friend class url_view_base;
     friend class segments_encoded_view;
+    friend class segments_index;
 
     segments_view(
         string_view s,
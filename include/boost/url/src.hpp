@@ -29,32 +29,48 @@ in a translation unit of the program.
 
 #include <boost/url/detail/impl/any_path_iter.ipp>
 #include <boost/url/detail/impl/any_query_iter.ipp>
+#include <boost/url/detail/impl/cidr_trie.ipp>
 #include <boost/url/detail/impl/except.ipp>
+#include <boost/url/detail/impl/host_router.ipp>
+#include <boost/url/detail/impl/ipv4.ipp>
+#include <boost/url/detail/impl/ipv6.ipp>
 #include <boost/url/detail/impl/normalize.ipp>
 #include <boost/url/detail/impl/path.ipp>
 #include <boost/url/detail/impl/remove_dot_segments.ipp>
+#include <boost/url/detail/impl/route_dfa.ipp>
+#include <boost/url/detail/impl/router.ipp>
 #include <boost/url/detail/impl/params_encoded_iterator_impl.ipp>
+#include <boost/url/detail/impl/params_index.ipp>
 #include <boost/url/detail/impl/params_iterator_impl.ipp>
 #include <boost/url/detail/impl/pct_encoded_view.ipp>
+#include <boost/url/detail/impl/query_schema.ipp>
+#include <boost/url/detail/impl/query_split.ipp>
 #include <boost/url/detail/impl/segments_encoded_iterator_impl.ipp>
+#include <boost/url/detail/impl/segments_index.ipp>
 #include <boost/url/detail/impl/segments_iterator_impl.ipp>
 #include <boost/url/detail/impl/url_impl.ipp>
 
+#include <boost/url/impl/alloc_stats.ipp>
 #include <boost/url/impl/authority_view.ipp>
+#include <boost/url/impl/base_resolver.ipp>
 #include <boost/url/impl/error.ipp>
 #include <boost/url/impl/ipv4_address.ipp>
 #include <boost/url/impl/ipv6_address.ipp>
 #include <boost/url/impl/params.ipp>
 #include <boost/url/impl/params_encoded.ipp>
 #include <boost/url/impl/params_encoded_view.ipp>
+#include <boost/url/impl/params_index.ipp>
 #include <boost/url/impl/params_view.ipp>
+#include <boost/url/impl/parse_stats.ipp>
 #include <boost/url/impl/pct_encoded_view.ipp>
 #include <boost/url/impl/pct_encoding.ipp>
 #include <boost/url/impl/query_param.ipp>
+#include <boost/url/impl/router.ipp>
 #include <boost/url/impl/scheme.ipp>
 #include <boost/url/impl/segments.ipp>
 #include <boost/url/impl/segments_encoded.ipp>
 #include <boost/url/impl/segments_encoded_view.ipp>
+#include <boost/url/impl/segments_index.ipp>
 #include <boost/url/impl/segments_view.ipp>
 #include <boost/url/impl/static_url.ipp>
 #include <boost/url/impl/url.ipp>
@@ -67,8 +83,8 @@ in a translation unit of the program.
 #include <boost/url/grammar/impl/delim_rule.ipp>
 #include <boost/url/grammar/impl/error.ipp>
 #include <boost/url/grammar/impl/literal_rule.ipp>
+#include <boost/url/grammar/impl/profile.ipp>
 
-#include <boost/url/grammar/detail/impl/copied_strings.ipp>
 #include <boost/url/grammar/detail/impl/recycled.ipp>
 
 #include <boost/url/rfc/impl/absolute_uri_rule.ipp>
@@ -224,7 +224,8 @@ private:
     void deallocate(char* s);
 
     BOOST_URL_DECL void clear_impl() noexcept override;
-    BOOST_URL_DECL void reserve_impl(std::size_t) override;
+    BOOST_URL_DECL void reserve_impl(std::size_t, op_t&) override;
+    BOOST_URL_DECL void cleanup(op_t&) override;
 };
 
 //----------------------------------------------------------
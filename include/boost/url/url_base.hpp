@@ -73,13 +73,18 @@ class BOOST_SYMBOL_VISIBLE
     friend class urls::params;
     friend class segments_encoded;
     friend class params_encoded;
+    friend class base_resolver;
+
+    struct op_t;
 
     url_base() noexcept = default;
     url_base(detail::url_impl const&) noexcept;
     explicit url_base(string_view);
     BOOST_URL_DECL void copy(url_view_base const&);
     BOOST_URL_DECL virtual void clear_impl() noexcept = 0;
-    BOOST_URL_DECL virtual void reserve_impl(std::size_t) = 0;
+    BOOST_URL_DECL virtual void reserve_impl(
+        std::size_t, op_t&) = 0;
+    BOOST_URL_DECL virtual void cleanup(op_t&) = 0;
 
 public:
     //--------------------------------------------
@@ -132,7 +137,8 @@ public:
     void
     reserve(std::size_t n)
     {
-        this->reserve_impl(n);
+        op_t op(*this);
+        this->reserve_impl(n, op);
     }
 
     //--------------------------------------------
@@ -142,7 +148,7 @@ public:
     //--------------------------------------------
 
 private:
-    void set_scheme_impl(string_view, urls::scheme);
+    void set_scheme_impl(string_view, urls::scheme, op_t&);
 public:
 
     /** Remove the scheme
@@ -250,7 +256,7 @@ public:
     //--------------------------------------------
 
 private:
-    char* set_user_impl(std::size_t n);
+    char* set_user_impl(std::size_t n, op_t& op);
 public:
 
     /** Set the user.
@@ -317,7 +323,7 @@ public:
         string_view s);
 
 private:
-    char* set_password_impl(std::size_t n);
+    char* set_password_impl(std::size_t n, op_t& op);
 public:
 
     /** Remove the password
@@ -398,7 +404,7 @@ public:
         string_view s);
 
 private:
-    char* set_userinfo_impl(std::size_t n);
+    char* set_userinfo_impl(std::size_t n, op_t& op);
 public:
 
     /** Remove the userinfo
@@ -506,7 +512,7 @@ public:
     //--------------------------------------------
 
 private:
-    char* set_host_impl(std::size_t n);
+    char* set_host_impl(std::size_t n, op_t& op);
 public:
 
     /** Set the host
@@ -688,7 +694,7 @@ public:
     set_encoded_host(string_view s);
 
 private:
-    char* set_port_impl(std::size_t n);
+    char* set_port_impl(std::size_t n, op_t& op);
 public:
 
     /** Remove the port
@@ -869,7 +875,8 @@ private:
         std::size_t i0,
         std::size_t i1,
         std::size_t n,
-        std::size_t nseg);
+        std::size_t nseg,
+        op_t& op);
 
     BOOST_URL_DECL
     void
@@ -879,6 +886,16 @@ private:
         detail::any_path_iter&& it0,
         detail::any_path_iter&& it1,
         int abs_hint = -1);
+
+    BOOST_URL_DECL
+    void
+    edit_segments(
+        std::size_t i0,
+        std::size_t i1,
+        detail::any_path_iter&& it0,
+        detail::any_path_iter&& it1,
+        op_t& op,
+        int abs_hint = -1);
 public:
 
     /** Set whether the path is absolute.
@@ -1058,7 +1075,8 @@ private:
         std::size_t i0,
         std::size_t i1,
         std::size_t n,
-        std::size_t nparam);
+        std::size_t nparam,
+        op_t& op);
 
     BOOST_URL_DECL
     void
@@ -1068,6 +1086,16 @@ private:
         detail::any_query_iter&& it0,
         detail::any_query_iter&& it1,
         bool set_hint = false);
+
+    BOOST_URL_DECL
+    void
+    edit_params(
+        std::size_t i0,
+        std::size_t i1,
+        detail::any_query_iter&& it0,
+        detail::any_query_iter&& it1,
+        op_t& op,
+        bool set_hint = false);
 public:
 
     /** Remove the query.
@@ -1209,7 +1237,7 @@ public:
     //--------------------------------------------
 
 private:
-    char* set_fragment_impl(std::size_t n);
+    char* set_fragment_impl(std::size_t n, op_t& op);
 public:
 
     /** Remove the fragment.
@@ -1313,7 +1341,10 @@ public:
     /** Normalize the URL components
 
         Applies Syntax-based normalization to
-        all components of the URL.
+        all components of the URL, and removes
+        the port when the scheme is known and
+        the port is empty or the default port
+        of the scheme.
 
         @par Exception Safety
         Strong guarantee.
@@ -1356,7 +1387,11 @@ public:
         Percent-encoding triplets are normalized
         to uppercase letters. Percent-encoded
         octets that correspond to unreserved
-        characters are decoded.
+        characters are decoded. When the scheme
+        is known and has a default port, an
+        empty port or the default port is
+        removed, so that "https://example.com:443"
+        becomes "https://example.com".
 
         @par Exception Safety
         Strong guarantee.
@@ -1365,7 +1400,11 @@ public:
         @par Specification
         @li <a href="https://datatracker.ietf.org/doc/html/rfc3986#section-6.2.2"
             >6.2.2 Syntax-Based Normalization (rfc3986)</a>
+        @li <a href="https://datatracker.ietf.org/doc/html/rfc3986#section-6.2.3"
+            >6.2.3 Scheme-Based Normalization (rfc3986)</a>
 
+        @see
+            @ref default_port.
     */
     BOOST_URL_DECL
     url_base&
@@ -1462,9 +1501,63 @@ private:
     //
     //--------------------------------------------
 
+    /*  A modification which may be given a
+        string that points into the url.
+
+        The new chars are measured before
+        anything is moved. If the string is in
+        the buffer and the buffer does not grow,
+        the new chars are written past the end
+        and the tail is moved into place after
+        the write. When they do not fit there,
+        the tail is moved into place first and
+        a string in the tail is read from where
+        it went, together with any view of it.
+        Any other string is copied past the new
+        end, and only when there is no room for
+        that either does the buffer grow. A
+        buffer replaced by reserve is kept until
+        the modification ends. So nothing is
+        allocated just to hold the string.
+    */
+    struct op_t
+    {
+        BOOST_URL_DECL
+        ~op_t();
+
+        BOOST_URL_DECL
+        explicit
+        op_t(
+            url_base&,
+            string_view* = nullptr,
+            pct_encoded_view* = nullptr) noexcept;
+
+        url_base& u;
+        string_view* s;
+
+        // decoded view of *s, if any
+        pct_encoded_view* v;
+
+        // buffer replaced by reserve
+        char* old = nullptr;
+
+        // chars written past the end to
+        // replace [pos, pos + n0) of the
+        // first end chars
+        char* tmp = nullptr;
+        std::size_t pos = 0;
+        std::size_t n0 = 0;
+        std::size_t n = 0;
+        std::size_t end = 0;
+    };
+
     void check_invariants() const noexcept;
+    char* splice_impl(std::size_t,
+        std::size_t, std::size_t, op_t&);
     char* resize_impl(int, std::size_t);
     char* resize_impl(int, int, std::size_t);
+    char* resize_impl(int, std::size_t, op_t&);
+    char* resize_impl(int, int, std::size_t, op_t&);
     char* shrink_impl(int, std::size_t);
     char* shrink_impl(int, int, std::size_t);
 
@@ -73,6 +73,11 @@ class BOOST_SYMBOL_VISIBLE
     friend class segments_view;
     friend class segments_encoded;
     friend class segments_encoded_view;
+    friend class base_resolver;
+    template<class>
+    friend class cidr_map;
+    template<class>
+    friend class host_router;
 
     struct shared_impl;
 
@@ -1800,7 +1805,9 @@ public:
 
         This function compares two URLs
         according to Syntax-Based comparison
-        algorithm.
+        algorithm. A port which is the
+        default port of the scheme compares
+        equal to no port.
 
         @par Exception Safety
         Throws nothing.
@@ -1808,6 +1815,8 @@ public:
         @par Specification
         @li <a href="https://datatracker.ietf.org/doc/html/rfc3986#section-6.2.2"
             >6.2.2 Syntax-Based Normalization (rfc3986)</a>
+        @li <a href="https://datatracker.ietf.org/doc/html/rfc3986#section-6.2.3"
+            >6.2.3 Scheme-Based Normalization (rfc3986)</a>
 
         @return -1 if `*this < other`, 0 if
             `this == other`, and 1 if `this > other`.
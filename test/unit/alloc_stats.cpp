@@ -0,0 +1,250 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/alloc_stats.hpp>
+
+#include <boost/url/static_url.hpp>
+#include <boost/url/url.hpp>
+#include <boost/url/grammar/recycled.hpp>
+#include "test_suite.hpp"
+#include <iterator>
+#include <string>
+
+namespace boost {
+namespace urls {
+
+class alloc_stats_test
+{
+public:
+    // The budgets of common edit
+    // sequences, when counting
+#ifdef BOOST_URL_ALLOC_STATS
+    void
+    testUrl()
+    {
+        // construction allocates once
+        {
+            reset_thread_alloc_stats();
+            url u("https://www.example.com/index.htm");
+            auto const st = thread_alloc_stats();
+            BOOST_TEST_EQ(st.allocations, 1u);
+            BOOST_TEST_EQ(st.growths, 1u);
+            BOOST_TEST_EQ(st.bytes, u.capacity() + 1);
+            BOOST_TEST_EQ(st.deallocations, 0u);
+        }
+
+        // edits within the capacity
+        // do not allocate
+        {
+            url u("https://www.example.com/index.htm");
+            u.reserve(256);
+            reset_thread_alloc_stats();
+            u.set_scheme("http");
+            u.set_encoded_host("example.org");
+            u.set_port(8080);
+            u.set_encoded_path("/a/b/c");
+            u.set_encoded_query("x=1&y=2");
+            u.set_encoded_fragment("top");
+            u.segments().push_back("d");
+            u.segments().insert(
+                u.segments().begin(), "z");
+            u.encoded_params().append("k", "v");
+            u.params().erase(std::next(
+                u.params().begin()));
+            u.remove_fragment();
+            u.normalize();
+            auto const st = thread_alloc_stats();
+            BOOST_TEST_EQ(st.allocations, 0u);
+            BOOST_TEST_EQ(st.bytes, 0u);
+            BOOST_TEST_EQ(st.deallocations, 0u);
+            BOOST_TEST_EQ(st.growths, 0u);
+            BOOST_TEST_GT(st.moved, 0u);
+            BOOST_TEST_EQ(u.string(),
+                "http://example.org:8080/z/a/b/c/d?x=1&k=v");
+        }
+
+        // growing replaces the buffer once
+        {
+            url u("http://x/");
+            reset_thread_alloc_stats();
+            u.set_encoded_path(
+                std::string(100, 'p'));
+            auto const st = thread_alloc_stats();
+            BOOST_TEST_EQ(st.allocations, 1u);
+            BOOST_TEST_EQ(st.deallocations, 1u);
+            BOOST_TEST_EQ(st.growths, 1u);
+        }
+
+        // an argument in the buffer is
+        // used in place, not copied
+        {
+            url u("http://example.com/path?q#f");
+            u.reserve(64);
+            reset_thread_alloc_stats();
+            u.set_encoded_fragment(
+                u.encoded_path());
+            auto const st = thread_alloc_stats();
+            BOOST_TEST_EQ(st.aliased, 1u);
+            BOOST_TEST_EQ(st.allocations, 0u);
+            BOOST_TEST_EQ(u.string(),
+                "http://example.com/path?q#/path");
+        }
+
+        // an aliased argument which grows
+        // the buffer keeps the old one
+        // until the operation is done
+        {
+            url u("http://example.com/path");
+            u.reserve(u.size());
+            reset_thread_alloc_stats();
+            u.set_encoded_query(
+                u.encoded_host_and_port());
+            auto const st = thread_alloc_stats();
+            BOOST_TEST_EQ(st.aliased, 1u);
+            BOOST_TEST_EQ(st.allocations, 1u);
+            BOOST_TEST_EQ(st.deallocations, 1u);
+            BOOST_TEST_EQ(u.string(),
+                "http://example.com/path?example.com");
+        }
+
+        // moves, copies and clears of a url
+        // with enough capacity
+        {
+            url u("http://example.com/path");
+            url v;
+            v.reserve(u.size());
+            reset_thread_alloc_stats();
+            v = u;
+            url w(std::move(u));
+            v.clear();
+            auto const st = thread_alloc_stats();
+            BOOST_TEST_EQ(st.allocations, 0u);
+            BOOST_TEST_EQ(st.deallocations, 0u);
+        }
+    }
+
+    void
+    testStaticUrl()
+    {
+        reset_thread_alloc_stats();
+        static_url<1024> u(
+            "https://www.example.com/index.htm");
+        u.set_encoded_query("x=1");
+        u.segments().push_back("a");
+        u.params().append("y", "2");
+        u.set_encoded_fragment(u.encoded_path());
+        auto st = thread_alloc_stats();
+        BOOST_TEST_EQ(st.allocations, 0u);
+        BOOST_TEST_EQ(st.growths, 0u);
+        BOOST_TEST_EQ(st.aliased, 1u);
+
+        // the result fits, but not the
+        // new chars past the end
+        {
+            static_url<36> w(
+                "http://x/aaaaaaaaaaaaaaaaaaaa?bbbbbb");
+            reset_thread_alloc_stats();
+            w.set_encoded_path(w.encoded_query());
+            w.set_user(w.query());
+            st = thread_alloc_stats();
+            BOOST_TEST_EQ(st.allocations, 0u);
+            BOOST_TEST_EQ(st.growths, 0u);
+            BOOST_TEST_EQ(st.aliased, 2u);
+            BOOST_TEST_EQ(w.string(),
+                "http://bbbbbb@x/bbbbbb?bbbbbb");
+        }
+
+        static_url<16> v;
+        BOOST_TEST_THROWS(
+            v.set_encoded_path(
+                std::string(32, 'p')),
+            std::exception);
+        st = thread_alloc_stats();
+        BOOST_TEST_EQ(st.allocations, 0u);
+        BOOST_TEST_EQ(st.growths, 1u);
+    }
+
+    void
+    testRecycled()
+    {
+        grammar::recycled<std::string> bin;
+        reset_thread_alloc_stats();
+        {
+            grammar::recycled_ptr<
+                std::string> p(bin);
+        }
+        auto st = thread_alloc_stats();
+        BOOST_TEST_EQ(st.recycled_allocations, 1u);
+        BOOST_TEST_GE(st.recycled_bytes,
+            sizeof(std::string));
+
+        // reused
+        reset_thread_alloc_stats();
+        {
+            grammar::recycled_ptr<
+                std::string> p(bin);
+        }
+        st = thread_alloc_stats();
+        BOOST_TEST_EQ(st.recycled_allocations, 0u);
+        BOOST_TEST_EQ(st.allocations, 0u);
+    }
+#else
+    // Without BOOST_URL_ALLOC_STATS
+    // nothing is counted
+    void
+    testUrl()
+    {
+        reset_thread_alloc_stats();
+        url u("https://www.example.com/index.htm");
+        u.set_encoded_path(std::string(100, 'p'));
+        u.set_encoded_fragment(u.encoded_path());
+        auto const st = thread_alloc_stats();
+        BOOST_TEST_EQ(st.allocations, 0u);
+        BOOST_TEST_EQ(st.bytes, 0u);
+        BOOST_TEST_EQ(st.deallocations, 0u);
+        BOOST_TEST_EQ(st.growths, 0u);
+        BOOST_TEST_EQ(st.moved, 0u);
+        BOOST_TEST_EQ(st.aliased, 0u);
+    }
+
+    void
+    testStaticUrl()
+    {
+    }
+
+    void
+    testRecycled()
+    {
+        grammar::recycled<std::string> bin;
+        reset_thread_alloc_stats();
+        {
+            grammar::recycled_ptr<
+                std::string> p(bin);
+        }
+        BOOST_TEST_EQ(thread_alloc_stats(
+            ).recycled_allocations, 0u);
+    }
+#endif
+
+    void
+    run()
+    {
+        testUrl();
+        testStaticUrl();
+        testRecycled();
+    }
+};
+
+TEST_SUITE(
+    alloc_stats_test,
+    "boost.url.alloc_stats");
+
+} // urls
+} // boost
@@ -12,7 +12,9 @@
 
 #include <boost/url/grammar/parse.hpp>
 #include "test_rule.hpp"
+#include <random>
 #include <sstream>
+#include <string>
 
 namespace boost {
 namespace urls {
@@ -343,6 +345,157 @@ public:
         }
     }
 
+    // same as parse_authority without userinfo
+    static
+    void
+    checkHostPort(string_view s)
+    {
+        auto r0 = parse_authority(s);
+        auto r1 = parse_host_port(s);
+        if( r0 &&
+            r0->has_userinfo())
+        {
+            BOOST_TEST(r1.has_error());
+            return;
+        }
+        if(! BOOST_TEST_EQ(
+                r0.has_value(), r1.has_value()))
+        {
+            BOOST_TEST_EQ(s, "");
+            return;
+        }
+        if(! r0)
+            return;
+        authority_view const& a0 = *r0;
+        authority_view const& a1 = *r1;
+        BOOST_TEST_EQ(a1.string(), s);
+        BOOST_TEST_EQ(a1.encoded_host_and_port(),
+            a0.encoded_host_and_port());
+        BOOST_TEST(a1.host_type() == a0.host_type());
+        BOOST_TEST_EQ(a1.encoded_host(), a0.encoded_host());
+        BOOST_TEST_EQ(a1.host(), a0.host());
+        BOOST_TEST_EQ(a1.has_port(), a0.has_port());
+        BOOST_TEST_EQ(a1.port(), a0.port());
+        BOOST_TEST_EQ(a1.port_number(), a0.port_number());
+        BOOST_TEST_EQ(a1.has_userinfo(), false);
+        if(a0.host_type() == host_type::ipv4)
+            BOOST_TEST_EQ(a1.ipv4_address(),
+                a0.ipv4_address());
+        if(a0.host_type() == host_type::ipv6)
+            BOOST_TEST_EQ(a1.ipv6_address(),
+                a0.ipv6_address());
+    }
+
+    void
+    testParseHostPort()
+    {
+        // javadoc
+        {
+            authority_view a = parse_host_port( "www.example.com:8080" ).value();
+
+            BOOST_TEST( a.host() == "www.example.com" );
+            BOOST_TEST( a.port_number() == 8080 );
+            BOOST_TEST( ! parse_host_port( "user@www.example.com" ) );
+        }
+
+        BOOST_TEST(! parse_host_port("user@example.com"));
+        BOOST_TEST(! parse_host_port("user:pass@example.com:80"));
+        BOOST_TEST(! parse_host_port("@example.com"));
+        BOOST_TEST(! parse_host_port("example.com/"));
+        BOOST_TEST(! parse_host_port("example.com:80/"));
+        BOOST_TEST(! parse_host_port("example.com:8x"));
+        BOOST_TEST(! parse_host_port("exa mple.com"));
+        BOOST_TEST(! parse_host_port("example%2"));
+        BOOST_TEST(! parse_host_port("example%zz.com"));
+        BOOST_TEST(! parse_host_port("[::1"));
+        BOOST_TEST(! parse_host_port("[::1]x"));
+        BOOST_TEST(! parse_host_port("1.2.3.4x"));
+
+        string_view const cases[] = {
+            "",
+            ":",
+            ":80",
+            "example.com",
+            "EXAMPLE.com:",
+            "example.com:443",
+            "example.com:65535",
+            "example.com:65536",
+            "example.com:99999999999",
+            "example.com:0080",
+            "ex%41mple.com",
+            "ex%41mple.com:8080",
+            "%41%42%43",
+            "a-b_c~d.e",
+            "a.very.long.host.name.with-many.labels.example.com:8443",
+            "0123456789abcdefghijklmnopqrstuvwxyz%2e0123456789:1",
+            "0123456789abcdefghijklmnop@qrstuvwxyz",
+            "0123456789abcdefghijklmnop!qrstuvwxyz",
+            "0123456789abcdefg\x80",
+            "1.2.3.4",
+            "1.2.3.4:80",
+            "255.255.255.255:65535",
+            "256.1.1.1",
+            "1.2.3",
+            "1.2.3.4.5",
+            "01.2.3.4",
+            "1.2.3.4.",
+            "1a.example.com",
+            "[::1]",
+            "[::1]:8080",
+            "[2001:db8::1]:443",
+            "[::ffff:1.2.3.4]:80",
+            "[v1.future]",
+            "[v1.future]:80",
+            "[]",
+            "user@host",
+            "u:p@[::1]:80",
+        };
+        for(auto s : cases)
+            checkHostPort(s);
+
+        // random strings near the grammar
+        std::mt19937 g(1);
+        string_view const cs =
+            "0123456789abcfxyzABXZ.-_~%:@[]/ !v";
+        std::string s;
+        for(int i = 0; i < 20000; ++i)
+        {
+            s.clear();
+            std::size_t const n = g() % 40;
+            for(std::size_t j = 0; j < n; ++j)
+                s.push_back(cs[g() % cs.size()]);
+            checkHostPort(s);
+        }
+
+        // generated hosts and ports
+        for(int i = 0; i < 2000; ++i)
+        {
+            s.clear();
+            switch(g() % 4)
+            {
+            case 0:
+                s = std::to_string(g() % 300) + "." +
+                    std::to_string(g() % 256) + "." +
+                    std::to_string(g() % 256) + "." +
+                    std::to_string(g() % 256);
+                break;
+            case 1:
+                s = "[2001:db8::" +
+                    std::to_string(g() % 10000) + "]";
+                break;
+            default:
+                for(std::size_t j = g() % 40; j; --j)
+                    s.push_back("abcxyz0189-._~"[g() % 14]);
+                if(g() % 4 == 0)
+                    s += "%4" + std::to_string(g() % 10);
+                break;
+            }
+            if(g() % 2)
+                s += ":" + std::to_string(g() % 70000);
+            checkHostPort(s);
+        }
+    }
+
     void
     run()
     {
@@ -363,6 +516,7 @@ public:
         testHost();
         testPort();
         testHostAndPort();
+        testParseHostPort();
     }
 };
 
@@ -0,0 +1,255 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/base_resolver.hpp>
+
+#include <boost/url/static_url.hpp>
+#include <boost/url/url.hpp>
+#include <boost/url/url_view.hpp>
+#include "test_suite.hpp"
+#include <new>
+#include <stdexcept>
+#include <string>
+
+namespace boost {
+namespace urls {
+
+class base_resolver_test
+{
+public:
+    // the tables must match a fresh parse
+    static
+    void
+    check_parts(
+        url_view_base const& u)
+    {
+        url_view v =
+            parse_uri_reference(u.string()).value();
+        BOOST_TEST_EQ(u.scheme_id(), v.scheme_id());
+        BOOST_TEST_EQ(u.encoded_userinfo(), v.encoded_userinfo());
+        BOOST_TEST_EQ(u.encoded_host(), v.encoded_host());
+        BOOST_TEST(u.host_type() == v.host_type());
+        BOOST_TEST_EQ(u.port(), v.port());
+        BOOST_TEST_EQ(u.port_number(), v.port_number());
+        BOOST_TEST_EQ(u.encoded_path(), v.encoded_path());
+        BOOST_TEST_EQ(u.encoded_query(), v.encoded_query());
+        BOOST_TEST_EQ(u.encoded_fragment(), v.encoded_fragment());
+        BOOST_TEST_EQ(u.encoded_segments().size(),
+            v.encoded_segments().size());
+        BOOST_TEST_EQ(u.encoded_params().size(),
+            v.encoded_params().size());
+        BOOST_TEST_EQ(u.path().size(), v.path().size());
+        BOOST_TEST_EQ(u.query().size(), v.query().size());
+        BOOST_TEST_EQ(u.fragment().size(), v.fragment().size());
+    }
+
+    static
+    void
+    check(
+        base_resolver const& br,
+        string_view ref,
+        string_view m)
+    {
+        url_view ur = parse_uri_reference(ref).value();
+        BOOST_TEST_LE(m.size(),
+            br.resolved_size(ur));
+        {
+            url u = parse_uri(
+                "z://y:x@p.q:69/x/f?q#f").value();
+            br.resolve(ur, u);
+            BOOST_TEST_EQ(u.string(), m);
+            BOOST_TEST_EQ(*(u.c_str() +
+                u.string().size()), '\0');
+            check_parts(u);
+        }
+        if(br.resolved_size(ur) > 1024)
+            return;
+        {
+            static_url<1024> u;
+            br.resolve(ur, u);
+            BOOST_TEST_EQ(u.string(), m);
+            check_parts(u);
+        }
+        {
+            char buf[1024];
+            url_view v = br.resolve(
+                ur, buf, sizeof(buf));
+            BOOST_TEST_EQ(v.string(), m);
+            BOOST_TEST_EQ(v.string().data(), buf);
+            check_parts(v);
+        }
+    }
+
+    void
+    testResolution()
+    {
+        {
+            base_resolver br(url_view(
+                "http://a/b/c/d;p?q"));
+            auto const check = [&br](
+                string_view r, string_view m)
+            {
+                base_resolver_test::check(br, r, m);
+            };
+
+            check("g:h"          , "g:h");
+            check("g"            , "http://a/b/c/g");
+            check("./g"          , "http://a/b/c/g");
+            check("g/"           , "http://a/b/c/g/");
+            check("/g"           , "http://a/g");
+            check("//g"          , "http://g");
+            check("?y"           , "http://a/b/c/d;p?y");
+            check("g?y"          , "http://a/b/c/g?y");
+            check("#s"           , "http://a/b/c/d;p?q#s");
+            check("g#s"          , "http://a/b/c/g#s");
+            check("g?y#s"        , "http://a/b/c/g?y#s");
+            check(";x"           , "http://a/b/c/;x");
+            check("g;x"          , "http://a/b/c/g;x");
+            check("g;x?y#s"      , "http://a/b/c/g;x?y#s");
+            check(""             , "http://a/b/c/d;p?q");
+            check("."            , "http://a/b/c/");
+            check("./"           , "http://a/b/c/");
+            check(".."           , "http://a/b/");
+            check("../"          , "http://a/b/");
+            check("../g"         , "http://a/b/g");
+            check("../.."        , "http://a/");
+            check("../../"       , "http://a/");
+            check("../../g"      , "http://a/g");
+            check("../../../g"   , "http://a/../g");
+            check("/./g"         , "http://a/g");
+            check("/../g"        , "http://a/../g");
+            check("g."           , "http://a/b/c/g.");
+            check("..g"          , "http://a/b/c/..g");
+            check("./../g"       , "http://a/b/g");
+            check("./g/."        , "http://a/b/c/g/");
+            check("g/../h"       , "http://a/b/c/h");
+            check("g;x=1/../y"   , "http://a/b/c/y");
+            check("g?y/../x"     , "http://a/b/c/g?y/../x");
+            check("g#s/../x"     , "http://a/b/c/g#s/../x");
+            check("/"            , "http://a/");
+            check("//u:p@g:80/h?a=1&b#f",
+                "http://u:p@g:80/h?a=1&b#f");
+            check("//[::1]:8/x"  , "http://[::1]:8/x");
+            check("?a&b&c"       , "http://a/b/c/d;p?a&b&c");
+            check("%41/%2e%2E/b%42",
+                "http://a/b/c/%41/%2e%2E/b%42");
+
+            std::string r;
+            for(int i = 0; i < 2000; ++i)
+                r += "x/./";
+            for(int i = 0; i < 2000; ++i)
+                r += "../";
+            r += "g";
+            check(r, "http://a/b/c/g");
+        }
+        {
+            // empty base path
+            base_resolver br(url_view(
+                "http://u:p@[::1]:81"));
+            check(br, "g", "http://u:p@[::1]:81/g");
+            check(br, "./g", "http://u:p@[::1]:81/g");
+            check(br, ".", "http://u:p@[::1]:81/");
+            check(br, "?q", "http://u:p@[::1]:81?q");
+            check(br, "#f", "http://u:p@[::1]:81#f");
+        }
+        {
+            // no authority
+            base_resolver br(url_view(
+                "mailto:a/b"));
+            check(br, "c", "mailto:a/c");
+            check(br, "..", "mailto:");
+            check(br, "../../c", "mailto:../c");
+            check(br, "./c:d", "mailto:a/c:d");
+            check(br, "/c", "mailto:/c");
+        }
+        {
+            // root base path
+            base_resolver br(url_view("x:/"));
+            check(br, "g", "x:/g");
+            check(br, "g/..", "x:/");
+            check(br, "//h", "x://h");
+        }
+        {
+            base_resolver br(url_view("x:"));
+            check(br, "g", "x:g");
+            check(br, "./g", "x:g");
+            check(br, "./", "x:");
+            check(br, "a:b", "a:b");
+        }
+    }
+
+    void
+    testMembers()
+    {
+        base_resolver br(url_view(
+            "http://www.example.com:8080/a/b/index.htm?text=none#h1"));
+        BOOST_TEST_EQ(br.base().string(),
+            "http://www.example.com:8080/a/b/index.htm?text=none#h1");
+        BOOST_TEST_EQ(br.encoded_origin(),
+            "http://www.example.com:8080");
+        BOOST_TEST_EQ(br.encoded_directory(),
+            "/a/b/");
+        BOOST_TEST_EQ(base_resolver(url_view(
+            "http://a")).encoded_directory(), "/");
+        BOOST_TEST_EQ(base_resolver(url_view(
+            "x:y")).encoded_directory(), "");
+
+        // exact size without dot segments
+        url_view r("c/d?q");
+        BOOST_TEST_EQ(br.resolved_size(r),
+            std::string(
+            "http://www.example.com:8080/a/b/c/d?q").size());
+
+        // not a base
+        BOOST_TEST_THROWS(base_resolver(
+            url_view("/a/b")), std::invalid_argument);
+
+        // buffer too small
+        {
+            char buf[8];
+            BOOST_TEST_THROWS(br.resolve(
+                r, buf, sizeof(buf)), std::length_error);
+        }
+
+        // capacity too small
+        {
+            static_url<8> u;
+            BOOST_TEST_THROWS(br.resolve(
+                r, u), std::bad_alloc);
+        }
+
+        // reuse one destination
+        {
+            url u;
+            br.resolve(url_view("x"), u);
+            BOOST_TEST_EQ(u.string(),
+                "http://www.example.com:8080/a/b/x");
+            br.resolve(url_view("//h"), u);
+            BOOST_TEST_EQ(u.string(), "http://h");
+            br.resolve(url_view("#f"), u);
+            BOOST_TEST_EQ(u.string(),
+                "http://www.example.com:8080/a/b/index.htm?text=none#f");
+        }
+    }
+
+    void
+    run()
+    {
+        testResolution();
+        testMembers();
+    }
+};
+
+TEST_SUITE(
+    base_resolver_test,
+    "boost.url.base_resolver");
+
+} // urls
+} // boost
@@ -0,0 +1,375 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/cidr_map.hpp>
+
+#include <boost/url/url_view.hpp>
+#include "test_suite.hpp"
+#include <array>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+class cidr_map_test
+{
+public:
+    // longest matching prefix,
+    // by comparing each of them
+    struct reference
+    {
+        struct prefix
+        {
+            std::array<unsigned char, 16> addr;
+            unsigned len;
+            int value;
+        };
+
+        std::vector<prefix> v4;
+        std::vector<prefix> v6;
+
+        static
+        bool
+        matches(
+            prefix const& p,
+            unsigned char const* addr)
+        {
+            for(unsigned i = 0; i < p.len; ++i)
+            {
+                unsigned const m =
+                    0x80u >> (i % 8);
+                if( (p.addr[i / 8] & m) !=
+                    (addr[i / 8] & m))
+                    return false;
+            }
+            return true;
+        }
+
+        static
+        int
+        find(
+            std::vector<prefix> const& v,
+            unsigned char const* addr)
+        {
+            prefix const* best = nullptr;
+            for(auto const& p : v)
+                if( matches(p, addr) &&
+                    (! best || p.len > best->len))
+                    best = &p;
+            return best ? best->value : -1;
+        }
+    };
+
+    void
+    testFind()
+    {
+        cidr_map<int> m;
+        BOOST_TEST(m.empty());
+        m.insert("10.0.0.0/8", 1);
+        m.insert("10.1.0.0/16", 2);
+        m.insert("10.1.2.0/23", 3);
+        m.insert("10.1.2.3", 4);
+        m.insert("192.168.0.0/16", 5);
+        m.insert("2001:db8::/32", 6);
+        m.insert("2001:db8:1::/48", 7);
+        m.insert("::1", 8);
+        m.insert("fc00::/7", 9);
+        BOOST_TEST_EQ(m.size(), 9u);
+        BOOST_TEST(! m.empty());
+
+        auto const find = [&m](
+            string_view s) -> int
+        {
+            url_view u = parse_uri_reference(s).value();
+            auto const v = m.find(u);
+            return v ? *v : -1;
+        };
+
+        // IPv4, longest first
+        BOOST_TEST_EQ(find("http://10.2.3.4/"), 1);
+        BOOST_TEST_EQ(find("http://10.1.200.1/"), 2);
+        BOOST_TEST_EQ(find("http://10.1.2.1/"), 3);
+        BOOST_TEST_EQ(find("http://10.1.3.255/"), 3);
+        BOOST_TEST_EQ(find("http://10.1.4.0/"), 2);
+        BOOST_TEST_EQ(find("http://10.1.2.3:80/"), 4);
+        BOOST_TEST_EQ(find("http://192.168.1.1/"), 5);
+        BOOST_TEST_EQ(find("http://11.0.0.0/"), -1);
+        BOOST_TEST_EQ(find("http://9.255.255.255/"), -1);
+
+        // IPv6
+        BOOST_TEST_EQ(find("http://[2001:db8::1]/"), 6);
+        BOOST_TEST_EQ(find("http://[2001:db8:1:2::]/"), 7);
+        BOOST_TEST_EQ(find("http://[2001:db9::]/"), -1);
+        BOOST_TEST_EQ(find("http://[::1]/"), 8);
+        BOOST_TEST_EQ(find("http://[0::0:1]/"), 8);
+        BOOST_TEST_EQ(find("http://[::2]/"), -1);
+        BOOST_TEST_EQ(find("http://[fd12::1]/"), 9);
+        BOOST_TEST_EQ(find("http://[fe00::1]/"), -1);
+
+        // IPv4-mapped
+        BOOST_TEST_EQ(find("http://[::ffff:10.1.2.3]/"), 4);
+        BOOST_TEST_EQ(find("http://[::ffff:a01:203]/"), 4);
+        BOOST_TEST_EQ(find("http://[::ffff:11.0.0.1]/"), -1);
+        BOOST_TEST_EQ(find("http://[::fffe:10.1.2.3]/"), -1);
+
+        // not an address
+        BOOST_TEST_EQ(find("http://example.com/"), -1);
+        BOOST_TEST_EQ(find("http://[v1.x]/"), -1);
+        BOOST_TEST_EQ(find("/path"), -1);
+        BOOST_TEST_EQ(find("http:///"), -1);
+
+        // authority
+        {
+            authority_view a =
+                parse_authority("user@10.1.2.3:80").value();
+            BOOST_TEST_EQ(*m.find(a), 4);
+            a = parse_authority("[2001:db8::]").value();
+            BOOST_TEST_EQ(*m.find(a), 6);
+        }
+
+        // addresses
+        BOOST_TEST_EQ(*m.find(ipv4_address("10.1.2.3")), 4);
+        BOOST_TEST_EQ(*m.find(ipv6_address("2001:db8:1::5")), 7);
+        BOOST_TEST(m.find(ipv4_address("1.2.3.4")) == nullptr);
+
+        // default routes
+        cidr_map<int> d;
+        d.insert("0.0.0.0/0", 1);
+        d.insert("::/0", 2);
+        d.insert("128.0.0.0/1", 3);
+        BOOST_TEST_EQ(*d.find(ipv4_address("1.2.3.4")), 1);
+        BOOST_TEST_EQ(*d.find(ipv4_address("200.0.0.1")), 3);
+        BOOST_TEST_EQ(*d.find(ipv6_address("1::")), 2);
+        BOOST_TEST_EQ(*d.find(ipv6_address("::ffff:1.2.3.4")), 1);
+
+        // shorter after longer
+        cidr_map<int> s;
+        s.insert("10.1.2.0/24", 1);
+        s.insert("10.1.0.0/16", 2);
+        s.insert("10.0.0.0/8", 3);
+        s.insert("10.1.2.128/25", 4);
+        BOOST_TEST_EQ(*s.find(ipv4_address("10.1.2.1")), 1);
+        BOOST_TEST_EQ(*s.find(ipv4_address("10.1.2.200")), 4);
+        BOOST_TEST_EQ(*s.find(ipv4_address("10.1.3.1")), 2);
+        BOOST_TEST_EQ(*s.find(ipv4_address("10.2.3.1")), 3);
+    }
+
+    void
+    testInsert()
+    {
+        cidr_map<int> m;
+        m.insert("10.0.0.0/8", 1);
+        BOOST_TEST_THROWS(m.insert("10.0.0.0/8", 2),
+            std::invalid_argument);
+        BOOST_TEST_THROWS(m.insert("10.0.0.1/8", 2),
+            std::invalid_argument);
+        BOOST_TEST_THROWS(m.insert("10.0.0.0/33", 2),
+            std::invalid_argument);
+        BOOST_TEST_THROWS(m.insert("10.0.0.0/08", 2),
+            std::invalid_argument);
+        BOOST_TEST_THROWS(m.insert("10.0.0.0/", 2),
+            std::invalid_argument);
+        BOOST_TEST_THROWS(m.insert("10.0.0/8", 2),
+            std::invalid_argument);
+        BOOST_TEST_THROWS(m.insert("10.0.0.0/8 ", 2),
+            std::invalid_argument);
+        BOOST_TEST_THROWS(m.insert("", 2),
+            std::invalid_argument);
+        BOOST_TEST_THROWS(m.insert("[::1]", 2),
+            std::invalid_argument);
+        BOOST_TEST_THROWS(m.insert("::1/129", 2),
+            std::invalid_argument);
+        BOOST_TEST_THROWS(m.insert("2001:db8::1/32", 2),
+            std::invalid_argument);
+        BOOST_TEST_THROWS(m.insert(
+            ipv4_address("10.0.0.0"), 33, 2),
+            std::invalid_argument);
+        BOOST_TEST_THROWS(m.insert(
+            ipv6_address("::1"), 64, 2),
+            std::invalid_argument);
+        m.insert("10.0.0.0/9", 2);
+        m.insert(ipv4_address("10.0.0.0"), 10, 3);
+        m.insert(ipv6_address("::"), 0, 4);
+        m.insert("::/128", 5);
+        BOOST_TEST_THROWS(m.insert("0::0", 6),
+            std::invalid_argument);
+        BOOST_TEST_EQ(m.size(), 5u);
+        BOOST_TEST_EQ(*m.find(ipv4_address("10.0.0.1")), 3);
+        BOOST_TEST_EQ(*m.find(ipv4_address("10.127.0.1")), 2);
+        BOOST_TEST_EQ(*m.find(ipv4_address("10.128.0.1")), 1);
+        BOOST_TEST_EQ(*m.find(ipv6_address("::")), 5);
+        BOOST_TEST_EQ(*m.find(ipv6_address("::2")), 4);
+    }
+
+    void
+    testInsertList()
+    {
+        cidr_map<bool> m;
+        BOOST_TEST_EQ(m.insert_list(
+            "0.0.0.0/0 ::/0", true), 2u);
+        BOOST_TEST_EQ(m.insert_list(
+            "# loopback\n"
+            "127.0.0.0/8, ::1\r\n"
+            "\t10.0.0.0/8#private\n"
+            "169.254.0.0/16 # link-local\n"
+            "fc00::/7", false), 5u);
+        BOOST_TEST_EQ(m.insert_list(
+            " # nothing\n", false), 0u);
+        BOOST_TEST_EQ(m.size(), 7u);
+        BOOST_TEST(*m.find(url_view("http://1.2.3.4")));
+        BOOST_TEST(! *m.find(url_view("http://127.0.0.1")));
+        BOOST_TEST(! *m.find(url_view("http://[::ffff:127.0.0.1]")));
+        BOOST_TEST(! *m.find(url_view("http://10.9.9.9")));
+        BOOST_TEST(! *m.find(url_view("http://[::1]")));
+        BOOST_TEST(! *m.find(url_view("http://[fdff::1]")));
+        BOOST_TEST(*m.find(url_view("http://[2001:db8::]")));
+
+        // unchanged on error
+        BOOST_TEST_THROWS(m.insert_list(
+            "1.0.0.0/8 2.0.0.0/8 x", false),
+            std::invalid_argument);
+        BOOST_TEST_THROWS(m.insert_list(
+            "1.0.0.0/8 10.0.0.0/8", false),
+            std::invalid_argument);
+        BOOST_TEST_THROWS(m.insert_list(
+            "1.0.0.0/8 1.0.0.0/8", false),
+            std::invalid_argument);
+        BOOST_TEST_EQ(m.size(), 7u);
+        BOOST_TEST(*m.find(ipv4_address("1.2.3.4")));
+        BOOST_TEST(*m.find(ipv4_address("2.2.3.4")));
+    }
+
+    void
+    testReference()
+    {
+        // random prefixes clustered in a
+        // few ranges, and random addresses
+        // near them
+        std::mt19937 g(42);
+        std::uniform_int_distribution<int> byte(0, 255);
+        unsigned char const first[] = {
+            0, 10, 127, 192, 255 };
+        auto const random_addr = [&](
+            unsigned char* addr, unsigned n)
+        {
+            for(unsigned i = 0; i < n; ++i)
+                addr[i] = static_cast<
+                    unsigned char>(byte(g));
+            addr[0] = first[g() % 5];
+            if(g() % 2)
+                addr[1] &= 0x0f;
+        };
+        auto const mask = [](
+            unsigned char* addr,
+            unsigned n,
+            unsigned len)
+        {
+            for(unsigned i = 0; i < n; ++i)
+            {
+                unsigned const keep =
+                    len >= 8 * i + 8 ? 8 :
+                    len > 8 * i ? len - 8 * i : 0;
+                addr[i] = static_cast<unsigned char>(
+                    addr[i] & ~(0xff >> keep));
+            }
+        };
+
+        cidr_map<int> m;
+        reference r;
+        int value = 0;
+        for(int k = 0; k < 3000; ++k)
+        {
+            reference::prefix p{};
+            bool const v6 = g() % 2;
+            unsigned const n = v6 ? 16 : 4;
+            random_addr(p.addr.data(), n);
+            p.len = static_cast<unsigned>(
+                g() % (8 * n + 1));
+            mask(p.addr.data(), n, p.len);
+            p.value = value;
+            auto& v = v6 ? r.v6 : r.v4;
+            bool dup = false;
+            for(auto const& q : v)
+                if( q.len == p.len &&
+                    q.addr == p.addr)
+                    dup = true;
+            if(v6)
+            {
+                ipv6_address::bytes_type b;
+                std::copy(p.addr.begin(),
+                    p.addr.end(), b.begin());
+                if(dup)
+                {
+                    BOOST_TEST_THROWS(m.insert(
+                        ipv6_address(b), p.len, value),
+                        std::invalid_argument);
+                    continue;
+                }
+                m.insert(ipv6_address(b), p.len, value);
+            }
+            else
+            {
+                std::string const s =
+                    std::to_string(p.addr[0]) + "." +
+                    std::to_string(p.addr[1]) + "." +
+                    std::to_string(p.addr[2]) + "." +
+                    std::to_string(p.addr[3]) + "/" +
+                    std::to_string(p.len);
+                if(dup)
+                {
+                    BOOST_TEST_THROWS(m.insert(s, value),
+                        std::invalid_argument);
+                    continue;
+                }
+                m.insert(s, value);
+            }
+            v.push_back(p);
+            ++value;
+        }
+        BOOST_TEST_EQ(m.size(),
+            r.v4.size() + r.v6.size());
+
+        for(int k = 0; k < 20000; ++k)
+        {
+            unsigned char a[16];
+            random_addr(a, 16);
+            ipv4_address::bytes_type b4;
+            std::copy(a, a + 4, b4.begin());
+            auto const v4 = m.find(ipv4_address(b4));
+            BOOST_TEST_EQ(v4 ? *v4 : -1,
+                reference::find(r.v4, a));
+
+            ipv6_address::bytes_type b6;
+            std::copy(a, a + 16, b6.begin());
+            auto const v6 = m.find(ipv6_address(b6));
+            BOOST_TEST_EQ(v6 ? *v6 : -1,
+                reference::find(r.v6, a));
+        }
+    }
+
+    void
+    run()
+    {
+        testFind();
+        testInsert();
+        testInsertList();
+        testReference();
+    }
+};
+
+TEST_SUITE(
+    cidr_map_test,
+    "boost.url.cidr_map");
+
+} // urls
+} // boost
@@ -0,0 +1,210 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/compiled_router.hpp>
+
+#include <boost/url/url_view.hpp>
+#include "test_suite.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+class compiled_router_test
+{
+public:
+    void
+    testMatch()
+    {
+        router<int> r;
+        r.insert("/", 0);
+        r.insert("/api/users", 1);
+        r.insert("/api/users/{id}", 2);
+        r.insert("/api/users/{id}/posts", 3);
+        r.insert("/api/users/me", 4);
+        r.insert("/api/users/{id}/posts/{post}", 5);
+        r.insert("/static/*", 6);
+        r.insert("/api/items/", 7);
+        r.insert("/caf%C3%A9", 8);
+        r.insert("/api/v1/a/b/c", 9);
+        r.insert("/api/v1/a/x", 10);
+        r.insert("/api/*", 11);
+        r.insert("/a%2Fb", 12);
+        compiled_router<int> const cr(r);
+        BOOST_TEST_EQ(cr.size(), 13u);
+        BOOST_TEST_GT(cr.states(), 1u);
+
+        auto const find = [&cr](
+            string_view s, route_match& m) -> int
+        {
+            url_view u = parse_uri_reference(s).value();
+            auto const v = cr.find(u.encoded_path(), m);
+            return v ? *v : -1;
+        };
+
+        route_match m;
+        BOOST_TEST_EQ(find("/", m), 0);
+        BOOST_TEST(m.empty());
+        BOOST_TEST_EQ(find("", m), 0);
+        BOOST_TEST_EQ(find("/api/users", m), 1);
+        BOOST_TEST_EQ(find("/api/users/42", m), 2);
+        BOOST_TEST_EQ(m.size(), 1u);
+        BOOST_TEST_EQ(m.name(0), "id");
+        BOOST_TEST_EQ(m.value(0), "42");
+        BOOST_TEST_EQ(find("/api/users/me", m), 4);
+        BOOST_TEST(m.empty());
+        BOOST_TEST_EQ(find("/api/users/me/posts", m), 3);
+        BOOST_TEST_EQ(m.at("id"), "me");
+        BOOST_TEST_EQ(find("/api/users/a%20b/posts/7", m), 5);
+        BOOST_TEST_EQ(m.at("id"), "a%20b");
+        BOOST_TEST_EQ(m.at("post"), "7");
+        BOOST_TEST_EQ(find("/static/css/site.css", m), 6);
+        BOOST_TEST_EQ(m.at("*"), "css/site.css");
+        BOOST_TEST_EQ(find("/static", m), 6);
+        BOOST_TEST_EQ(m.at("*"), "");
+        BOOST_TEST_EQ(find("/static/", m), 6);
+        BOOST_TEST_EQ(m.at("*"), "");
+        BOOST_TEST_EQ(find("/api/items/", m), 7);
+        BOOST_TEST_EQ(find("/api/items", m), 11);
+        BOOST_TEST_EQ(m.at("*"), "items");
+        BOOST_TEST_EQ(find("/api/users/", m), 11);
+        BOOST_TEST_EQ(find("/api/v1/a/b/c", m), 9);
+        BOOST_TEST_EQ(find("/api/v1/a/x", m), 10);
+        BOOST_TEST_EQ(find("/api/v1/a/b", m), 11);
+        BOOST_TEST_EQ(m.at("*"), "v1/a/b");
+        BOOST_TEST_EQ(find("/other", m), -1);
+        BOOST_TEST_EQ(find("/api", m), 11);
+
+        // escapes are compared decoded
+        BOOST_TEST_EQ(find("/caf%c3%a9", m), 8);
+        BOOST_TEST_EQ(find("/%61pi/users", m), 1);
+        BOOST_TEST_EQ(find("/api/user%73/me", m), 4);
+        BOOST_TEST_EQ(find("/api%2Fusers", m), -1);
+        BOOST_TEST_EQ(find("/a%2fb", m), 12);
+        BOOST_TEST_EQ(find("/a/b", m), -1);
+
+        // literals are case-sensitive
+        BOOST_TEST_EQ(find("/API/users", m), -1);
+
+        // prefixes of relative paths
+        BOOST_TEST_EQ(find("api/users", m), 1);
+        BOOST_TEST_EQ(find("./api/users", m), 1);
+
+        // no routes
+        router<int> r0;
+        compiled_router<int> cr0(r0);
+        BOOST_TEST(cr0.find("/", m) == nullptr);
+        BOOST_TEST(cr0.find("/a", m) == nullptr);
+    }
+
+    void
+    testReference()
+    {
+        // random routes over a small
+        // alphabet, checked against
+        // the radix tree router
+        std::uint32_t seed = 1;
+        auto const rnd = [&seed](std::uint32_t n)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            return (seed >> 8) % n;
+        };
+        char const* const lits[] = {
+            "a", "b", "ab", "", "%2F" };
+        char const* const targets[] = {
+            "a", "b", "ab", "", "%2F", "%2f",
+            "%61", "a%62", "A", "ba" };
+        char const* const names[] = {
+            "{x}", "{y}", "{z}", "{w}", "{v}" };
+
+        for(int round = 0; round < 40; ++round)
+        {
+            router<std::size_t> r;
+            std::vector<std::string> patterns;
+            for(int i = 0; i < 40; ++i)
+            {
+                std::string p;
+                auto const n = rnd(5);
+                for(std::uint32_t j = 0; j < n; ++j)
+                {
+                    p += '/';
+                    auto const k = rnd(10);
+                    if(k < 6)
+                        p += lits[rnd(5)];
+                    else if(k < 9)
+                        p += names[j];
+                    else
+                    {
+                        p += '*';
+                        break;
+                    }
+                }
+                try
+                {
+                    r.insert(p, patterns.size());
+                    patterns.push_back(p);
+                }
+                catch(std::invalid_argument const&)
+                {
+                }
+            }
+            compiled_router<std::size_t> const cr(r);
+            for(int i = 0; i < 200; ++i)
+            {
+                std::string t;
+                auto const n = rnd(6);
+                for(std::uint32_t j = 0; j < n; ++j)
+                {
+                    t += '/';
+                    t += targets[rnd(10)];
+                }
+                auto const path =
+                    parse_path(t).value();
+                route_match m0;
+                route_match m1;
+                auto const v0 = r.find(path, m0);
+                auto const v1 = cr.find(t, m1);
+                if(! v0)
+                {
+                    BOOST_TEST(v1 == nullptr);
+                    continue;
+                }
+                if(! BOOST_TEST(v1 != nullptr))
+                    continue;
+                BOOST_TEST_EQ(*v0, *v1);
+                if(! BOOST_TEST_EQ(m0.size(), m1.size()))
+                    continue;
+                for(std::size_t j = 0; j < m0.size(); ++j)
+                {
+                    BOOST_TEST_EQ(m0.name(j), m1.name(j));
+                    BOOST_TEST_EQ(m0.value(j), m1.value(j));
+                    BOOST_TEST(m0.value(j).data() ==
+                        m1.value(j).data());
+                }
+            }
+        }
+    }
+
+    void
+    run()
+    {
+        testMatch();
+        testReference();
+    }
+};
+
+TEST_SUITE(
+    compiled_router_test,
+    "boost.url.compiled_router");
+
+} // urls
+} // boost
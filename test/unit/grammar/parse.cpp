@@ -30,10 +30,41 @@ struct parse_test
             ref(dec_octet_rule)).has_value());
     }
 
+    void
+    testLocation()
+    {
+#ifndef BOOST_URL_NO_SOURCE_LOCATION
+        // a trial error which escapes
+        // the rule gets a location
+        {
+            string_view s = "x";
+#ifndef BOOST_URL_TRIAL_SOURCE_LOCATION
+            char const* it = s.data();
+            auto rv0 = parse(
+                it, s.data() + s.size(),
+                dec_octet_rule);
+            BOOST_TEST(rv0.has_error());
+            BOOST_TEST(! rv0.error().has_location());
+#endif
+            auto rv = parse(s, dec_octet_rule);
+            BOOST_TEST(rv.error() == error::mismatch);
+            BOOST_TEST(rv.error().has_location());
+        }
+
+        // leftover
+        {
+            auto rv = parse("255x", dec_octet_rule);
+            BOOST_TEST(rv.error() == error::leftover);
+            BOOST_TEST(rv.error().has_location());
+        }
+#endif
+    }
+
     void
     run()
     {
         testRef();
+        testLocation();
     }
 };
 
@@ -0,0 +1,156 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/grammar/profile.hpp>
+
+#include <boost/url/grammar/delim_rule.hpp>
+#include <boost/url/grammar/digit_chars.hpp>
+#include <boost/url/grammar/optional_rule.hpp>
+#include <boost/url/grammar/parse.hpp>
+#include <boost/url/grammar/token_rule.hpp>
+#include <boost/url/grammar/tuple_rule.hpp>
+#include <boost/url/grammar/variant_rule.hpp>
+
+#include "test_suite.hpp"
+#include <sstream>
+
+namespace boost {
+namespace urls {
+namespace grammar {
+
+namespace {
+
+// a rule of the program
+struct sign_rule_t
+{
+    using value_type = char;
+
+    result<value_type>
+    parse(
+        char const*& it,
+        char const* end) const noexcept
+    {
+        if( it == end ||
+            (*it != '-' && *it != '+'))
+            return error::mismatch;
+        return *it++;
+    }
+};
+
+constexpr sign_rule_t sign_rule{};
+
+// Return the child whose name
+// contains s, or null
+rule_stats const*
+find(
+    rule_stats const& st,
+    string_view s)
+{
+    for(auto const& c : st.children)
+        if(string_view(c.name).find(s) !=
+                string_view::npos)
+            return &c;
+    return nullptr;
+}
+
+} // (anon)
+
+struct profile_test
+{
+    void
+    run()
+    {
+        auto const r = tuple_rule(
+            optional_rule(sign_rule),
+            variant_rule(
+                delim_rule('x'),
+                token_rule(digit_chars)));
+
+        reset_thread_rule_profile();
+        BOOST_TEST(parse("-12", r).has_value());
+        BOOST_TEST(parse("x", r).has_value());
+        BOOST_TEST(parse("?", r).has_error());
+        auto const st = thread_rule_profile();
+        BOOST_TEST(st.name.empty());
+
+#ifdef BOOST_URL_GRAMMAR_PROFILE
+        BOOST_TEST_EQ(st.children.size(), 1u);
+        auto const t = find(st, "sequence_rule");
+        if(! BOOST_TEST(t))
+            return;
+        BOOST_TEST_EQ(t->calls, 3u);
+        BOOST_TEST_EQ(t->failures, 1u);
+        BOOST_TEST_EQ(t->bytes, 4u);
+        BOOST_TEST_EQ(t->children.size(), 2u);
+
+        // the sign is present once
+        auto const o = find(*t, "optional_rule");
+        if(! BOOST_TEST(o))
+            return;
+        BOOST_TEST_EQ(o->calls, 3u);
+        BOOST_TEST_EQ(o->failures, 0u);
+        BOOST_TEST_EQ(o->bytes, 1u);
+        auto const s = find(*o, "sign_rule_t");
+        if(! BOOST_TEST(s))
+            return;
+        BOOST_TEST_EQ(s->calls, 3u);
+        BOOST_TEST_EQ(s->failures, 2u);
+        BOOST_TEST_EQ(s->backtracks, 2u);
+        BOOST_TEST_EQ(s->bytes, 1u);
+
+        // "12" tries 'x' first
+        auto const v = find(*t, "variant_rule");
+        if(! BOOST_TEST(v))
+            return;
+        BOOST_TEST_EQ(v->calls, 3u);
+        BOOST_TEST_EQ(v->failures, 1u);
+        BOOST_TEST_EQ(v->bytes, 3u);
+        auto const d = find(*v, "delim_rule");
+        auto const k = find(*v, "token_rule");
+        if(! BOOST_TEST(d && k))
+            return;
+        BOOST_TEST_EQ(d->calls, 3u);
+        BOOST_TEST_EQ(d->failures, 2u);
+        BOOST_TEST_EQ(d->backtracks, 2u);
+        BOOST_TEST_EQ(k->calls, 2u);
+        BOOST_TEST_EQ(k->failures, 1u);
+        BOOST_TEST_EQ(k->backtracks, 1u);
+        BOOST_TEST_EQ(k->bytes, 2u);
+        BOOST_TEST_GE(t->nanoseconds, v->nanoseconds);
+
+        // the report
+        std::stringstream ss;
+        write_rule_profile(ss, st);
+        auto const out = ss.str();
+        BOOST_TEST(out.find(
+            "sequence_rule_t<...>") != std::string::npos);
+        BOOST_TEST(out.find(
+            "sign_rule_t\n") != std::string::npos);
+        BOOST_TEST(out.find(
+            "boost::urls::") == std::string::npos);
+
+        reset_thread_rule_profile();
+        BOOST_TEST(thread_rule_profile(
+            ).children.empty());
+#else
+        // nothing is recorded
+        BOOST_TEST(st.children.empty());
+        BOOST_TEST(! find(st, "sequence_rule"));
+#endif
+    }
+};
+
+TEST_SUITE(
+    profile_test,
+    "boost.url.grammar.profile");
+
+} // grammar
+} // urls
+} // boost
@@ -11,7 +11,10 @@
 #include <boost/url/grammar/recycled.hpp>
 
 #include "test_suite.hpp"
+#include <memory>
 #include <string>
+#include <thread>
+#include <vector>
 
 namespace boost {
 namespace urls {
@@ -24,6 +27,108 @@ struct recycled_test
     {
     }
 
+    void
+    testStats()
+    {
+        // a bin without a cache
+        {
+            recycled<std::string> bin;
+            {
+                recycled_ptr<std::string> p(bin);
+                recycled_ptr<std::string> q(bin);
+            }
+            {
+                recycled_ptr<std::string> p(bin);
+            }
+            auto const st = bin.stats();
+            BOOST_TEST_EQ(st.misses, 2u);
+            BOOST_TEST_EQ(st.hits, 1u);
+            BOOST_TEST_EQ(st.cross_thread_frees, 0u);
+
+            // acquired here, released
+            // by another thread
+            std::unique_ptr<recycled_ptr<
+                std::string>> p(new recycled_ptr<
+                    std::string>(bin));
+            std::thread([&p]
+            {
+                p.reset();
+            }).join();
+            BOOST_TEST_EQ(
+                bin.stats().cross_thread_frees, 1u);
+        }
+
+        // the default bin, whose counters
+        // are added when a thread exits
+        {
+            using B = recycled<std::u32string>;
+            auto const st0 =
+                B::default_bin().stats();
+            std::thread([]
+            {
+                for(int i = 0; i < 100; ++i)
+                    recycled_ptr<std::u32string> p;
+            }).join();
+            auto const st1 =
+                B::default_bin().stats();
+            BOOST_TEST_EQ(
+                st1.hits + st1.misses,
+                st0.hits + st0.misses + 100);
+            BOOST_TEST_GE(st1.hits, st0.hits + 99);
+        }
+    }
+
+    void
+    testThreads()
+    {
+        // Each thread holds more instances
+        // than a cache, so batches go back
+        // and forth, and no instance may be
+        // held by two threads at once.
+        auto const run = [](
+            recycled<std::string>* bin)
+        {
+            std::vector<std::thread> v;
+            std::vector<char> ok(8, 1);
+            for(std::size_t t = 0; t < 8; ++t)
+                v.emplace_back([bin, t, &ok]
+                {
+                    std::string const s(
+                        40, static_cast<char>(
+                            'a' + t));
+                    using P = recycled_ptr<
+                        std::string>;
+                    std::vector<std::unique_ptr<P>> ps;
+                    for(int i = 0; i < 200; ++i)
+                    {
+                        for(int j = 0; j < 40; ++j)
+                        {
+                            ps.emplace_back(bin ?
+                                new P(*bin) : new P);
+                            *ps.back()->get() = s;
+                        }
+                        for(auto const& p : ps)
+                            if(**p != s)
+                                ok[t] = 0;
+                        ps.clear();
+                    }
+                });
+            for(auto& th : v)
+                th.join();
+            for(char b : ok)
+                BOOST_TEST(b);
+        };
+        {
+            recycled<std::string> bin;
+            run(&bin);
+            auto const st = bin.stats();
+            BOOST_TEST_EQ(
+                st.hits + st.misses,
+                8u * 200 * 40);
+        }
+        run(nullptr);
+    }
+
     void
     run()
     {
@@ -37,6 +142,9 @@ struct recycled_test
             BOOST_TEST(sp->capacity() >= 1000);
         }
 
+        testStats();
+        testThreads();
+
         // coverage
         {
             detail::recycled_add_impl(1);
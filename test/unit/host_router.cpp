@@ -0,0 +1,171 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/host_router.hpp>
+
+#include <boost/url/router.hpp>
+#include <boost/url/url_view.hpp>
+#include "test_suite.hpp"
+#include <stdexcept>
+#include <string>
+
+namespace boost {
+namespace urls {
+
+class host_router_test
+{
+public:
+    void
+    testFind()
+    {
+        host_router<int> r;
+        r.insert("www.example.com", 1);
+        r.insert("*.example.com", 2);
+        r.insert("*.api.example.com", 3);
+        r.insert("127.0.0.1", 4);
+        r.insert("[::1]", 5);
+        r.insert("[v1.Future]", 6);
+        r.insert("ex%41mple.org", 7);
+        BOOST_TEST_EQ(r.size(), 7u);
+
+        auto const find = [&r](
+            string_view s) -> int
+        {
+            url_view u = parse_uri_reference(s).value();
+            auto const v = r.find(u);
+            return v ? *v : -1;
+        };
+
+        // exact, case-insensitive
+        BOOST_TEST_EQ(find("http://www.example.com/"), 1);
+        BOOST_TEST_EQ(find("http://WWW.Example.COM/"), 1);
+        BOOST_TEST_EQ(find("http://www.ex%61mple.com/"), 1);
+        BOOST_TEST_EQ(find("http://www.ex%41mple.com/"), 1);
+        BOOST_TEST_EQ(find("http://example.org"), 7);
+        BOOST_TEST_EQ(find("http://EXAMPLE.org"), 7);
+
+        // suffixes, longest first
+        BOOST_TEST_EQ(find("http://a.example.com"), 2);
+        BOOST_TEST_EQ(find("http://a.b.example.com"), 2);
+        BOOST_TEST_EQ(find("http://API.example.com"), 2);
+        BOOST_TEST_EQ(find("http://v1.api.example.com"), 3);
+        BOOST_TEST_EQ(find("http://x.v1.API.example.com"), 3);
+        BOOST_TEST_EQ(find("http://a%2Eexample.com"), 2);
+        BOOST_TEST_EQ(find("http://example.com"), -1);
+        BOOST_TEST_EQ(find("http://aexample.com"), -1);
+
+        // addresses
+        BOOST_TEST_EQ(find("http://127.0.0.1:8080/"), 4);
+        BOOST_TEST_EQ(find("http://127.0.0.2/"), -1);
+        BOOST_TEST_EQ(find("http://[::1]/"), 5);
+        BOOST_TEST_EQ(find("http://[0:0::0:1]/"), 5);
+        BOOST_TEST_EQ(find("http://[::2]/"), -1);
+        BOOST_TEST_EQ(find("http://[v1.FUTURE]/"), 6);
+
+        // no host
+        BOOST_TEST_EQ(find("/path"), -1);
+        BOOST_TEST_EQ(find("file:///path"), -1);
+        BOOST_TEST_EQ(find("http://other.org"), -1);
+
+        // catch-all
+        r.insert("*", 0);
+        BOOST_TEST_EQ(find("http://other.org"), 0);
+        BOOST_TEST_EQ(find("http://127.0.0.2/"), 0);
+        BOOST_TEST_EQ(find("http://www.example.com/"), 1);
+        BOOST_TEST_EQ(find("/path"), -1);
+
+        // authority
+        {
+            authority_view a =
+                parse_authority("user@WWW.example.com:80").value();
+            BOOST_TEST_EQ(*r.find(a), 1);
+            a = parse_authority("10.0.0.1").value();
+            BOOST_TEST_EQ(*r.find(a), 0);
+        }
+
+        // many routes
+        host_router<int> r2;
+        for(int i = 0; i < 200; ++i)
+            r2.insert("h" + std::to_string(i) + ".test", i);
+        for(int i = 0; i < 200; ++i)
+        {
+            std::string const s = "http://H" +
+                std::to_string(i) + ".test";
+            auto const v = r2.find(url_view(s));
+            if(BOOST_TEST(v != nullptr))
+                BOOST_TEST_EQ(*v, i);
+        }
+    }
+
+    void
+    testInsert()
+    {
+        host_router<int> r;
+        r.insert("example.com", 1);
+        BOOST_TEST_THROWS(r.insert("EXAMPLE.com", 2),
+            std::invalid_argument);
+        BOOST_TEST_THROWS(r.insert("exampl%65.com", 2),
+            std::invalid_argument);
+        BOOST_TEST_THROWS(r.insert("", 2),
+            std::invalid_argument);
+        BOOST_TEST_THROWS(r.insert("a b", 2),
+            std::invalid_argument);
+        BOOST_TEST_THROWS(r.insert("*.127.0.0.1", 2),
+            std::invalid_argument);
+        BOOST_TEST_THROWS(r.insert("[::1", 2),
+            std::invalid_argument);
+        r.insert("*", 2);
+        BOOST_TEST_THROWS(r.insert("*", 3),
+            std::invalid_argument);
+        r.insert("*.example.com", 3);
+        BOOST_TEST_THROWS(r.insert("*.Example.com", 4),
+            std::invalid_argument);
+        r.insert("1.2.3.4", 4);
+        BOOST_TEST_THROWS(r.insert("1.2.3.4", 5),
+            std::invalid_argument);
+        BOOST_TEST_EQ(r.size(), 4u);
+    }
+
+    void
+    testDelegate()
+    {
+        host_router<router<int>> hr;
+        router<int> api;
+        api.insert("/users/{id}", 1);
+        hr.insert("api.example.com", api);
+        router<int> www;
+        www.insert("/*", 2);
+        hr.insert("*.example.com", www);
+
+        url_view u("https://API.example.com/users/42");
+        route_match m;
+        auto const r = hr.find(u);
+        if(! BOOST_TEST(r != nullptr))
+            return;
+        auto const v = r->find(u.encoded_segments(), m);
+        BOOST_TEST(v && *v == 1);
+        BOOST_TEST_EQ(m.at("id"), "42");
+    }
+
+    void
+    run()
+    {
+        testFind();
+        testInsert();
+        testDelegate();
+    }
+};
+
+TEST_SUITE(
+    host_router_test,
+    "boost.url.host_router");
+
+} // urls
+} // boost
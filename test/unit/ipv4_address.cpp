@@ -12,6 +12,7 @@
 
 #include "test_suite.hpp"
 #include <sstream>
+#include <string>
 
 namespace boost {
 namespace urls {
@@ -184,6 +185,28 @@ public:
             ss << ipv4_address(0x01020304);
             BOOST_TEST_EQ(ss.str(), "1.2.3.4");
         }
+
+        // to_string, each octet value
+        for(unsigned i = 0; i < 256; ++i)
+        {
+            std::string const d = std::to_string(i);
+            BOOST_TEST_EQ(ipv4_address(
+                (i << 24) | (i << 16) | (i << 8) | i
+                    ).to_string(),
+                d + "." + d + "." + d + "." + d);
+            BOOST_TEST_EQ(ipv4_address(
+                0x01020300 | i).to_string(),
+                "1.2.3." + d);
+            BOOST_TEST_EQ(ipv4_address(
+                i << 24).to_string(),
+                d + ".0.0.0");
+        }
+        {
+            ipv4_address const a(0xffffffff);
+            char buf[ipv4_address::max_str_len];
+            BOOST_TEST_EQ(a.to_buffer(buf,
+                sizeof(buf)), "255.255.255.255");
+        }
     }
 
     void
@@ -235,11 +258,55 @@ public:
         check("255.255.255.255", 0xffffffff);
     }
 
+    void
+    testBatch()
+    {
+        string_view const src[] = {
+            "10.0.0.1",
+            "10.0.0.256",
+            "",
+            "255.255.255.255",
+            "1.2.3.4 ",
+            "01.2.3.4",
+            "192.168.100.105" };
+        ipv4_address dest[7];
+        bool valid[7];
+        BOOST_TEST_EQ(parse_ipv4_batch(
+            src, 7, dest, valid), 3u);
+        BOOST_TEST(valid[0]);
+        BOOST_TEST(! valid[1]);
+        BOOST_TEST(! valid[2]);
+        BOOST_TEST(valid[3]);
+        BOOST_TEST(! valid[4]);
+        BOOST_TEST(! valid[5]);
+        BOOST_TEST(valid[6]);
+        BOOST_TEST_EQ(dest[0].to_uint(), 0x0a000001u);
+        BOOST_TEST(dest[1].is_unspecified());
+        BOOST_TEST_EQ(dest[3].to_uint(), 0xffffffffu);
+        BOOST_TEST_EQ(dest[6].to_string(), "192.168.100.105");
+
+        // same as parse_ipv4_address
+        for(std::size_t i = 0; i < 7; ++i)
+        {
+            auto rv = parse_ipv4_address(src[i]);
+            BOOST_TEST_EQ(rv.has_value(), valid[i]);
+            if(rv)
+                BOOST_TEST_EQ(*rv, dest[i]);
+        }
+
+        // without valid
+        BOOST_TEST_EQ(parse_ipv4_batch(
+            src, 2, dest), 1u);
+        BOOST_TEST_EQ(parse_ipv4_batch(
+            src, 0, dest), 0u);
+    }
+
     void
     run()
     {
         testMembers();
         testParse();
+        testBatch();
     }
 };
 
@@ -13,6 +13,7 @@
 #include <boost/url/ipv4_address.hpp>
 #include "test_suite.hpp"
 #include <sstream>
+#include <string>
 
 namespace boost {
 namespace urls {
@@ -402,12 +403,166 @@ public:
                 "::ffff:127.0.0.1");
     }
 
+    // Print as the formatter did, one
+    // nibble at a time
+    static
+    std::string
+    print_ref(ipv6_address const& a)
+    {
+        auto const addr = a.to_bytes();
+        auto const count_zeroes =
+        []( unsigned char const* first,
+            unsigned char const* const last)
+        {
+            std::size_t n = 0;
+            while(first != last)
+            {
+                if( first[0] != 0 ||
+                    first[1] != 0)
+                    break;
+                n += 2;
+                first += 2;
+            }
+            return n;
+        };
+        auto const print_hex =
+        []( std::string& dest,
+            unsigned short v)
+        {
+            char const* const dig =
+                "0123456789abcdef";
+            if(v >= 0x1000)
+                dest.push_back(dig[v >> 12]);
+            if(v >= 0x100)
+                dest.push_back(dig[(v >> 8) & 0xf]);
+            if(v >= 0x10)
+                dest.push_back(dig[(v >> 4) & 0xf]);
+            dest.push_back(dig[v & 0xf]);
+        };
+        std::string dest;
+        std::size_t best_len = 0;
+        int best_pos = -1;
+        auto it = addr.data();
+        auto const v4 = a.is_v4_mapped();
+        auto const end = v4 ?
+            (it + addr.size() - 4)
+            : it + addr.size();
+        while(it != end)
+        {
+            auto n = count_zeroes(it, end);
+            if(n == 0)
+            {
+                it += 2;
+                continue;
+            }
+            if(n > best_len)
+            {
+                best_pos = static_cast<
+                    int>(it - addr.data());
+                best_len = n;
+            }
+            it += n;
+        }
+        it = addr.data();
+        if(best_pos != 0)
+        {
+            print_hex(dest, static_cast<
+                unsigned short>((it[0] * 256U) + it[1]));
+            it += 2;
+        }
+        else
+        {
+            dest.push_back(':');
+            it += best_len;
+            if(it == end)
+                dest.push_back(':');
+        }
+        while(it != end)
+        {
+            dest.push_back(':');
+            if(it - addr.data() == best_pos)
+            {
+                it += best_len;
+                if(it == end)
+                    dest.push_back(':');
+                continue;
+            }
+            print_hex(dest, static_cast<
+                unsigned short>((it[0] * 256U) + it[1]));
+            it += 2;
+        }
+        if(v4)
+        {
+            ipv4_address::bytes_type b = {{
+                it[0], it[1], it[2], it[3] }};
+            dest.push_back(':');
+            dest += ipv4_address(b).to_string();
+        }
+        return dest;
+    }
+
+    void
+    testPrint()
+    {
+        auto const check = [](
+            ipv6_address const& a)
+        {
+            auto const s = a.to_string();
+            BOOST_TEST_EQ(s, print_ref(a));
+            BOOST_TEST_EQ(ipv6_address(s), a);
+        };
+
+        // each pattern of zero words, with
+        // words of every digit count
+        std::uint32_t seed = 1;
+        for(unsigned z = 0; z < 256; ++z)
+        {
+            for(int k = 0; k < 20; ++k)
+            {
+                ipv6_address::bytes_type b;
+                for(int i = 0; i < 8; ++i)
+                {
+                    seed = seed * 1664525u + 1013904223u;
+                    unsigned v = (seed >> 8) & 0xffff;
+                    v >>= 4 * (i + k) % 16;
+                    if((z >> i) & 1)
+                        v = 0;
+                    else if(v == 0)
+                        v = 1;
+                    b[2 * i] = static_cast<
+                        unsigned char>(v >> 8);
+                    b[2 * i + 1] = static_cast<
+                        unsigned char>(v & 0xff);
+                }
+                check(ipv6_address(b));
+            }
+        }
+
+        // IPv4-mapped
+        for(int k = 0; k < 1000; ++k)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            check(ipv6_address(ipv4_address(seed)));
+        }
+        check(ipv6_address(
+            ipv4_address(0xffffffff)));
+
+        // longest
+        char buf[ipv6_address::max_str_len];
+        ipv6_address::bytes_type b;
+        b.fill(0xff);
+        BOOST_TEST_EQ(ipv6_address(b).to_buffer(
+            buf, sizeof(buf)),
+            "ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff");
+    }
+
     void
     run()
     {
         testMembers();
         testIO();
         testIpv4();
+        testPrint();
     }
 };
 
@@ -188,6 +188,25 @@ public:
             BOOST_TEST(p.contains("f"));
             BOOST_TEST(! p.contains("g"));
         }
+
+        // keys with and without escapes,
+        // across the vector block size
+        {
+            url_view u = parse_uri_reference(
+                "/?a+b=1&a%20b=2&a%2Bb=3"
+                "&abcdefghijklmnopq=5&abcdefghijklmnop%71=6"
+                "&ab").value();
+            T p = u.encoded_params();
+            BOOST_TEST_EQ(p.count("a+b"), 2u);
+            BOOST_TEST_EQ(p.count("a%2bb"), 2u);
+            BOOST_TEST_EQ(p.count("a b"), 1u);
+            BOOST_TEST_EQ(p.count("a%20b"), 1u);
+            BOOST_TEST_EQ(p.count("abcdefghijklmnopq"), 2u);
+            BOOST_TEST_EQ(p.count("abcdefghijklmnop%71"), 2u);
+            BOOST_TEST_EQ(p.count("ab"), 1u);
+            BOOST_TEST_EQ(p.count("%61%62"), 1u);
+            BOOST_TEST_EQ(p.count("a"), 0u);
+        }
     }
 
     void
@@ -303,6 +322,19 @@ public:
         check( "u&k", { {"u"}, {"k"} });
         check( "u&k=", { {"u"}, {"k",""} });
         check( "u&k=v", { {"u"}, {"k","v"} });
+
+        // delimiters across 16-byte blocks
+        check( "key_one=value_one&key_two=value_two",
+            { {"key_one","value_one"}, {"key_two","value_two"} });
+        check( "0123456789abcde&0123456789abcdef=",
+            { {"0123456789abcde"}, {"0123456789abcdef",""} });
+        check( "0123456789abcdef0123456789abcdef&x==1",
+            { {"0123456789abcdef0123456789abcdef"}, {"x","=1"} });
+        check( "k=0123456789abcdef=0123456789abcdef=&&",
+            { {"k","0123456789abcdef=0123456789abcdef="}, {}, {} });
+        check( "a=b=c&&&&&&&&&&&&&&&&d=e&f",
+            { {"a","b=c"}, {}, {}, {}, {}, {}, {}, {}, {},
+              {}, {}, {}, {}, {}, {}, {}, {"d","e"}, {"f"} });
     }
 
     void
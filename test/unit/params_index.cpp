@@ -0,0 +1,206 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/params_index.hpp>
+
+#include <boost/url/url_view.hpp>
+#include "test_suite.hpp"
+#include <stdexcept>
+#include <string>
+
+namespace boost {
+namespace urls {
+
+class params_index_test
+{
+public:
+    // must agree with the linear lookups
+    static
+    void
+    check(
+        params_view ps,
+        string_view key)
+    {
+        alignas(std::size_t) char buf[
+            params_index::storage_size(128)];
+        params_index idx(ps, buf, sizeof(buf));
+        BOOST_TEST_EQ(idx.count(key), ps.count(key));
+        BOOST_TEST(idx.find(key) == ps.find(key));
+        BOOST_TEST_EQ(idx.contains(key), ps.contains(key));
+        auto const h = params_index::hash(key);
+        BOOST_TEST_EQ(idx.count(key, h), ps.count(key));
+        BOOST_TEST(idx.find(key, h) == ps.find(key));
+        BOOST_TEST_EQ(idx.contains(key, h), ps.contains(key));
+        auto r = idx.equal_range(key);
+        auto it = ps.find(key);
+        for(; r.first != r.second; ++r.first)
+        {
+            BOOST_TEST(r.first.base() == it);
+            ++it;
+            it = ps.find(it, key);
+        }
+        BOOST_TEST(it == ps.end());
+        if(ps.count(key) > 0)
+        {
+            pct_encoded_view v;
+            bool found = true;
+            try
+            {
+                v = ps.at(key);
+            }
+            catch(std::out_of_range const&)
+            {
+                found = false;
+            }
+            if(found)
+                BOOST_TEST_EQ(idx.at(key), v);
+            else
+                BOOST_TEST_THROWS(idx.at(key),
+                    std::out_of_range);
+        }
+    }
+
+    static
+    void
+    check(
+        params_encoded_view ps,
+        string_view key)
+    {
+        alignas(std::size_t) char buf[
+            params_encoded_index::storage_size(128)];
+        params_encoded_index idx(ps, buf, sizeof(buf));
+        BOOST_TEST_EQ(idx.count(key), ps.count(key));
+        BOOST_TEST(idx.find(key) == ps.find(key));
+        BOOST_TEST_EQ(idx.contains(key), ps.contains(key));
+        auto const h = params_encoded_index::hash(key);
+        BOOST_TEST_EQ(idx.count(key, h), ps.count(key));
+        BOOST_TEST(idx.find(key, h) == ps.find(key));
+        auto r = idx.equal_range(key, h);
+        auto it = ps.find(key);
+        for(; r.first != r.second; ++r.first)
+        {
+            BOOST_TEST(r.first.base() == it);
+            BOOST_TEST_EQ((*r.first).key, (*it).key);
+            ++it;
+            it = ps.find(it, key);
+        }
+        BOOST_TEST(it == ps.end());
+    }
+
+    void
+    testLookup()
+    {
+        string_view const queries[] = {
+            "",
+            "?",
+            "?k",
+            "?k=",
+            "?&",
+            "?&k=1&",
+            "?k0=0&k1=1&k2=&k3&k4=4444",
+            "?a=1&b=2&a=3&a&c=4&a=5",
+            "?a%62=1&ab=2&%61b=3",
+            "?a+b=1&a%20b=2&a%2Bb=3",
+            "?x=1&=2&x=3&=&y",
+            };
+        string_view const keys[] = {
+            "", "k", "k0", "k3", "k4", "k5",
+            "a", "b", "c", "ab", "a%62", "a b",
+            "a+b", "a%20b", "a%2Bb", "x", "y", "z",
+            };
+        for(auto q : queries)
+        {
+            url_view u = parse_uri_reference(q).value();
+            for(auto k : keys)
+            {
+                check(u.params(), k);
+                check(u.encoded_params(), k);
+            }
+        }
+
+        // many params
+        {
+            std::string q = "?";
+            for(int i = 0; i < 100; ++i)
+            {
+                if(i > 0)
+                    q += '&';
+                q += "key" + std::to_string(i % 37) +
+                    "=" + std::to_string(i);
+            }
+            url_view u = parse_uri_reference(q).value();
+            for(int i = 0; i < 40; ++i)
+            {
+                std::string const k =
+                    "key" + std::to_string(i);
+                check(u.params(), k);
+                check(u.encoded_params(), k);
+            }
+        }
+    }
+
+    void
+    testMembers()
+    {
+        url_view u(
+            "/api?limit=10&sort=name&tag=a&tag=b&q=a+b");
+        alignas(std::size_t) char buf[
+            params_index::storage_size(5)];
+        params_index idx(u.params(), buf, sizeof(buf));
+        BOOST_TEST_EQ(idx.params().size(), 5u);
+        BOOST_TEST_EQ(idx.at("sort"), "name");
+        BOOST_TEST_EQ(idx.at("q"), "a b");
+        BOOST_TEST_EQ(idx.at("q",
+            params_index::hash("q")), "a b");
+        BOOST_TEST_EQ(idx.count("tag"), 2u);
+        BOOST_TEST_THROWS(idx.at("x"),
+            std::out_of_range);
+        {
+            auto r = idx.equal_range("tag");
+            BOOST_TEST(r.first != r.second);
+            BOOST_TEST_EQ((*r.first++).value, "a");
+            BOOST_TEST_EQ((*r.first++).value, "b");
+            BOOST_TEST(r.first == r.second);
+        }
+
+        params_encoded_index eidx(
+            u.encoded_params(), buf, sizeof(buf));
+        BOOST_TEST_EQ(eidx.at("q"), "a+b");
+        BOOST_TEST_EQ(eidx.at("%73ort"), "name");
+
+        // storage
+        BOOST_TEST_EQ(params_index::storage_size(0), 0u);
+        BOOST_TEST_GE(params_index::storage_size(5),
+            2 * 5 * sizeof(std::size_t));
+        BOOST_TEST_THROWS(params_index(
+            u.params(), buf, sizeof(buf) - 1),
+            std::length_error);
+        {
+            url_view e("/");
+            params_index none(e.params(), nullptr, 0);
+            BOOST_TEST_EQ(none.count(""), 0u);
+            BOOST_TEST(none.find("") == e.params().end());
+        }
+    }
+
+    void
+    run()
+    {
+        testLookup();
+        testMembers();
+    }
+};
+
+TEST_SUITE(
+    params_index_test,
+    "boost.url.params_index");
+
+} // urls
+} // boost
@@ -119,6 +119,26 @@ public:
             BOOST_TEST(p.contains("f"));
             BOOST_TEST(! p.contains("g"));
         }
+
+        // keys with and without escapes,
+        // across the vector block size
+        {
+            url_view u = parse_uri_reference(
+                "/?a+b=1&a%20b=2&a%2Bb=3&a+b+=4"
+                "&abcdefghijklmnopq=5&abcdefghijklmnop%71=6"
+                "&abcdefghijklmnop+=7&ab").value();
+            params_view p = u.params();
+            BOOST_TEST_EQ(p.count("a b"), 2u);
+            BOOST_TEST_EQ(p.count("a+b"), 1u);
+            BOOST_TEST_EQ(p.count("a b "), 1u);
+            BOOST_TEST_EQ(p.count("a%20b"), 0u);
+            BOOST_TEST_EQ(p.count("abcdefghijklmnopq"), 2u);
+            BOOST_TEST_EQ(p.count("abcdefghijklmnop "), 1u);
+            BOOST_TEST_EQ(p.count("abcdefghijklmnop+"), 0u);
+            BOOST_TEST_EQ(p.count("ab"), 1u);
+            BOOST_TEST_EQ(p.count("a"), 0u);
+            BOOST_TEST_EQ(p.count(""), 0u);
+        }
     }
 
     void
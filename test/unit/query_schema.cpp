@@ -0,0 +1,179 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/query_schema.hpp>
+
+#include <boost/url/url_view.hpp>
+#include "test_suite.hpp"
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+class query_schema_test
+{
+public:
+    enum class order
+    {
+        asc,
+        desc
+    };
+
+    struct search
+    {
+        unsigned page = 1;
+        std::uint8_t limit = 20;
+        int offset = 0;
+        long long big = 0;
+        string_view sort;
+        pct_encoded_view q;
+        bool debug = false;
+        order ord = order::asc;
+        std::vector<unsigned> ids;
+        std::vector<order> ords;
+    };
+
+    static
+    std::pair<string_view, order> const
+    orders[2];
+
+    void
+    testParse()
+    {
+        auto const schema = make_query_schema(
+            query_field("page", &search::page),
+            query_field("limit", &search::limit),
+            query_field("offset", &search::offset),
+            query_field("big", &search::big),
+            query_field("sort", &search::sort),
+            query_field("q", &search::q),
+            query_field("debug", &search::debug),
+            query_field("order", &search::ord, orders),
+            query_field("id", &search::ids),
+            query_field("o", &search::ords, orders));
+
+        auto const ok = [&schema](string_view s)
+        {
+            search v;
+            auto rv = schema.parse(
+                url_view(s).encoded_query(), v);
+            BOOST_TEST(rv.has_value());
+            return v;
+        };
+
+        auto const bad = [&schema](string_view s)
+        {
+            search v;
+            auto rv = schema.parse(
+                url_view(s).encoded_query(), v);
+            BOOST_TEST(rv.has_error());
+        };
+
+        {
+            auto const v = ok("/");
+            BOOST_TEST_EQ(v.page, 1u);
+            BOOST_TEST_EQ(v.limit, 20u);
+            BOOST_TEST(! v.debug);
+            BOOST_TEST(v.ids.empty());
+        }
+        {
+            auto const v = ok(
+                "/s?page=3&limit=255&offset=-12&big=-9223372036854775808"
+                "&sort=a%20b&q=a+b%2Bc&debug&order=desc"
+                "&id=1&id=2&id=%33&o=asc&o=desc&other=x");
+            BOOST_TEST_EQ(v.page, 3u);
+            BOOST_TEST_EQ(v.limit, 255u);
+            BOOST_TEST_EQ(v.offset, -12);
+            BOOST_TEST_EQ(v.big, (std::numeric_limits<
+                long long>::min)());
+            BOOST_TEST_EQ(v.sort, "a%20b");
+            BOOST_TEST_EQ(v.q, "a b+c");
+            BOOST_TEST(v.debug);
+            BOOST_TEST(v.ord == order::desc);
+            BOOST_TEST_EQ(v.ids.size(), 3u);
+            BOOST_TEST_EQ(v.ids[2], 3u);
+            BOOST_TEST_EQ(v.ords.size(), 2u);
+            BOOST_TEST(v.ords[1] == order::desc);
+        }
+        {
+            // encoded keys, last one wins
+            auto const v = ok(
+                "/?%70age=4&pag%65=5&debug=0&debug=true&%6F=desc");
+            BOOST_TEST_EQ(v.page, 5u);
+            BOOST_TEST(v.debug);
+            BOOST_TEST_EQ(v.ords.size(), 1u);
+        }
+        {
+            // empty params and keys
+            auto const v = ok("/?&&=1&page=2&");
+            BOOST_TEST_EQ(v.page, 2u);
+        }
+
+        bad("/?page=");
+        bad("/?page");
+        bad("/?page=-1");
+        bad("/?page=1x");
+        bad("/?page=4294967296");
+        bad("/?limit=256");
+        bad("/?offset=2147483648");
+        bad("/?offset=-");
+        bad("/?offset=+1");
+        bad("/?big=9223372036854775808");
+        bad("/?debug=yes");
+        bad("/?order=up");
+        bad("/?o=asc&o=x");
+    }
+
+    void
+    testKeys()
+    {
+        // keys differing in one character
+        struct s2
+        {
+            int a = 0;
+            int b = 0;
+            int ab = 0;
+            int ba = 0;
+        };
+        auto const schema2 = make_query_schema(
+            query_field("a", &s2::a),
+            query_field("b", &s2::b),
+            query_field("ab", &s2::ab),
+            query_field("ba", &s2::ba));
+        s2 v;
+        BOOST_TEST(schema2.parse(
+            "ba=4&b=2&ab=3&a=1&c=5&aa=6", v));
+        BOOST_TEST_EQ(v.a, 1);
+        BOOST_TEST_EQ(v.b, 2);
+        BOOST_TEST_EQ(v.ab, 3);
+        BOOST_TEST_EQ(v.ba, 4);
+    }
+
+    void
+    run()
+    {
+        testParse();
+        testKeys();
+    }
+};
+
+std::pair<string_view, query_schema_test::order> const
+query_schema_test::orders[2] = {
+    { "asc", order::asc },
+    { "desc", order::desc } };
+
+TEST_SUITE(
+    query_schema_test,
+    "boost.url.query_schema");
+
+} // urls
+} // boost
@@ -10,13 +10,96 @@
 // Test that header file is self-contained.
 #include <boost/url/rfc/ipv4_address_rule.hpp>
 
+#include <boost/url/grammar/dec_octet_rule.hpp>
+#include <boost/url/grammar/delim_rule.hpp>
+#include <boost/url/grammar/tuple_rule.hpp>
 #include "test_rule.hpp"
+#include "corpus.hpp"
+#include <cstdint>
+#include <string>
 
 namespace boost {
 namespace urls {
 
 struct ipv4_address_rule_test
 {
+    // Parse with the grammar of the
+    // RFC, one dec-octet at a time
+    static
+    void
+    check(string_view s)
+    {
+        using namespace grammar;
+        char const* it0 = s.data();
+        char const* const end = it0 + s.size();
+        auto rv0 = grammar::parse(
+            it0, end, tuple_rule(
+                dec_octet_rule, squelch(delim_rule('.')),
+                dec_octet_rule, squelch(delim_rule('.')),
+                dec_octet_rule, squelch(delim_rule('.')),
+                dec_octet_rule));
+        char const* it1 = s.data();
+        auto rv1 = grammar::parse(
+            it1, end, ipv4_address_rule);
+        if(! rv0)
+        {
+            if(BOOST_TEST(! rv1))
+                BOOST_TEST_EQ(rv0.error(), rv1.error());
+            return;
+        }
+        if(! BOOST_TEST(rv1))
+            return;
+        BOOST_TEST_EQ(it0, it1);
+        auto const b = rv1->to_bytes();
+        BOOST_TEST_EQ(b[0], std::get<0>(*rv0));
+        BOOST_TEST_EQ(b[1], std::get<1>(*rv0));
+        BOOST_TEST_EQ(b[2], std::get<2>(*rv0));
+        BOOST_TEST_EQ(b[3], std::get<3>(*rv0));
+    }
+
+    void
+    testReference()
+    {
+        check("");
+        check("1.2.3.4");
+        check("255.255.255.255");
+        check("1.2.3.4:80");
+        check("1.2.3.4.5");
+        check("1.2.3.1234");
+        check("1.2.3.0123");
+        check("1.2.3");
+        check("1.2.3.");
+        check("01.2.3.4");
+        check("256.1.1.1");
+        check("199.299.1.1");
+        check("1.2.3.4" "00000000000000");
+        check("111.222.111.222" "1");
+        check("111.222.111.22" "1");
+
+        // each octet value and its
+        // non-canonical forms
+        for(int i = 0; i < 1000; ++i)
+        {
+            std::string const d = std::to_string(i);
+            check(d + ".1.2.3");
+            check("1." + d + ".2.3");
+            check("1.2.3." + d);
+            check("1.2.3.0" + d);
+        }
+
+        // random strings of digits and dots
+        bench::rng r(1);
+        char const chars[] = "0123456789..x";
+        for(int i = 0; i < 20000; ++i)
+        {
+            std::string s;
+            auto const n = r.range(0, 19);
+            for(std::size_t j = 0; j < n; ++j)
+                s.push_back(chars[r.range(0, 12)]);
+            check(s);
+        }
+    }
+
     void
     run()
     {
@@ -25,6 +108,8 @@ struct ipv4_address_rule_test
             result< ipv4_address > rv = grammar::parse( "192.168.0.1", ipv4_address_rule );
             (void)rv;
         }
+
+        testReference();
     }
 };
 
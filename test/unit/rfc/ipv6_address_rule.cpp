@@ -10,13 +10,277 @@
 // Test that header file is self-contained.
 #include <boost/url/rfc/ipv6_address_rule.hpp>
 
+#include <boost/url/rfc/ipv4_address_rule.hpp>
+#include <boost/url/rfc/detail/h16_rule.hpp>
+#include <boost/url/grammar/hexdig_chars.hpp>
+#include <boost/url/grammar/parse.hpp>
 #include "test_rule.hpp"
+#include "corpus.hpp"
+#include <cstdint>
+#include <cstring>
+#include <string>
 
 namespace boost {
 namespace urls {
 
 struct ipv6_address_rule_test
 {
+    // The rule as it was written with
+    // h16_rule, one word at a time
+    static
+    result<ipv6_address>
+    parse_ref(
+        char const*& it,
+        char const* const end)
+    {
+        auto const maybe_octet =
+            [](unsigned char const* p)
+        {
+            unsigned short word =
+                static_cast<unsigned short>(
+                    p[0]) * 256 +
+                static_cast<unsigned short>(
+                    p[1]);
+            if(word > 0x255)
+                return false;
+            if(((word >>  4) & 0xf) > 9)
+                return false;
+            if((word & 0xf) > 9)
+                return false;
+            return true;
+        };
+        int n = 8;
+        int b = -1;
+        bool c = false;
+        auto prev = it;
+        ipv6_address::bytes_type bytes{};
+        result<detail::h16_rule_t::value_type> rv;
+        for(;;)
+        {
+            if(it == end)
+            {
+                if(b != -1)
+                    break;
+                BOOST_URL_RETURN_EC(
+                    grammar::error::invalid);
+            }
+            if(*it == ':')
+            {
+                ++it;
+                if(it == end)
+                    BOOST_URL_RETURN_EC(
+                        grammar::error::invalid);
+                if(*it == ':')
+                {
+                    if(b == -1)
+                    {
+                        ++it;
+                        --n;
+                        b = n;
+                        if(n == 0)
+                            break;
+                        c = false;
+                        continue;
+                    }
+                    BOOST_URL_RETURN_EC(
+                        grammar::error::invalid);
+                }
+                if(c)
+                {
+                    prev = it;
+                    rv = grammar::parse(
+                        it, end,
+                        detail::h16_rule);
+                    if(! rv)
+                        return rv.error();
+                    bytes[2*(8-n)+0] = rv->hi;
+                    bytes[2*(8-n)+1] = rv->lo;
+                    --n;
+                    if(n == 0)
+                        break;
+                    continue;
+                }
+                BOOST_URL_RETURN_EC(
+                    grammar::error::invalid);
+            }
+            if(*it == '.')
+            {
+                if(b == -1 && n > 1)
+                    BOOST_URL_RETURN_EC(
+                        grammar::error::invalid);
+                if(! maybe_octet(
+                    &bytes[2*(7-n)]))
+                    BOOST_URL_RETURN_EC(
+                        grammar::error::invalid);
+                it = prev;
+                auto rv1 = grammar::parse(
+                    it, end, ipv4_address_rule);
+                if(! rv1)
+                    return rv1.error();
+                auto const b4 =
+                    rv1->to_bytes();
+                bytes[2*(7-n)+0] = b4[0];
+                bytes[2*(7-n)+1] = b4[1];
+                bytes[2*(7-n)+2] = b4[2];
+                bytes[2*(7-n)+3] = b4[3];
+                --n;
+                break;
+            }
+            auto d =
+                grammar::hexdig_value(*it);
+            if( b != -1 &&
+                d < 0)
+                break;
+            if(! c)
+            {
+                prev = it;
+                rv = grammar::parse(
+                    it, end,
+                    detail::h16_rule);
+                if(! rv)
+                    return rv.error();
+                bytes[2*(8-n)+0] = rv->hi;
+                bytes[2*(8-n)+1] = rv->lo;
+                --n;
+                if(n == 0)
+                    break;
+                c = true;
+                continue;
+            }
+            BOOST_URL_RETURN_EC(
+                grammar::error::invalid);
+        }
+        if(b == -1)
+            return ipv6_address{bytes};
+        if(b == n)
+        {
+            auto const i =
+                2 * (7 - n);
+            std::memset(
+                &bytes[i],
+                0, 16 - i);
+        }
+        else if(b == 7)
+        {
+            auto const i =
+                2 * (b - n);
+            std::memmove(
+                &bytes[16 - i],
+                &bytes[2],
+                i);
+            std::memset(
+                &bytes[0],
+                0, 16 - i);
+        }
+        else
+        {
+            auto const i0 =
+                2 * (7 - b);
+            auto const i1 =
+                2 * (b - n);
+            std::memmove(
+                &bytes[16 - i1],
+                &bytes[i0 + 2],
+                i1);
+            std::memset(
+                &bytes[i0],
+                0, 16 - (i0 + i1));
+        }
+        return ipv6_address{bytes};
+    }
+
+    static
+    void
+    check(string_view s)
+    {
+        char const* it0 = s.data();
+        char const* const end = it0 + s.size();
+        auto rv0 = parse_ref(it0, end);
+        char const* it1 = s.data();
+        auto rv1 = grammar::parse(
+            it1, end, ipv6_address_rule);
+        if(! rv0)
+        {
+            BOOST_TEST(! rv1);
+            return;
+        }
+        if(! BOOST_TEST(rv1))
+            return;
+        BOOST_TEST_EQ(it0, it1);
+        BOOST_TEST_EQ(*rv0, *rv1);
+    }
+
+    void
+    testReference()
+    {
+        char const* const cases[] = {
+            "", ":", "::", ":::", "::1", "1::", "1::2",
+            "1:2:3:4:5:6:7:8", "1:2:3:4:5:6:7:8:9",
+            "1:2:3:4:5:6:7::", "1:2:3:4:5:6:7:8::",
+            "::1:2:3:4:5:6:7", "1:2:3:4:5:6::7",
+            "1:2:3:4:5:6:7", "1:2:3:4:5:6:7:",
+            "12345::", "1::2::3", "1:::2", ":1::2",
+            "ffff:FFFF:abcd:ABCD:0:00:000:0000",
+            "::ffff:1.2.3.4", "::1.2.3.4", "1::2.3.4.5",
+            "1:2:3:4:5:6:1.2.3.4", "1:2:3:4:5::1.2.3.4",
+            "1:2:3:4:5:6::1.2.3.4", "1:2:3:4:5:6:7:1.2.3.4",
+            "1:2:3:4:5:1.2.3.4", "::a.2.3.4", "::256.1.1.1",
+            "::0255.1.1.1", "::1.2.3", "::1.2.3.4.5",
+            "::.1.2.3", "1::.1.2.3", "::1:", "1::g", "1::2g",
+            "1::2:g", "1g", "[::1]", "::1]", "::1/64",
+            "fe80::1%25eth0", "2001:db8::7:8:9:10:11",
+            "1:2:3:4:5:6:7:8]/a/long/path/after/the/address",
+            "ffff:ffff:ffff:ffff:ffff:ffff:255.255.255.255]/path",
+            "1111:2222:3333:4444:5555:6666:7777:8888:9999:aaaa",
+            "1111:2222:3333:4444:5555:6666:7777::aaaa:bbbb:cccc",
+            "::1]/0123456789012345678901234567890123456789" };
+        for(auto s : cases)
+            check(s);
+
+        // random strings of the
+        // chars of an address
+        bench::rng r(1);
+        char const chars[] = "0123456789abcdefABCDEF:::..g]";
+        for(int i = 0; i < 50000; ++i)
+        {
+            std::string s;
+            auto const n = r.range(0, 47);
+            for(std::size_t j = 0; j < n; ++j)
+                s.push_back(chars[r.range(0, 28)]);
+            check(s);
+        }
+
+        // random words, joined with ':', a
+        // "::" and an IPv4 tail in places
+        for(int i = 0; i < 50000; ++i)
+        {
+            std::string s;
+            auto const nw = r.range(0, 9);
+            auto const dbl = r.range(0, 11);
+            for(std::size_t j = 0; j < nw; ++j)
+            {
+                if(j == dbl)
+                    s.append("::");
+                else if(j > 0)
+                    s.push_back(':');
+                auto const len = r.range(1, 5);
+                for(std::size_t k = 0; k < len; ++k)
+                    s.push_back("0123456789abcdef"
+                        [r.range(0, 15)]);
+            }
+            if(dbl == nw)
+                s.append("::");
+            if(r.chance(1.0 / 3))
+            {
+                if(! s.empty() && s.back() != ':')
+                    s.push_back(':');
+                s.append(std::to_string(r.range(0, 299)));
+                s.append(".1.2.3");
+            }
+            check(s);
+        }
+    }
+
     void
     run()
     {
@@ -25,6 +289,8 @@ struct ipv6_address_rule_test
             result< ipv6_address > rv = grammar::parse( "2001:0db8:85a3:0000:0000:8a2e:0370:7334", ipv6_address_rule );
             (void)rv;
         }
+
+        testReference();
     }
 };
 
@@ -0,0 +1,306 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/router.hpp>
+
+#include <boost/url/url_view.hpp>
+#include "test_suite.hpp"
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace urls {
+
+class router_test
+{
+public:
+    static
+    std::vector<std::string>
+    split(string_view s)
+    {
+        std::vector<std::string> v;
+        if(! s.empty() && s.front() == '/')
+            s.remove_prefix(1);
+        if(s.empty())
+            return v;
+        for(;;)
+        {
+            auto const pos = s.find('/');
+            v.emplace_back(s.substr(0, pos));
+            if(pos == string_view::npos)
+                break;
+            s.remove_prefix(pos + 1);
+        }
+        return v;
+    }
+
+    // Rank of a match: the kind of each
+    // pattern segment, literals first.
+    // Empty when there is no match.
+    static
+    std::string
+    rank(
+        std::vector<std::string> const& p,
+        std::vector<std::string> const& t)
+    {
+        std::string r;
+        for(std::size_t i = 0; i < p.size(); ++i)
+        {
+            if(p[i] == "*")
+                return r + '2';
+            if(i >= t.size())
+                return {};
+            if(p[i].front() == '{')
+            {
+                if(t[i].empty())
+                    return {};
+                r += '1';
+                continue;
+            }
+            if(p[i] != t[i])
+                return {};
+            r += '0';
+        }
+        if(p.size() != t.size())
+            return {};
+        // shorter patterns win ties
+        return r + '/';
+    }
+
+    static
+    void
+    check(
+        router<std::size_t> const& r,
+        std::vector<std::string> const& patterns,
+        string_view target)
+    {
+        auto const t = split(target);
+        std::size_t best = string_view::npos;
+        std::string best_rank;
+        for(std::size_t i = 0; i < patterns.size(); ++i)
+        {
+            auto const k = rank(
+                split(patterns[i]), t);
+            if(k.empty())
+                continue;
+            if( best == string_view::npos ||
+                k < best_rank)
+            {
+                best = i;
+                best_rank = k;
+            }
+        }
+        route_match m;
+        auto const v = r.find(
+            parse_path(target).value(), m);
+        if(best == string_view::npos)
+        {
+            BOOST_TEST(v == nullptr);
+            return;
+        }
+        if(! BOOST_TEST(v != nullptr))
+            return;
+        BOOST_TEST_EQ(*v, best);
+    }
+
+    void
+    testMatch()
+    {
+        router<int> r;
+        r.insert("/", 0);
+        r.insert("/api/users", 1);
+        r.insert("/api/users/{id}", 2);
+        r.insert("/api/users/{id}/posts", 3);
+        r.insert("/api/users/me", 4);
+        r.insert("/api/users/{id}/posts/{post}", 5);
+        r.insert("/static/*", 6);
+        r.insert("/api/items/", 7);
+        r.insert("/caf%C3%A9", 8);
+        r.insert("/api/v1/a/b/c", 9);
+        r.insert("/api/v1/a/x", 10);
+        r.insert("/api/*", 11);
+        BOOST_TEST_EQ(r.size(), 12u);
+
+        auto const find = [&r](
+            string_view s, route_match& m) -> int
+        {
+            url_view u = parse_uri_reference(s).value();
+            auto const v = r.find(u.encoded_segments(), m);
+            return v ? *v : -1;
+        };
+
+        route_match m;
+        BOOST_TEST_EQ(find("/", m), 0);
+        BOOST_TEST(m.empty());
+        BOOST_TEST_EQ(find("", m), 0);
+        BOOST_TEST_EQ(find("/api/users", m), 1);
+        BOOST_TEST_EQ(find("/api/users/42", m), 2);
+        BOOST_TEST_EQ(m.size(), 1u);
+        BOOST_TEST_EQ(m.name(0), "id");
+        BOOST_TEST_EQ(m.value(0), "42");
+        BOOST_TEST_EQ(m.at("id"), "42");
+        BOOST_TEST(m.contains("id"));
+        BOOST_TEST(! m.contains("post"));
+        BOOST_TEST_THROWS(m.at("post"),
+            std::out_of_range);
+        BOOST_TEST_EQ(find("/api/users/me", m), 4);
+        BOOST_TEST(m.empty());
+        BOOST_TEST_EQ(find("/api/users/me/posts", m), 3);
+        BOOST_TEST_EQ(m.at("id"), "me");
+        BOOST_TEST_EQ(find("/api/users/a%20b/posts/7", m), 5);
+        BOOST_TEST_EQ(m.at("id"), "a%20b");
+        BOOST_TEST_EQ(m.at("post"), "7");
+        BOOST_TEST_EQ(find("/static/css/site.css", m), 6);
+        BOOST_TEST_EQ(m.at("*"), "css/site.css");
+        BOOST_TEST_EQ(find("/static", m), 6);
+        BOOST_TEST_EQ(m.at("*"), "");
+        BOOST_TEST_EQ(find("/static/", m), 6);
+        BOOST_TEST_EQ(find("/api/items/", m), 7);
+        BOOST_TEST_EQ(find("/api/items", m), 11);
+        BOOST_TEST_EQ(m.at("*"), "items");
+        BOOST_TEST_EQ(find("/api/users/", m), 11);
+        BOOST_TEST_EQ(find("/api/v1/a/b/c", m), 9);
+        BOOST_TEST_EQ(find("/api/v1/a/x", m), 10);
+        BOOST_TEST_EQ(find("/api/v1/a/b", m), 11);
+        BOOST_TEST_EQ(find("/api/v1/a/b/c/d", m), 11);
+        BOOST_TEST_EQ(find("/other", m), -1);
+        BOOST_TEST_EQ(find("/api", m), 11);
+
+        // escapes are compared decoded
+        BOOST_TEST_EQ(find("/caf%c3%a9", m), 8);
+        BOOST_TEST_EQ(find("/%61pi/users", m), 1);
+        BOOST_TEST_EQ(find("/api/user%73/me", m), 4);
+        BOOST_TEST_EQ(find("/api%2Fusers", m), -1);
+
+        // prefixes of relative paths
+        BOOST_TEST_EQ(find("api/users", m), 1);
+        BOOST_TEST_EQ(find("./api/users", m), 1);
+    }
+
+    void
+    testInsert()
+    {
+        router<int> r;
+        r.insert("/a/{id}", 1);
+        BOOST_TEST_THROWS(r.insert("/a/{id}", 2),
+            std::invalid_argument);
+        BOOST_TEST_THROWS(r.insert("/a/{name}/b", 2),
+            std::invalid_argument);
+        BOOST_TEST_THROWS(r.insert("/a/*/b", 2),
+            std::invalid_argument);
+        BOOST_TEST_THROWS(r.insert("/a/{x", 2),
+            std::invalid_argument);
+        BOOST_TEST_THROWS(r.insert("/a/{}", 2),
+            std::invalid_argument);
+        BOOST_TEST_THROWS(r.insert("/a/%zz", 2),
+            std::invalid_argument);
+        BOOST_TEST_THROWS(r.insert(
+            "/{a}/{b}/{c}/{d}/{e}/{f}/{g}/{h}/{i}"
+            "/{j}/{k}/{l}/{m}/{n}/{o}/{p}/{q}", 2),
+            std::invalid_argument);
+        BOOST_TEST_EQ(r.size(), 1u);
+        r.insert("/a/{id}/b", 2);
+        BOOST_TEST_EQ(r.size(), 2u);
+
+        // escapes are compared decoded
+        r.insert("/api/users", 3);
+        BOOST_TEST_THROWS(r.insert("/api/user%73", 4),
+            std::invalid_argument);
+        r.insert("/caf%C3%A9", 4);
+        BOOST_TEST_THROWS(r.insert("/caf%c3%a9", 5),
+            std::invalid_argument);
+        r.insert("/api/user%73/me", 5);
+        BOOST_TEST_EQ(r.size(), 5u);
+        route_match m;
+        auto const v = r.find(parse_uri_reference(
+            "/api/users/me").value().encoded_segments(), m);
+        if(BOOST_TEST(v != nullptr))
+            BOOST_TEST_EQ(*v, 5);
+    }
+
+    void
+    testReference()
+    {
+        // random routes over a small
+        // alphabet, checked against
+        // a linear matcher
+        std::uint32_t seed = 1;
+        auto const rnd = [&seed](std::uint32_t n)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            return (seed >> 8) % n;
+        };
+        char const* const lits[] = {
+            "a", "b", "ab", "" };
+        char const* const names[] = {
+            "{x}", "{y}", "{z}", "{w}", "{v}" };
+
+        for(int round = 0; round < 20; ++round)
+        {
+            router<std::size_t> r;
+            std::vector<std::string> patterns;
+            for(int i = 0; i < 40; ++i)
+            {
+                std::string p;
+                auto const n = rnd(5);
+                for(std::uint32_t j = 0; j < n; ++j)
+                {
+                    p += '/';
+                    auto const k = rnd(10);
+                    if(k < 6)
+                        p += lits[rnd(4)];
+                    else if(k < 9)
+                        p += names[j];
+                    else
+                    {
+                        p += '*';
+                        break;
+                    }
+                }
+                bool dup = false;
+                for(auto const& q : patterns)
+                    if(split(q) == split(p))
+                        dup = true;
+                if(dup)
+                    continue;
+                r.insert(p, patterns.size());
+                patterns.push_back(p);
+            }
+            for(int i = 0; i < 200; ++i)
+            {
+                std::string t;
+                auto const n = rnd(6);
+                for(std::uint32_t j = 0; j < n; ++j)
+                {
+                    t += '/';
+                    t += lits[rnd(4)];
+                }
+                check(r, patterns, t);
+            }
+        }
+    }
+
+    void
+    run()
+    {
+        testMatch();
+        testInsert();
+        testReference();
+    }
+};
+
+TEST_SUITE(
+    router_test,
+    "boost.url.router");
+
+} // urls
+} // boost
@@ -12,6 +12,7 @@
 
 #include <boost/url/grammar/ci_string.hpp>
 #include "test_suite.hpp"
+#include <string>
 
 namespace boost {
 namespace urls {
@@ -38,9 +39,104 @@ public:
             scheme::unknown));
     }
 
+    void
+    testInfo()
+    {
+        BOOST_TEST(get_scheme_info(scheme::none) == nullptr);
+        BOOST_TEST(get_scheme_info(scheme::unknown) == nullptr);
+        BOOST_TEST_EQ(default_port(scheme::none), 0);
+        BOOST_TEST_EQ(default_port(scheme::unknown), 0);
+        BOOST_TEST_EQ(default_port(scheme::ftp), 21);
+        BOOST_TEST_EQ(default_port(scheme::file), 0);
+        BOOST_TEST_EQ(default_port(scheme::http), 80);
+        BOOST_TEST_EQ(default_port(scheme::https), 443);
+        BOOST_TEST_EQ(default_port(scheme::ws), 80);
+        BOOST_TEST_EQ(default_port(scheme::wss), 443);
+
+        scheme const known[] = {
+            scheme::ftp, scheme::file,
+            scheme::http, scheme::https,
+            scheme::ws, scheme::wss };
+        for(auto id : known)
+        {
+            scheme_info const* info =
+                get_scheme_info(id);
+            if(! BOOST_TEST(info != nullptr))
+                continue;
+            BOOST_TEST(info->id == id);
+            BOOST_TEST_EQ(info->name, to_string(id));
+            BOOST_TEST(string_to_scheme(
+                info->name) == id);
+            BOOST_TEST_EQ(info->requires_authority,
+                id != scheme::file);
+            BOOST_TEST(info->empty_path_is_root);
+        }
+    }
+
+    // every string of up to four chars
+    // from the chars of the known schemes
+    void
+    testExhaustive()
+    {
+        scheme const known[] = {
+            scheme::ftp, scheme::file,
+            scheme::http, scheme::https,
+            scheme::ws, scheme::wss };
+        string_view const cs = "efhilpstwHPSW0.";
+        std::string s;
+        auto const ref = [&known](
+            string_view s) -> scheme
+        {
+            if(s.empty())
+                return scheme::none;
+            for(auto id : known)
+            {
+                string_view const n = to_string(id);
+                if(n.size() != s.size())
+                    continue;
+                std::size_t i = 0;
+                while( i < n.size() &&
+                    grammar::to_lower(s[i]) == n[i])
+                    ++i;
+                if(i == n.size())
+                    return id;
+            }
+            return scheme::unknown;
+        };
+        auto const visit = [&](std::size_t n)
+        {
+            std::size_t count = 1;
+            for(std::size_t i = 0; i < n; ++i)
+                count *= cs.size();
+            for(std::size_t k = 0; k < count; ++k)
+            {
+                s.clear();
+                for(std::size_t j = 0, v = k; j < n; ++j)
+                {
+                    s.push_back(cs[v % cs.size()]);
+                    v /= cs.size();
+                }
+                BOOST_TEST(string_to_scheme(s) == ref(s));
+            }
+        };
+        for(std::size_t n = 0; n <= 4; ++n)
+            visit(n);
+        check("https", scheme::https);
+        check("HTTPs", scheme::https);
+        check("httpS", scheme::https);
+        check("httpss");
+        check("htTp:");
+        check(std::string("http\0", 5));
+        check("hTtP5");
+        check("wss.");
+    }
+
     void
     run()
     {
+        testInfo();
+        testExhaustive();
+
         // (none)
         check("", scheme::none);
 
@@ -0,0 +1,182 @@
+//
+// Copyright (c) 2022 Alan de Freitas (alandefreitas@gmail.com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/CPPAlliance/url
+//
+
+// Test that header file is self-contained.
+#include <boost/url/segments_index.hpp>
+
+#include <boost/url/url_view.hpp>
+#include "test_suite.hpp"
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+namespace boost {
+namespace urls {
+
+class segments_index_test
+{
+public:
+    // must agree with the views
+    static
+    void
+    check(url_view const& u)
+    {
+        {
+            auto const sv = u.segments();
+            segments_index idx(sv);
+            BOOST_TEST_EQ(idx.size(), sv.size());
+            BOOST_TEST_EQ(idx.empty(), sv.empty());
+            BOOST_TEST_EQ(
+                idx.segments().size(), sv.size());
+            std::size_t i = 0;
+            for(auto s : sv)
+            {
+                BOOST_TEST_EQ(idx[i], s);
+                BOOST_TEST_EQ(idx.at(i), s);
+                BOOST_TEST_EQ(idx.begin()[i], s);
+                ++i;
+            }
+            BOOST_TEST_EQ(i, idx.size());
+            BOOST_TEST_EQ(static_cast<std::size_t>(
+                idx.end() - idx.begin()), idx.size());
+            BOOST_TEST_THROWS(idx.at(i),
+                std::out_of_range);
+            if(! sv.empty())
+            {
+                BOOST_TEST_EQ(idx.front(), sv.front());
+                BOOST_TEST_EQ(idx.back(), sv.back());
+            }
+        }
+        {
+            auto const sv = u.encoded_segments();
+            segments_encoded_index idx(sv);
+            BOOST_TEST_EQ(idx.size(), sv.size());
+            std::size_t i = 0;
+            for(auto s : sv)
+            {
+                BOOST_TEST_EQ(idx[i], s);
+                BOOST_TEST_EQ(idx.at(i), s);
+                ++i;
+            }
+            BOOST_TEST_EQ(i, idx.size());
+            BOOST_TEST_THROWS(idx.at(i),
+                std::out_of_range);
+
+            // copies own their table
+            segments_encoded_index idx2(idx);
+            segments_encoded_index idx3(
+                url_view("/x").encoded_segments());
+            idx3 = idx;
+            idx = idx3;
+            for(i = 0; i < idx.size(); ++i)
+            {
+                BOOST_TEST_EQ(idx2[i], idx[i]);
+                BOOST_TEST_EQ(idx3[i], idx[i]);
+            }
+
+            // reverse
+            auto it = idx.end();
+            auto sit = sv.end();
+            while(it != idx.begin())
+            {
+                --it;
+                --sit;
+                BOOST_TEST_EQ(*it, *sit);
+            }
+        }
+    }
+
+    void
+    testIndex()
+    {
+        string_view const paths[] = {
+            "",
+            "/",
+            "//",
+            "/a",
+            "/a/",
+            "a",
+            "a/",
+            "a//b",
+            "./",
+            "./a:b",
+            "./a:b/c",
+            "/./",
+            "/./x",
+            "/.//x",
+            "x:",
+            "x:/",
+            "x:./y",
+            "//host",
+            "//host/",
+            "//host/a/b/",
+            "/a%2Fb/c%20d",
+            "/%2e/%2e%2e/..",
+            "/1/2/3/4/5/6/7/8/9/10/11/12/13/14/15",
+            "/1/2/3/4/5/6/7/8/9/10/11/12/13/14/15/16",
+            "/1/2/3/4/5/6/7/8/9/10/11/12/13/14/15/16/",
+            "////////////////////////////////////",
+            "/aaaaaaaaaaaaaaaa/bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb/c",
+            };
+        for(auto s : paths)
+            check(parse_uri_reference(s).value());
+
+        // deep paths
+        {
+            std::string s;
+            for(int i = 0; i < 200; ++i)
+                s += "/seg" + std::to_string(i);
+            check(parse_uri_reference(s).value());
+        }
+    }
+
+    void
+    testMembers()
+    {
+        url_view u("/api/v1/users/42/posts");
+        segments_index idx(u.segments());
+        BOOST_TEST_EQ(idx.size(), 5u);
+        BOOST_TEST_EQ(idx[3], "42");
+        BOOST_TEST_EQ(idx.front(), "api");
+        BOOST_TEST_EQ(idx.back(), "posts");
+
+        auto it = idx.begin();
+        it += 2;
+        BOOST_TEST_EQ(*it, "users");
+        BOOST_TEST_EQ(*(it + 1), "42");
+        BOOST_TEST_EQ(*(it - 2), "api");
+        BOOST_TEST(it > idx.begin());
+        BOOST_TEST(it < idx.end());
+        BOOST_TEST_EQ(std::distance(it, idx.end()), 3);
+
+        // prefix is skipped
+        url_view v("./a:b/%20");
+        segments_index vidx(v.segments());
+        BOOST_TEST_EQ(vidx.size(), 2u);
+        BOOST_TEST_EQ(vidx[0], "a:b");
+        BOOST_TEST_EQ(vidx[1], " ");
+        segments_encoded_index evidx(
+            v.encoded_segments());
+        BOOST_TEST_EQ(evidx.back(), "%20");
+    }
+
+    void
+    run()
+    {
+        testIndex();
+        testMembers();
+    }
+};
+
+TEST_SUITE(
+    segments_index_test,
+    "boost.url.segments_index");
+
+} // urls
+} // boost
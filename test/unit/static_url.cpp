@@ -174,6 +174,97 @@ public:
         BOOST_TEST_EQ(u.encoded_fragment(), "frag");
     }
 
+    void
+    testAliasedEdit()
+    {
+        // the new chars are the string
+        // being replaced
+        {
+            static_url<40> u(
+                "http://x/aaaaaaaaaaaaaaaaaaaaaaaaa");
+            u.set_encoded_path(u.encoded_path());
+            BOOST_TEST_EQ(u.string(),
+                "http://x/aaaaaaaaaaaaaaaaaaaaaaaaa");
+        }
+
+        // no room for the new chars
+        // past the end
+        {
+            static_url<40> u(
+                "http://x/aaaaaaaaaaaaaaaaaaaa?bbbbbb");
+            u.set_encoded_path(u.encoded_query());
+            BOOST_TEST_EQ(u.string(),
+                "http://x/bbbbbb?bbbbbb");
+            u.set_encoded_fragment(u.encoded_path());
+            BOOST_TEST_EQ(u.string(),
+                "http://x/bbbbbb?bbbbbb#/bbbbbb");
+            u.set_encoded_query(u.encoded_fragment());
+            BOOST_TEST_EQ(u.string(),
+                "http://x/bbbbbb?/bbbbbb#/bbbbbb");
+        }
+        {
+            static_url<32> u(
+                "http://x/ab?cdefghij");
+            u.set_encoded_user(
+                u.encoded_query());
+            BOOST_TEST_EQ(u.string(),
+                "http://cdefghij@x/ab?cdefghij");
+        }
+        {
+            static_url<32> u(
+                "http://x/ab?cdefghij");
+            u.set_user(u.query());
+            BOOST_TEST_EQ(u.string(),
+                "http://cdefghij@x/ab?cdefghij");
+        }
+        {
+            static_url<36> u(
+                "http://x/aaaaaaaaaaaaaaaaaaaa?b%2Fc");
+            u.set_path(u.query());
+            BOOST_TEST_EQ(u.string(),
+                "http://x/b/c?b%2Fc");
+        }
+        {
+            static_url<16> u(
+                "http://x/ab?ftp");
+            u.set_scheme(u.encoded_query());
+            BOOST_TEST_EQ(u.string(),
+                "ftp://x/ab?ftp");
+        }
+        {
+            static_url<22> u(
+                "http://x:1/?8080");
+            u.set_port(u.encoded_query());
+            BOOST_TEST_EQ(u.string(),
+                "http://x:8080/?8080");
+            u.set_encoded_host(
+                u.encoded_query());
+            BOOST_TEST_EQ(u.string(),
+                "http://8080:8080/?8080");
+        }
+
+        // the string is the chars being
+        // replaced, and is copied past
+        // the new end
+        {
+            static_url<30> u(
+                "http://x/%41%41?q");
+            u.set_path(u.encoded_path());
+            BOOST_TEST_EQ(u.string(),
+                "http://x/%2541%2541?q");
+        }
+
+        // the result does not fit
+        {
+            static_url<24> u(
+                "http://x/ab?cdefghij");
+            BOOST_TEST_THROWS(
+                u.set_encoded_fragment(
+                    u.string()),
+                std::bad_alloc);
+        }
+    }
+
     void
     testOstream()
     {
@@ -202,6 +293,7 @@ public:
 
         testSpecial();
         testParts();
+        testAliasedEdit();
         testOstream();
     }
 };